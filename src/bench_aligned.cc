@@ -0,0 +1,80 @@
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+
+#include "s21_aligned_vector.h"
+
+// Сумма float-ов AVX2 по буферу с разным выравниванием: aligned_vector<float,
+// 64> с выровненными загрузками (_mm256_load_ps), он же с невыровненными
+// (_mm256_loadu_ps) и s21::vector<float>, сдвинутый на один элемент, — так
+// каждая вторая загрузка пересекает строку кэша. Размеры подобраны под L1,
+// L2 и память. Запуск: ./bench_aligned.out [repeat], по умолчанию
+// repeat = 200. Без x86-64 и AVX2 бенчмарк ничего не измеряет.
+
+#if defined(__x86_64__) || defined(_M_X64)
+#include <immintrin.h>
+
+static volatile float sink = 0;
+
+// четыре аккумулятора, чтобы упираться в загрузки, а не в задержку сложения
+template <bool Aligned>
+__attribute__((target("avx2"))) static float Sum(const float *data,
+                                                 size_t n) {
+  __m256 acc[4] = {_mm256_setzero_ps(), _mm256_setzero_ps(),
+                   _mm256_setzero_ps(), _mm256_setzero_ps()};
+  size_t i = 0;
+  for (; i + 32 <= n; i += 32) {
+    for (int k = 0; k < 4; ++k) {
+      const float *ptr = data + i + 8 * k;
+      __m256 x = Aligned ? _mm256_load_ps(ptr) : _mm256_loadu_ps(ptr);
+      acc[k] = _mm256_add_ps(acc[k], x);
+    }
+  }
+  alignas(32) float lanes[8];
+  _mm256_store_ps(lanes, _mm256_add_ps(_mm256_add_ps(acc[0], acc[1]),
+                                       _mm256_add_ps(acc[2], acc[3])));
+  float sum = 0;
+  for (float lane : lanes) sum += lane;
+  for (; i < n; ++i) sum += data[i];
+  return sum;
+}
+
+template <typename Kernel>
+static void Bench(const char *name, const float *data, size_t n,
+                  size_t repeat, Kernel sum) {
+  sink = sink + sum(data, n);
+  auto start = std::chrono::steady_clock::now();
+  for (size_t r = 0; r < repeat; ++r) sink = sink + sum(data, n);
+  auto stop = std::chrono::steady_clock::now();
+  double ns = std::chrono::duration<double, std::nano>(stop - start).count();
+  double bytes = static_cast<double>(n) * sizeof(float) * repeat;
+  std::printf("%-22s %9zu %6zu %12.3f %10.2f\n", name, n,
+              static_cast<size_t>(reinterpret_cast<uintptr_t>(data) % 64),
+              ns / (static_cast<double>(n) * repeat), bytes / ns);
+}
+
+int main(int argc, char **argv) {
+  if (!__builtin_cpu_supports("avx2")) {
+    std::printf("AVX2 is not supported\n");
+    return 0;
+  }
+  size_t repeat = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 200;
+  std::printf("%-22s %9s %6s %12s %10s\n", "buffer", "floats", "mod64",
+              "ns/float", "GB/s");
+  for (size_t n : {size_t(4) << 10, size_t(64) << 10, size_t(4) << 20}) {
+    size_t count = n > (size_t(64) << 10) ? repeat / 20 + 1 : repeat * 20;
+    s21::aligned_vector<float, 64> aligned(n, 1.0f);
+    s21::vector<float> shifted(n + 1, 1.0f);
+    Bench("aligned, load", aligned.data(), n, count, Sum<true>);
+    Bench("aligned, loadu", aligned.data(), n, count, Sum<false>);
+    Bench("vector + 1, loadu", shifted.data() + 1, n, count, Sum<false>);
+  }
+  return 0;
+}
+#else
+int main() {
+  std::printf("x86-64 only\n");
+  return 0;
+}
+#endif
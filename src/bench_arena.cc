@@ -0,0 +1,110 @@
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+#include "s21_memory_resource.h"
+
+// Запрос строит map<int, int> и list<int> по size элементов и выбрасывает
+// их. Сравниваются способы освобождения: std::allocator (map::DeleteAll и
+// list::~list отдают каждый узел в delete), пул узлов, арена с деструкторами
+// (обход узлов остаётся, deallocate пустой) и арена без деструкторов —
+// контейнеры лежат в самой арене и исчезают вместе с ней в release(), что
+// допустимо для тривиально разрушаемых элементов. Печатается время
+// построения, время освобождения и всё вместе на один запрос. Запуск:
+// ./bench_arena.out [repeat], по умолчанию repeat = 2000.
+
+static volatile long sink = 0;
+
+typedef std::chrono::steady_clock Clock;
+
+static double Ns(Clock::time_point start, Clock::time_point stop) {
+  return std::chrono::duration<double, std::nano>(stop - start).count();
+}
+
+template <typename Map, typename List>
+static void Fill(Map &map, List &list, size_t size) {
+  for (size_t i = 0; i < size; ++i) {
+    int key = static_cast<int>((i * 7919) % size);
+    map.insert(key, key);
+    list.push_back(key);
+  }
+  sink = sink + map.size() + list.size();
+}
+
+static void Print(const char *name, size_t size, double build, double free,
+                  size_t repeat) {
+  std::printf("%-18s %7zu %12.0f %12.0f %12.0f\n", name, size, build / repeat,
+              free / repeat, (build + free) / repeat);
+}
+
+template <template <typename> class Alloc>
+static void BenchHeap(const char *name, size_t size, size_t repeat) {
+  double build = 0, free = 0;
+  for (size_t r = 0; r < repeat; ++r) {
+    auto start = Clock::now();
+    auto *map = new s21::map<int, int, Alloc<std::pair<const int, int>>>;
+    auto *list = new s21::list<int, Alloc<int>>;
+    Fill(*map, *list, size);
+    auto middle = Clock::now();
+    delete map;
+    delete list;
+    auto stop = Clock::now();
+    build += Ns(start, middle);
+    free += Ns(middle, stop);
+  }
+  Print(name, size, build, free, repeat);
+}
+
+static void BenchArena(size_t size, size_t repeat) {
+  s21::monotonic_arena arena;
+  double build = 0, free = 0;
+  for (size_t r = 0; r < repeat; ++r) {
+    auto start = Clock::now();
+    auto *map = new s21::pmr::map<int, int>(&arena);
+    auto *list = new s21::pmr::list<int>(&arena);
+    Fill(*map, *list, size);
+    auto middle = Clock::now();
+    delete map;
+    delete list;
+    arena.release();
+    auto stop = Clock::now();
+    build += Ns(start, middle);
+    free += Ns(middle, stop);
+  }
+  Print("arena + dtor", size, build, free, repeat);
+}
+
+static void BenchArenaNoDtor(size_t size, size_t repeat) {
+  typedef s21::pmr::map<int, int> Map;
+  typedef s21::pmr::list<int> List;
+  s21::monotonic_arena arena;
+  double build = 0, free = 0;
+  for (size_t r = 0; r < repeat; ++r) {
+    auto start = Clock::now();
+    Map *map = new (arena.allocate(sizeof(Map), alignof(Map))) Map(&arena);
+    List *list =
+        new (arena.allocate(sizeof(List), alignof(List))) List(&arena);
+    Fill(*map, *list, size);
+    auto middle = Clock::now();
+    arena.release();
+    auto stop = Clock::now();
+    build += Ns(start, middle);
+    free += Ns(middle, stop);
+  }
+  Print("arena, no dtor", size, build, free, repeat);
+}
+
+int main(int argc, char **argv) {
+  size_t repeat = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 2000;
+  std::printf("%-18s %7s %12s %12s %12s\n", "allocator", "size", "build ns",
+              "free ns", "total ns");
+  for (size_t size : {16, 256, 4096, 65536}) {
+    size_t count = size > 4096 ? repeat / 20 + 1 : repeat;
+    BenchHeap<std::allocator>("std::allocator", size, count);
+    BenchHeap<s21::pool_allocator>("pool_allocator", size, count);
+    BenchArena(size, count);
+    BenchArenaNoDtor(size, count);
+  }
+  return 0;
+}
@@ -0,0 +1,54 @@
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "s21_concurrent_vector.h"
+#include "s21_vector.h"
+
+// Масштабирование дописывания из многих потоков: 1, 2, 4, ..., 64 потока
+// вместе добавляют total элементов uint64_t в s21::vector под std::mutex
+// и в concurrent_vector без блокировок. Выводятся миллионы вставок в
+// секунду. Реальный рост виден только при числе ядер не меньше числа
+// потоков. Запуск: ./bench_concurrent.out [total], по умолчанию 4 Mi
+
+static volatile size_t sink = 0;
+
+template <typename Push>
+static double Run(size_t threads, size_t total, Push push) {
+  std::vector<std::thread> workers;
+  size_t per_thread = total / threads;
+  auto start = std::chrono::steady_clock::now();
+  for (size_t t = 0; t < threads; ++t) {
+    workers.emplace_back([&push, t, per_thread] {
+      for (size_t i = 0; i < per_thread; ++i) push(t * per_thread + i);
+    });
+  }
+  for (std::thread &worker : workers) worker.join();
+  auto stop = std::chrono::steady_clock::now();
+  double us = std::chrono::duration<double, std::micro>(stop - start).count();
+  return static_cast<double>(per_thread * threads) / us;
+}
+
+int main(int argc, char **argv) {
+  size_t total = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 4 << 20;
+  std::printf("%-8s %16s %20s\n", "threads", "mutex vector",
+              "concurrent_vector");
+  for (size_t threads = 1; threads <= 64; threads *= 2) {
+    s21::vector<uint64_t> locked;
+    std::mutex mutex;
+    double locked_rate = Run(threads, total, [&](uint64_t value) {
+      std::lock_guard<std::mutex> guard(mutex);
+      locked.push_back(value);
+    });
+    s21::concurrent_vector<uint64_t> shared;
+    double shared_rate =
+        Run(threads, total, [&](uint64_t value) { shared.push_back(value); });
+    sink = sink + locked.size() + shared.size();
+    std::printf("%-8zu %16.2f %20.2f\n", threads, locked_rate, shared_rate);
+  }
+  return 0;
+}
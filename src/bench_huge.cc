@@ -0,0 +1,61 @@
+#include <unistd.h>
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+
+#include "s21_huge_vector.h"
+
+// Рост вектора uint64_t через push_back до limit байт: s21::vector с
+// std::allocator (новый буфер и memcpy на каждом росте) против huge_vector
+// (mremap без копирования). Отдельно замеряются только вставки, вызвавшие
+// рост: их суммарное и худшее время. По умолчанию limit = 8 ГиБ, но не
+// больше четверти физической памяти, чтобы старый и новый буферы копирующего
+// варианта поместились вместе. Запуск: ./bench_huge.out [limit в МиБ]
+
+static volatile uint64_t sink = 0;
+
+template <typename Vector>
+static void Bench(const char *name, size_t limit) {
+  size_t n = limit / sizeof(uint64_t);
+  double grow_ns = 0, worst_ns = 0;
+  size_t grows = 0;
+  auto start = std::chrono::steady_clock::now();
+  {
+    Vector data;
+    for (size_t i = 0; i < n; ++i) {
+      if (data.size() == data.capacity()) {
+        auto before = std::chrono::steady_clock::now();
+        data.push_back(i);
+        auto after = std::chrono::steady_clock::now();
+        double ns =
+            std::chrono::duration<double, std::nano>(after - before).count();
+        grow_ns += ns;
+        worst_ns = ns > worst_ns ? ns : worst_ns;
+        ++grows;
+      } else {
+        data.push_back(i);
+      }
+    }
+    sink = sink + data[n / 2];
+  }
+  auto stop = std::chrono::steady_clock::now();
+  double total_ns =
+      std::chrono::duration<double, std::nano>(stop - start).count();
+  std::printf("%-22s %8zu %6zu %10.1f %10.1f %10.2f\n", name, limit >> 20,
+              grows, grow_ns / 1e6, worst_ns / 1e6, total_ns / 1e9);
+}
+
+int main(int argc, char **argv) {
+  size_t limit = size_t(8) << 30;
+  size_t ram = static_cast<size_t>(sysconf(_SC_PHYS_PAGES)) *
+               static_cast<size_t>(sysconf(_SC_PAGESIZE));
+  if (ram / 4 < limit) limit = ram / 4;
+  if (argc > 1) limit = std::strtoull(argv[1], nullptr, 10) << 20;
+  std::printf("%-22s %8s %6s %10s %10s %10s\n", "vector", "MiB", "grows",
+              "grow ms", "worst ms", "total s");
+  Bench<s21::vector<uint64_t>>("vector, copy", limit);
+  Bench<s21::huge_vector<uint64_t>>("huge_vector, mremap", limit);
+  return 0;
+}
@@ -0,0 +1,60 @@
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <list>
+#include <random>
+
+#include "s21_list.h"
+
+// Сортировка списков: s21::list::sort против std::list::sort на случайных,
+// упорядоченных, обратных данных и данных из 16 различных значений.
+// Выводится время одной сортировки в миллисекундах. Запуск:
+// ./bench_list_sort.out [max_nodes], по умолчанию 10^7 (замер идёт на 10^6
+// и 10^7 узлов, не больше max_nodes)
+
+static volatile int sink = 0;
+
+enum Input { kRandom, kSorted, kReversed, kDuplicates };
+static const char *const kInputNames[] = {"random", "sorted", "reversed",
+                                          "duplicates"};
+
+static int Value(Input input, size_t i, size_t n, std::mt19937 &gen) {
+  switch (input) {
+    case kRandom:
+      return static_cast<int>(gen());
+    case kSorted:
+      return static_cast<int>(i);
+    case kReversed:
+      return static_cast<int>(n - i);
+    default:
+      return static_cast<int>(gen() % 16);
+  }
+}
+
+template <typename List>
+static double Run(Input input, size_t n) {
+  std::mt19937 gen(42);
+  List list;
+  for (size_t i = 0; i < n; ++i) list.push_back(Value(input, i, n, gen));
+  auto start = std::chrono::steady_clock::now();
+  list.sort();
+  auto stop = std::chrono::steady_clock::now();
+  sink = sink + list.front();
+  return std::chrono::duration<double, std::milli>(stop - start).count();
+}
+
+int main(int argc, char **argv) {
+  size_t max_nodes =
+      argc > 1 ? std::strtoull(argv[1], nullptr, 10) : size_t(10000000);
+  std::printf("%-10s %9s %12s %12s\n", "input", "nodes", "s21 ms", "std ms");
+  for (size_t n : {size_t(1000000), size_t(10000000)}) {
+    if (n > max_nodes) break;
+    for (Input input : {kRandom, kSorted, kReversed, kDuplicates}) {
+      double s21_ms = Run<s21::list<int>>(input, n);
+      double std_ms = Run<std::list<int>>(input, n);
+      std::printf("%-10s %9zu %12.1f %12.1f\n", kInputNames[input], n,
+                  s21_ms, std_ms);
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,74 @@
+#include <unistd.h>
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+#include "s21_mmap_vector.h"
+
+// Загрузка вектора uint64_t с диска: поэлементное чтение fread в
+// s21::vector через push_back, чтение одним fread в готовый буфер и
+// открытие того же файла как mmap_vector — отдельно само открытие и
+// открытие с проходом по всем элементам (страницы подгружаются при первом
+// обращении). Файл лежит в кэше страниц, так что измеряется цена
+// копирования, а не диска. Запуск: ./bench_mmap.out [МиБ], по умолчанию 256
+
+static volatile uint64_t sink = 0;
+
+template <typename Load>
+static void Bench(const char *name, size_t bytes, Load load) {
+  auto start = std::chrono::steady_clock::now();
+  uint64_t sum = load();
+  auto stop = std::chrono::steady_clock::now();
+  sink = sink + sum;
+  double ms = std::chrono::duration<double, std::milli>(stop - start).count();
+  std::printf("%-26s %8zu %10.3f\n", name, bytes >> 20, ms);
+}
+
+static uint64_t Sum(const uint64_t *data, size_t n) {
+  uint64_t sum = 0;
+  for (size_t i = 0; i < n; ++i) sum += data[i];
+  return sum;
+}
+
+int main(int argc, char **argv) {
+  size_t bytes = (argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 256) << 20;
+  size_t n = bytes / sizeof(uint64_t);
+  std::string path = "bench_mmap_" + std::to_string(getpid()) + ".bin";
+  {
+    s21::mmap_vector<uint64_t> file(path);
+    file.reserve(n);
+    for (size_t i = 0; i < n; ++i) file.push_back(i);
+  }
+  constexpr size_t kOffset = s21::MmapVectorHeader::kDataOffset;
+  std::printf("%-26s %8s %10s\n", "load", "MiB", "ms");
+  Bench("fread per element", bytes, [&] {
+    FILE *in = std::fopen(path.c_str(), "rb");
+    std::fseek(in, kOffset, SEEK_SET);
+    s21::vector<uint64_t> data;
+    uint64_t value;
+    while (std::fread(&value, sizeof(value), 1, in) == 1) data.push_back(value);
+    std::fclose(in);
+    return Sum(data.data(), data.size());
+  });
+  Bench("fread whole buffer", bytes, [&] {
+    FILE *in = std::fopen(path.c_str(), "rb");
+    std::fseek(in, kOffset, SEEK_SET);
+    s21::vector<uint64_t> data(n);
+    size_t got = std::fread(data.data(), sizeof(uint64_t), n, in);
+    std::fclose(in);
+    return Sum(data.data(), got);
+  });
+  Bench("mmap_vector open", bytes, [&] {
+    s21::mmap_vector<uint64_t> data(path);
+    return uint64_t(data.size());
+  });
+  Bench("mmap_vector open + scan", bytes, [&] {
+    s21::mmap_vector<uint64_t> data(path);
+    return Sum(data.data(), data.size());
+  });
+  unlink(path.c_str());
+  return 0;
+}
@@ -0,0 +1,81 @@
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+
+#include "s21_simd.h"
+#include "s21_vector.h"
+
+// Пропускная способность ядер s21_simd.h на s21::vector из 64 Ki и 4 Mi
+// элементов (L2 и память): find и count ищут значение, которого нет, min и
+// max проходят весь массив, equal сравнивает две одинаковые копии. Каждое
+// ядро прогоняется скалярно, на SSE2 и на AVX2 через set_isa. Запуск:
+// ./bench_simd.out [repeat], по умолчанию repeat = 200.
+
+static volatile size_t sink = 0;
+
+static const char *IsaName(s21::simd::Isa isa) {
+  switch (isa) {
+    case s21::simd::Isa::kAvx2:
+      return "avx2";
+    case s21::simd::Isa::kSse2:
+      return "sse2";
+    default:
+      return "scalar";
+  }
+}
+
+template <typename Kernel>
+static void Bench(const char *type, const char *name, size_t bytes,
+                  size_t repeat, Kernel kernel) {
+  for (s21::simd::Isa isa : {s21::simd::Isa::kScalar, s21::simd::Isa::kSse2,
+                             s21::simd::Isa::kAvx2}) {
+    s21::simd::set_isa(isa);
+    if (s21::simd::current_isa() != isa) continue;
+    sink = sink + kernel();
+    auto start = std::chrono::steady_clock::now();
+    for (size_t r = 0; r < repeat; ++r) sink = sink + kernel();
+    auto stop = std::chrono::steady_clock::now();
+    double ns = std::chrono::duration<double, std::nano>(stop - start).count();
+    std::printf("%-8s %-6s %-7s %10zu %10.2f\n", type, name, IsaName(isa),
+                bytes, static_cast<double>(bytes) * repeat / ns);
+  }
+}
+
+template <typename T>
+static void BenchType(const char *type, size_t n, size_t repeat) {
+  s21::vector<T> data(n, T(1));
+  s21::vector<T> copy(data);
+  size_t bytes = n * sizeof(T);
+  Bench(type, "find", bytes, repeat,
+        [&] { return size_t(s21::simd::find(data, T(2)) - data.begin()); });
+  Bench(type, "count", bytes, repeat,
+        [&] { return s21::simd::count(data, T(2)); });
+  Bench(type, "min", bytes, repeat, [&] {
+    return size_t(s21::simd::min_element(data) - data.begin());
+  });
+  Bench(type, "max", bytes, repeat, [&] {
+    return size_t(s21::simd::max_element(data) - data.begin());
+  });
+  Bench(type, "equal", bytes * 2, repeat,
+        [&] { return size_t(s21::simd::equal(data, copy)); });
+  Bench(type, "fill", bytes, repeat, [&] {
+    s21::simd::fill(copy, T(1));
+    return size_t(copy[n / 2]);
+  });
+}
+
+int main(int argc, char **argv) {
+  size_t repeat = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 200;
+  std::printf("%-8s %-6s %-7s %10s %10s\n", "type", "kernel", "isa", "bytes",
+              "GB/s");
+  for (size_t n : {size_t(64) << 10, size_t(4) << 20}) {
+    size_t count = n > (size_t(64) << 10) ? repeat / 20 + 1 : repeat;
+    BenchType<uint8_t>("uint8", n, count);
+    BenchType<int32_t>("int32", n, count);
+    BenchType<float>("float", n, count);
+    BenchType<double>("double", n, count);
+  }
+  s21::simd::set_isa(s21::simd::detected_isa());
+  return 0;
+}
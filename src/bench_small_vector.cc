@@ -0,0 +1,70 @@
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <vector>
+
+#include "s21_containers.h"
+#include "s21_small_vector.h"
+
+// Типичный вектор на запрос: создать, заполнить size элементами, прочитать
+// и уничтожить. Для каждого размера 1..64 печатается число выделений кучи
+// и время на один такой цикл для s21::vector, s21::small_vector<int, 16> и
+// std::vector. Запуск: ./bench_small_vector.out [repeat], по умолчанию
+// repeat = 10^6.
+
+static size_t allocations = 0;
+
+void *operator new(size_t size) {
+  ++allocations;
+  if (void *ptr = std::malloc(size ? size : 1)) return ptr;
+  throw std::bad_alloc();
+}
+
+void *operator new(size_t size, std::align_val_t align) {
+  ++allocations;
+  size_t alignment = static_cast<size_t>(align);
+  if (void *ptr = std::aligned_alloc(
+          alignment, (size + alignment - 1) / alignment * alignment))
+    return ptr;
+  throw std::bad_alloc();
+}
+
+void operator delete(void *ptr) noexcept { std::free(ptr); }
+void operator delete(void *ptr, size_t) noexcept { std::free(ptr); }
+void operator delete(void *ptr, std::align_val_t) noexcept { std::free(ptr); }
+void operator delete(void *ptr, size_t, std::align_val_t) noexcept {
+  std::free(ptr);
+}
+
+static volatile long sink = 0;
+
+template <typename Vector>
+void BenchRequest(const char *name, size_t size, size_t repeat) {
+  size_t before = allocations;
+  auto start = std::chrono::steady_clock::now();
+  for (size_t r = 0; r < repeat; ++r) {
+    Vector vec;
+    for (size_t i = 0; i < size; ++i) vec.push_back(static_cast<int>(i + r));
+    long sum = 0;
+    for (auto it = vec.begin(); it != vec.end(); ++it) sum += *it;
+    sink = sink + sum;
+  }
+  auto stop = std::chrono::steady_clock::now();
+  double ns = std::chrono::duration<double, std::nano>(stop - start).count();
+  std::printf("%-14s %6zu %14.2f %12.1f\n", name, size,
+              static_cast<double>(allocations - before) / repeat,
+              ns / repeat);
+}
+
+int main(int argc, char **argv) {
+  size_t repeat = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1000000;
+  std::printf("%-14s %6s %14s %12s\n", "container", "size", "allocs/iter",
+              "ns/iter");
+  for (size_t size : {1, 2, 4, 8, 16, 32, 64}) {
+    BenchRequest<s21::vector<int>>("s21::vector", size, repeat);
+    BenchRequest<s21::small_vector<int, 16>>("small_vector", size, repeat);
+    BenchRequest<std::vector<int>>("std::vector", size, repeat);
+  }
+  return 0;
+}
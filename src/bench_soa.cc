@@ -0,0 +1,72 @@
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+
+#include "s21_simd.h"
+#include "s21_soa_vector.h"
+
+// Скан одного поля: сумма цен и поиск минимальной цены по 64-байтовым
+// записям. s21::vector<Trade> тянет в кэш всю запись ради 8 байт,
+// soa_vector читает только столбец цен; для него же замеряется
+// simd::min_element по column<0>(). Запуск: ./bench_soa.out [repeat], по
+// умолчанию repeat = 20.
+
+struct Trade {
+  double price;
+  int64_t quantity;
+  int32_t id;
+  char venue[44];
+};
+
+static volatile double sink = 0;
+
+template <typename Kernel>
+static void Bench(const char *name, size_t n, size_t repeat, Kernel kernel) {
+  sink = sink + kernel();
+  auto start = std::chrono::steady_clock::now();
+  for (size_t r = 0; r < repeat; ++r) sink = sink + kernel();
+  auto stop = std::chrono::steady_clock::now();
+  double ns = std::chrono::duration<double, std::nano>(stop - start).count();
+  std::printf("%-28s %9zu %10.3f\n", name, n,
+              ns / (static_cast<double>(n) * repeat));
+}
+
+int main(int argc, char **argv) {
+  size_t repeat = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 20;
+  std::printf("%-28s %9s %10s\n", "layout", "rows", "ns/row");
+  for (size_t n : {size_t(16) << 10, size_t(4) << 20}) {
+    size_t count = n > (size_t(16) << 10) ? repeat : repeat * 256;
+    s21::vector<Trade> aos;
+    s21::soa_vector<double, int64_t, int32_t> soa;
+    aos.reserve(n);
+    soa.reserve(n);
+    for (size_t i = 0; i < n; ++i) {
+      double price = static_cast<double>((i * 7919) % 10007);
+      aos.push_back(Trade{price, int64_t(i), int32_t(i), {}});
+      soa.emplace_back(price, int64_t(i), int32_t(i));
+    }
+    Bench("vector<Trade> sum", n, count, [&] {
+      double sum = 0;
+      for (const Trade &trade : aos) sum += trade.price;
+      return sum;
+    });
+    Bench("soa_vector sum", n, count, [&] {
+      double sum = 0;
+      for (double price : soa.column<0>()) sum += price;
+      return sum;
+    });
+    Bench("vector<Trade> min", n, count, [&] {
+      const Trade *best = aos.data();
+      for (const Trade &trade : aos) {
+        if (trade.price < best->price) best = &trade;
+      }
+      return best->price;
+    });
+    Bench("soa_vector simd::min", n, count, [&] {
+      s21::column_span<double> prices = soa.column<0>();
+      return *s21::simd::min_element(prices);
+    });
+  }
+  return 0;
+}
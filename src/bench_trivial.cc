@@ -0,0 +1,68 @@
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+#include "s21_containers.h"
+#include "s21_containersplus.h"
+
+// Сравнение быстрого пути memcpy/memmove для тривиально копируемых типов с
+// поэлементным путём. SlowInt совпадает с int по размеру, но из-за
+// пользовательского конструктора копирования идёт по старой ветке — это и
+// есть замер "до". Запуск: ./bench_trivial.out [n], по умолчанию n = 10^6.
+
+struct SlowInt {
+  int value_;
+  SlowInt(int value = 0) : value_(value) {}
+  SlowInt(const SlowInt &other) : value_(other.value_) {}
+  SlowInt &operator=(const SlowInt &other) {
+    value_ = other.value_;
+    return *this;
+  }
+};
+
+template <typename F>
+double Measure(F f) {
+  auto start = std::chrono::steady_clock::now();
+  f();
+  auto stop = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::milli>(stop - start).count();
+}
+
+template <typename T>
+void BenchVector(const char *name, size_t n) {
+  s21::vector<T> vec(n);
+  double reserve = Measure([&] { vec.reserve(2 * n); });
+  size_t erased = 1000;
+  double erase_front = Measure([&] {
+    for (size_t i = 0; i < erased; ++i) vec.erase(vec.begin());
+  });
+  double copy = Measure([&] {
+    s21::vector<T> other(vec);
+    if (other.size() != vec.size()) std::abort();
+  });
+  std::printf("%-8s %10zu %12.3f %16.3f %12.3f\n", name, n, reserve,
+              erase_front / erased, copy);
+}
+
+template <typename T>
+void BenchArraySwap(const char *name) {
+  static s21::array<T, 1 << 16> lhs, rhs;
+  size_t repeat = 1000;
+  lhs.swap(rhs);
+  double ms = Measure([&] {
+    for (size_t i = 0; i < repeat; ++i) lhs.swap(rhs);
+  });
+  std::printf("%-8s array<%d>::swap %.3f us\n", name, 1 << 16,
+              ms * 1000 / repeat);
+}
+
+int main(int argc, char **argv) {
+  size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1000000;
+  std::printf("%-8s %10s %12s %16s %12s\n", "type", "n", "reserve, ms",
+              "erase_front, ms", "copy, ms");
+  BenchVector<SlowInt>("SlowInt", n);
+  BenchVector<int>("int", n);
+  BenchArraySwap<SlowInt>("SlowInt");
+  BenchArraySwap<int>("int");
+  return 0;
+}
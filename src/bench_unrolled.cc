@@ -0,0 +1,65 @@
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+
+#include "s21_list.h"
+#include "s21_unrolled_list.h"
+
+// s21::list против unrolled_list на int. Обход: сумма всех элементов
+// сразу после заполнения push_back и после sort() случайных данных — list
+// сортирует перевешиванием, и соседние узлы оказываются в разных местах
+// памяти, у unrolled_list элементы остаются в своих блоках. Вставка (до
+// сортировки): проход итератором со вставкой перед каждым вторым
+// элементом. Выводятся наносекунды на элемент. Запуск:
+// ./bench_unrolled.out [n], по умолчанию 10^6
+
+static volatile long long sink = 0;
+
+template <typename Kernel>
+static double Measure(size_t ops, Kernel kernel) {
+  auto start = std::chrono::steady_clock::now();
+  kernel();
+  auto stop = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::nano>(stop - start).count() /
+         static_cast<double>(ops);
+}
+
+template <typename List>
+static void Run(const char *name, size_t n) {
+  std::mt19937 gen(42);
+  List list;
+  for (size_t i = 0; i < n; ++i) list.push_back(static_cast<int>(gen()));
+  auto sum = [&list] {
+    long long total = 0;
+    for (auto it = list.begin(); it != list.end(); ++it) total += *it;
+    sink = sink + total;
+  };
+  size_t repeat = 10;
+  double fresh = Measure(n * repeat, [&] {
+    for (size_t r = 0; r < repeat; ++r) sum();
+  });
+  double insert = Measure(n / 2, [&] {
+    auto it = list.begin();
+    for (size_t i = 0; i < n / 2; ++i) {
+      ++it;
+      it = list.insert(it, static_cast<int>(i));
+      ++it;
+    }
+  });
+  list.sort();
+  double sorted = Measure(n * repeat, [&] {
+    for (size_t r = 0; r < repeat; ++r) sum();
+  });
+  std::printf("%-14s %9zu %10.2f %10.2f %10.2f\n", name, n, fresh, insert,
+              sorted);
+}
+
+int main(int argc, char **argv) {
+  size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1000000;
+  std::printf("%-14s %9s %10s %10s %10s\n", "container", "n", "walk",
+              "insert", "walk sorted");
+  Run<s21::list<int>>("list", n);
+  Run<s21::unrolled_list<int>>("unrolled_list", n);
+  return 0;
+}
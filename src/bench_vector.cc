@@ -0,0 +1,41 @@
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+#include "s21_containers.h"
+
+// Замер push_back: время на один элемент должно оставаться постоянным при
+// росте n (амортизированное O(1)), а число перевыделений — расти как log(n).
+// Запуск: ./bench_vector.out [max_n], по умолчанию max_n = 10^8.
+
+template <typename Vector>
+void BenchPushBack(const char *name, size_t n) {
+  auto start = std::chrono::steady_clock::now();
+  Vector vec;
+  size_t reallocs = 0;
+  size_t capacity = vec.capacity();
+  for (size_t i = 0; i < n; ++i) {
+    vec.push_back(static_cast<int>(i));
+    if (vec.capacity() != capacity) {
+      capacity = vec.capacity();
+      ++reallocs;
+    }
+  }
+  auto stop = std::chrono::steady_clock::now();
+  double ms = std::chrono::duration<double, std::milli>(stop - start).count();
+  std::printf("%-10s %12zu %12.2f %10.2f %10zu\n", name, n, ms, ms * 1e6 / n,
+              reallocs);
+}
+
+int main(int argc, char **argv) {
+  size_t max_n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 100000000;
+  std::printf("%-10s %12s %12s %10s %10s\n", "growth", "n", "total, ms",
+              "ns/elem", "reallocs");
+  for (size_t n = 10000; n <= max_n; n *= 10) {
+    BenchPushBack<s21::vector<int>>("x2", n);
+    BenchPushBack<
+        s21::vector<int, std::allocator<int>, s21::GeometricGrowth<3, 2>>>(
+        "x1.5", n);
+  }
+  return 0;
+}
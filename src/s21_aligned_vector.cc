@@ -0,0 +1,39 @@
+#ifndef SRC_S21_ALIGNED_VECTOR_CC_
+#define SRC_S21_ALIGNED_VECTOR_CC_
+
+#include "s21_aligned_vector.h"
+
+namespace s21 {
+
+template <typename T, size_t Align>
+template <typename U>
+aligned_allocator<T, Align>::aligned_allocator(
+    const aligned_allocator<U, Align> &) noexcept {}
+
+template <typename T, size_t Align>
+T *aligned_allocator<T, Align>::allocate(size_t n) {
+  if (n > std::numeric_limits<size_t>::max() / sizeof(T)) {
+    throw std::bad_array_new_length();
+  }
+  return static_cast<T *>(
+      ::operator new(n * sizeof(T), std::align_val_t{Align}));
+}
+
+template <typename T, size_t Align>
+void aligned_allocator<T, Align>::deallocate(T *ptr, size_t n) {
+  ::operator delete(ptr, n * sizeof(T), std::align_val_t{Align});
+}
+
+template <typename T, typename U, size_t Align>
+bool operator==(const aligned_allocator<T, Align> &,
+                const aligned_allocator<U, Align> &) {
+  return true;
+}
+
+template <typename T, typename U, size_t Align>
+bool operator!=(const aligned_allocator<T, Align> &,
+                const aligned_allocator<U, Align> &) {
+  return false;
+}
+}  // namespace s21
+#endif  // SRC_S21_ALIGNED_VECTOR_CC_
@@ -0,0 +1,47 @@
+#ifndef SRC_S21_ALIGNED_VECTOR_H_
+#define SRC_S21_ALIGNED_VECTOR_H_
+
+#include "s21_vector.h"
+
+namespace s21 {
+
+// Аллокатор, выравнивающий каждый буфер по Align байт. Без состояния, все
+// экземпляры с одинаковым Align равны
+template <typename T, size_t Align>
+class aligned_allocator {
+  static_assert((Align & (Align - 1)) == 0, "alignment must be a power of 2");
+  static_assert(Align >= alignof(T), "alignment is weaker than alignof(T)");
+
+ public:
+  typedef T value_type;
+  typedef std::true_type is_always_equal;
+  typedef std::true_type propagate_on_container_move_assignment;
+  // rebind по умолчанию не умеет нетиповые параметры шаблона
+  template <typename U>
+  struct rebind {
+    typedef aligned_allocator<U, Align> other;
+  };
+
+  aligned_allocator() noexcept = default;
+  template <typename U>
+  aligned_allocator(const aligned_allocator<U, Align> &) noexcept;
+
+  T *allocate(size_t n);
+  void deallocate(T *ptr, size_t n);
+};
+
+template <typename T, typename U, size_t Align>
+bool operator==(const aligned_allocator<T, Align> &,
+                const aligned_allocator<U, Align> &);
+template <typename T, typename U, size_t Align>
+bool operator!=(const aligned_allocator<T, Align> &,
+                const aligned_allocator<U, Align> &);
+
+// vector, у которого data() выровнен по Align байт при любом буфере: после
+// роста, reserve, shrink_to_fit и копирования. Align = 32 — под AVX2,
+// 64 — под AVX-512 и размер строки кэша
+template <typename T, size_t Align = 64, typename Growth = GeometricGrowth<>>
+using aligned_vector = vector<T, aligned_allocator<T, Align>, Growth>;
+}  // namespace s21
+#include "s21_aligned_vector.cc"
+#endif  // SRC_S21_ALIGNED_VECTOR_H_
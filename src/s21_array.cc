@@ -30,13 +30,18 @@ array<value_type, size_>::array(
 template <class value_type, size_t size_>
 array<value_type, size_>::array(const array &a) {
   if (this != &a) {
-    for (size_type i = 0; i < size_; ++i) *(head_ + i) = *(a.head_ + i);
+    if constexpr (std::is_trivially_copyable_v<value_type>) {
+      std::memcpy(head_, a.head_, sizeof(head_));
+    } else {
+      for (size_type i = 0; i < size_; ++i) *(head_ + i) = *(a.head_ + i);
+    }
   }
 }
 
 /* конструктор перемещения *************************/
 template <class value_type, size_t size_>
-array<value_type, size_>::array(array &&a) {
+array<value_type, size_>::array(array &&a) noexcept(
+    std::is_nothrow_move_assignable_v<value_type>) {
   if (this != &a) {
     std::move(std::begin(a.head_), std::end(a.head_), &head_[0]);
   }
@@ -46,10 +51,26 @@ array<value_type, size_>::array(array &&a) {
 template <class value_type, size_t size_>
 array<value_type, size_>::~array() {}
 
+// копирующее присваивание; элементы хранятся внутри объекта, поэтому
+// копируются поэлементно (memcpy для тривиально копируемых типов)
+template <class value_type, size_t size_>
+array<value_type, size_> &array<value_type, size_>::operator=(const array &a) {
+  if (this != &a) {
+    if constexpr (std::is_trivially_copyable_v<value_type>) {
+      std::memcpy(head_, a.head_, sizeof(head_));
+    } else {
+      for (size_type i = 0; i < size_; ++i) *(head_ + i) = *(a.head_ + i);
+    }
+  }
+  return *this;
+}
+
 //Перегрузка оператора присваивания для движущегося объекта
 template <class value_type, size_t size_>
-void array<value_type, size_>::operator=(array &&a) {
-  array(std::move(a));
+array<value_type, size_> &array<value_type, size_>::operator=(
+    array &&a) noexcept(std::is_nothrow_move_assignable_v<value_type>) {
+  if (this != &a) std::move(std::begin(a.head_), std::end(a.head_), head_);
+  return *this;
 }
 
 /*В этой таблице перечислены публичные методы для доступа к элементам класса:
@@ -131,29 +152,37 @@ array<value_type, size_>::max_size() {
 /*В этой таблице перечислены публичные методы для изменения контейнера:
  * **************************************************/
 
-//меняет содержимое
-template <class value_type, size_t size_>
-void array<value_type, size_>::swap(array &other) {
-  if (this != &other && size_ == other.size())
+//меняет содержимое; тривиально копируемые элементы обмениваются блоками
+//через буфер на стеке
+template <class value_type, size_t size_>
+void array<value_type, size_>::swap(array &other) noexcept(
+    std::is_nothrow_swappable_v<value_type>) {
+  if (this == &other || size_ != other.size()) return;
+  if constexpr (std::is_trivially_copyable_v<value_type>) {
+    unsigned char buf[std::min<size_t>(4096, sizeof(head_))];
+    unsigned char *lhs = reinterpret_cast<unsigned char *>(head_);
+    unsigned char *rhs = reinterpret_cast<unsigned char *>(other.head_);
+    for (size_type done = 0, bytes = size_ * sizeof(value_type);
+         done < bytes; done += sizeof(buf)) {
+      size_type chunk = std::min(sizeof(buf), bytes - done);
+      std::memcpy(buf, lhs + done, chunk);
+      std::memcpy(lhs + done, rhs + done, chunk);
+      std::memcpy(rhs + done, buf, chunk);
+    }
+  } else {
     for (size_type i = 0; i < size_; ++i) std::swap(head_[i], other.head_[i]);
+  }
 }
 
 //присваивает заданное значение value всем элементам в контейнере.
+//арифметические типы заполняются векторными ядрами s21_simd.h
 template <class value_type, size_t size_>
 void array<value_type, size_>::fill(const_reference value) {
-  for (size_type i = 0; i < size_; ++i) *(head_ + i) = value;
-}
-
-int main() {
-  using namespace std;
-  // s21::array<int, 10>
-  int my_array[4];
-  for (int i = 0; i <= 4; i++) {
-    std::cout << "my_array[" << i << "]= " << my_array[i] << "\n";
+  if constexpr (simd::kVectorizable<value_type>) {
+    simd::fill(head_, head_ + size_, value);
+  } else {
+    for (size_type i = 0; i < size_; ++i) *(head_ + i) = value;
   }
-
-  system("pause");
-  return 0;
 }
 
 template <class value_type, size_t size_>
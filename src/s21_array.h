@@ -1,9 +1,14 @@
 #ifndef SRC_S21_ARRAY_HH_
 #define SRC_S21_ARRAY_HH_
 
+#include <algorithm>
+#include <cstring>
 #include <initializer_list>
 #include <iostream>
 #include <limits>
+#include <type_traits>
+
+#include "s21_simd.h"
 
 namespace s21 {
 
@@ -33,10 +38,13 @@ class array {
             &items);  // конструктор списка инициализаторов, создает массив,
   // инициализированный с помощью std::initializer_list<T>
   array(const array &a);  // конструктор копирования
-  array(array &&a);       // конструктор перемещения
+  // конструктор перемещения
+  array(array &&a) noexcept(std::is_nothrow_move_assignable_v<value_type>);
   ~array();               //мусоросжигательная печь
-  void operator=(
-      array &&a);  //Перегрузка оператора присваивания для движущегося объекта
+  array &operator=(const array &a);  // копирующее присваивание
+  //Перегрузка оператора присваивания для движущегося объекта
+  array &operator=(array &&a) noexcept(
+      std::is_nothrow_move_assignable_v<value_type>);
 
   // В этой таблице перечислены публичные методы для доступа к элементам класса:
   reference at(
@@ -58,7 +66,8 @@ class array {
   size_type max_size();  //возвращает максимально возможное количество элементов
 
   //В этой таблице перечислены публичные методы для изменения контейнера:
-  void swap(array &other);  //меняет содержимое
+  //меняет содержимое
+  void swap(array &other) noexcept(std::is_nothrow_swappable_v<value_type>);
   void fill(const_reference value);  //присваивает заданное значение value всем
                                      //элементам в контейнере.
 
@@ -0,0 +1,509 @@
+#ifndef SRC_S21_CONCURRENT_VECTOR_CC_
+#define SRC_S21_CONCURRENT_VECTOR_CC_
+
+#include "s21_concurrent_vector.h"
+
+namespace s21 {
+/* SegmentIterator ***********************************************/
+
+template <typename Vector, typename Item>
+SegmentIterator<Vector, Item>::SegmentIterator()
+    : owner_{nullptr}, index_{0} {}
+
+template <typename Vector, typename Item>
+SegmentIterator<Vector, Item>::SegmentIterator(Vector *owner, size_t index)
+    : owner_{owner}, index_{index} {}
+
+template <typename Vector, typename Item>
+template <typename OtherVector, typename Other, typename>
+SegmentIterator<Vector, Item>::SegmentIterator(
+    const SegmentIterator<OtherVector, Other> &other)
+    : owner_{other.owner_}, index_{other.index_} {}
+
+template <typename Vector, typename Item>
+typename SegmentIterator<Vector, Item>::reference
+SegmentIterator<Vector, Item>::operator*() const {
+  return (*owner_)[index_];
+}
+
+template <typename Vector, typename Item>
+typename SegmentIterator<Vector, Item>::pointer
+SegmentIterator<Vector, Item>::operator->() const {
+  return &(*owner_)[index_];
+}
+
+template <typename Vector, typename Item>
+SegmentIterator<Vector, Item> &SegmentIterator<Vector, Item>::operator++() {
+  index_ = owner_->NextValid(index_ + 1, owner_->size());
+  return *this;
+}
+
+template <typename Vector, typename Item>
+SegmentIterator<Vector, Item> SegmentIterator<Vector, Item>::operator++(int) {
+  SegmentIterator tmp(*this);
+  ++*this;
+  return tmp;
+}
+
+template <typename Vector, typename Item>
+SegmentIterator<Vector, Item> &SegmentIterator<Vector, Item>::operator--() {
+  index_ = owner_->PrevValid(index_);
+  return *this;
+}
+
+template <typename Vector, typename Item>
+SegmentIterator<Vector, Item> SegmentIterator<Vector, Item>::operator--(int) {
+  SegmentIterator tmp(*this);
+  --*this;
+  return tmp;
+}
+
+template <typename Vector, typename Item>
+bool SegmentIterator<Vector, Item>::operator==(
+    const SegmentIterator &other) const {
+  return index_ == other.index_;
+}
+
+template <typename Vector, typename Item>
+bool SegmentIterator<Vector, Item>::operator!=(
+    const SegmentIterator &other) const {
+  return index_ != other.index_;
+}
+
+/* Сегменты *******************************************************/
+
+// сегмент s занимает номера [B * (2^s - 1), B * (2^(s+1) - 1)), где
+// B = kFirstSegment, поэтому номер сегмента — старший бит index + B
+template <typename T, typename Allocator>
+typename concurrent_vector<T, Allocator>::size_type
+concurrent_vector<T, Allocator>::SegmentOf(size_type index) {
+  return 63 - __builtin_clzll(index + kFirstSegment) - kFirstBits;
+}
+
+template <typename T, typename Allocator>
+typename concurrent_vector<T, Allocator>::size_type
+concurrent_vector<T, Allocator>::SegmentBase(size_type segment) {
+  return (kFirstSegment << segment) - kFirstSegment;
+}
+
+template <typename T, typename Allocator>
+typename concurrent_vector<T, Allocator>::size_type
+concurrent_vector<T, Allocator>::SegmentSize(size_type segment) {
+  return kFirstSegment << segment;
+}
+
+// сегмент выделяется одним блоком: места элементов, за ними флаги мест,
+// округлённые вверх до целого числа элементов
+template <typename T, typename Allocator>
+typename concurrent_vector<T, Allocator>::size_type
+concurrent_vector<T, Allocator>::SegmentUnits(size_type segment) {
+  size_type slots = SegmentSize(segment);
+  return slots + (slots * sizeof(SlotState) + sizeof(value_type) - 1) /
+                     sizeof(value_type);
+}
+
+template <typename T, typename Allocator>
+typename concurrent_vector<T, Allocator>::SlotState *
+concurrent_vector<T, Allocator>::States(value_type *head, size_type segment) {
+  return reinterpret_cast<SlotState *>(head + SegmentSize(segment));
+}
+
+// метка в таблице сегментов вместо сегмента, под который не хватило
+// памяти; по ней ничего не читается
+template <typename T, typename Allocator>
+typename concurrent_vector<T, Allocator>::value_type *
+concurrent_vector<T, Allocator>::BrokenSegment() {
+  alignas(value_type) static unsigned char marker;
+  return reinterpret_cast<value_type *>(&marker);
+}
+
+// выделяет сегмент при первом обращении; из двух одновременно выделенных
+// буферов CAS оставляет один. Если памяти нет, CAS ставит метку, и только
+// выделенный другим потоком сегмент её опережает
+template <typename T, typename Allocator>
+typename concurrent_vector<T, Allocator>::value_type *
+concurrent_vector<T, Allocator>::Segment(size_type segment) {
+  value_type *head = segments_[segment].load(std::memory_order_acquire);
+  if (!head) {
+    value_type *fresh;
+    try {
+      fresh = AllocTraits::allocate(alloc_, SegmentUnits(segment));
+      std::uninitialized_value_construct_n(States(fresh, segment),
+                                           SegmentSize(segment));
+    } catch (...) {
+      fresh = BrokenSegment();
+    }
+    if (segments_[segment].compare_exchange_strong(
+            head, fresh, std::memory_order_acq_rel)) {
+      head = fresh;
+    } else if (fresh != BrokenSegment()) {
+      AllocTraits::deallocate(alloc_, fresh, SegmentUnits(segment));
+    }
+  }
+  if (head == BrokenSegment()) throw std::bad_alloc();
+  return head;
+}
+
+template <typename T, typename Allocator>
+typename concurrent_vector<T, Allocator>::value_type *
+concurrent_vector<T, Allocator>::Slot(size_type index) const {
+  size_type segment = SegmentOf(index);
+  return segments_[segment].load(std::memory_order_acquire) + index -
+         SegmentBase(segment);
+}
+
+// первое место с элементом в [index, end), иначе end. Невыделенные и
+// сломанные сегменты пропускаются целиком
+template <typename T, typename Allocator>
+typename concurrent_vector<T, Allocator>::size_type
+concurrent_vector<T, Allocator>::NextValid(size_type index,
+                                           size_type end) const {
+  while (index < end) {
+    size_type segment = SegmentOf(index);
+    size_type next = SegmentBase(segment + 1);
+    value_type *head = segments_[segment].load(std::memory_order_acquire);
+    if (head && head != BrokenSegment()) {
+      SlotState *states = States(head, segment);
+      for (; index < end && index < next; ++index) {
+        if (states[index - SegmentBase(segment)].load(
+                std::memory_order_acquire)) {
+          return index;
+        }
+      }
+    }
+    index = next;
+  }
+  return end;
+}
+
+// последнее место с элементом перед index
+template <typename T, typename Allocator>
+typename concurrent_vector<T, Allocator>::size_type
+concurrent_vector<T, Allocator>::PrevValid(size_type index) const {
+  while (index > 0) {
+    size_type segment = SegmentOf(index - 1);
+    size_type base = SegmentBase(segment);
+    value_type *head = segments_[segment].load(std::memory_order_acquire);
+    if (head && head != BrokenSegment()) {
+      SlotState *states = States(head, segment);
+      for (; index > base; --index) {
+        if (states[index - 1 - base].load(std::memory_order_acquire)) {
+          return index - 1;
+        }
+      }
+    }
+    index = base;
+  }
+  return 0;
+}
+
+template <typename T, typename Allocator>
+void concurrent_vector<T, Allocator>::SwapStorage(
+    concurrent_vector &other) noexcept {
+  constexpr std::memory_order kRelaxed = std::memory_order_relaxed;
+  size_type size = size_.load(kRelaxed);
+  size_.store(other.size_.load(kRelaxed), kRelaxed);
+  other.size_.store(size, kRelaxed);
+  for (size_type segment = 0; segment < kSegments; ++segment) {
+    value_type *head = segments_[segment].load(kRelaxed);
+    segments_[segment].store(other.segments_[segment].load(kRelaxed),
+                             kRelaxed);
+    other.segments_[segment].store(head, kRelaxed);
+  }
+}
+
+// уничтожает элементы и освобождает все сегменты, в том числе из reserve
+template <typename T, typename Allocator>
+void concurrent_vector<T, Allocator>::DestroyAll() noexcept {
+  clear();
+  for (size_type segment = 0; segment < kSegments; ++segment) {
+    value_type *head = segments_[segment].load(std::memory_order_relaxed);
+    if (head && head != BrokenSegment()) {
+      AllocTraits::deallocate(alloc_, head, SegmentUnits(segment));
+    }
+    segments_[segment].store(nullptr, std::memory_order_relaxed);
+  }
+}
+
+/* Конструкторы ***************************************************/
+
+template <typename T, typename Allocator>
+concurrent_vector<T, Allocator>::concurrent_vector()
+    : concurrent_vector(Allocator()) {}
+
+template <typename T, typename Allocator>
+concurrent_vector<T, Allocator>::concurrent_vector(const Allocator &alloc)
+    : size_{0}, alloc_{alloc} {
+  for (std::atomic<value_type *> &segment : segments_) {
+    segment.store(nullptr, std::memory_order_relaxed);
+  }
+}
+
+template <typename T, typename Allocator>
+concurrent_vector<T, Allocator>::concurrent_vector(
+    std::initializer_list<value_type> const &items, const Allocator &alloc)
+    : concurrent_vector(alloc) {
+  reserve(items.size());
+  for (const value_type &item : items) push_back(item);
+}
+
+template <typename T, typename Allocator>
+concurrent_vector<T, Allocator>::concurrent_vector(const concurrent_vector &v)
+    : concurrent_vector(
+          v, AllocTraits::select_on_container_copy_construction(v.alloc_)) {}
+
+// после делегирования объект уже построен: при исключении всё созданное
+// уберёт деструктор. Пустые места v в копию не попадают
+template <typename T, typename Allocator>
+concurrent_vector<T, Allocator>::concurrent_vector(const concurrent_vector &v,
+                                                   const Allocator &alloc)
+    : concurrent_vector(alloc) {
+  reserve(v.size());
+  for (const value_type &item : v) push_back(item);
+}
+
+template <typename T, typename Allocator>
+concurrent_vector<T, Allocator>::concurrent_vector(
+    concurrent_vector &&v) noexcept
+    : concurrent_vector(std::move(v.alloc_)) {
+  SwapStorage(v);
+}
+
+template <typename T, typename Allocator>
+concurrent_vector<T, Allocator>::~concurrent_vector() {
+  DestroyAll();
+}
+
+// копия строится на том аллокаторе, который останется после присваивания
+template <typename T, typename Allocator>
+concurrent_vector<T, Allocator> &concurrent_vector<T, Allocator>::operator=(
+    const concurrent_vector &v) {
+  if (this != &v) {
+    if constexpr (AllocTraits::propagate_on_container_copy_assignment::value) {
+      concurrent_vector copy(v, v.alloc_);
+      SwapStorage(copy);
+      std::swap(alloc_, copy.alloc_);
+    } else {
+      concurrent_vector copy(v, alloc_);
+      SwapStorage(copy);
+    }
+  }
+  return *this;
+}
+
+// сегменты v забираются целиком, если аллокатор переезжает или равен
+// аллокатору v, иначе элементы перемещаются по одному в свои сегменты
+template <typename T, typename Allocator>
+concurrent_vector<T, Allocator> &concurrent_vector<T, Allocator>::operator=(
+    concurrent_vector &&v) noexcept(kMoveAssignSteals) {
+  if (this != &v) {
+    if constexpr (AllocTraits::propagate_on_container_move_assignment::value) {
+      DestroyAll();
+      SwapStorage(v);
+      alloc_ = std::move(v.alloc_);
+    } else if (kMoveAssignSteals || alloc_ == v.alloc_) {
+      DestroyAll();
+      SwapStorage(v);
+    } else {
+      concurrent_vector tmp(alloc_);
+      tmp.reserve(v.size());
+      for (value_type &item : v) tmp.push_back(std::move(item));
+      SwapStorage(tmp);
+      v.clear();
+    }
+  }
+  return *this;
+}
+
+template <typename T, typename Allocator>
+typename concurrent_vector<T, Allocator>::allocator_type
+concurrent_vector<T, Allocator>::get_allocator() const {
+  return alloc_;
+}
+
+/* Доступ к элементам *********************************************/
+
+template <typename T, typename Allocator>
+typename concurrent_vector<T, Allocator>::reference
+concurrent_vector<T, Allocator>::at(size_type pos) {
+  if (valid(pos)) return operator[](pos);
+  throw std::out_of_range("Out of range");
+}
+
+template <typename T, typename Allocator>
+typename concurrent_vector<T, Allocator>::const_reference
+concurrent_vector<T, Allocator>::at(size_type pos) const {
+  if (valid(pos)) return operator[](pos);
+  throw std::out_of_range("Out of range");
+}
+
+template <typename T, typename Allocator>
+typename concurrent_vector<T, Allocator>::reference
+concurrent_vector<T, Allocator>::operator[](size_type pos) {
+  return *Slot(pos);
+}
+
+template <typename T, typename Allocator>
+typename concurrent_vector<T, Allocator>::const_reference
+concurrent_vector<T, Allocator>::operator[](size_type pos) const {
+  return *Slot(pos);
+}
+
+template <typename T, typename Allocator>
+typename concurrent_vector<T, Allocator>::reference
+concurrent_vector<T, Allocator>::front() {
+  return *Slot(0);
+}
+
+template <typename T, typename Allocator>
+typename concurrent_vector<T, Allocator>::reference
+concurrent_vector<T, Allocator>::back() {
+  return *Slot(size() - 1);
+}
+
+template <typename T, typename Allocator>
+bool concurrent_vector<T, Allocator>::valid(size_type pos) const {
+  return pos < size() && NextValid(pos, pos + 1) == pos;
+}
+
+/* Итераторы ******************************************************/
+
+template <typename T, typename Allocator>
+typename concurrent_vector<T, Allocator>::iterator
+concurrent_vector<T, Allocator>::begin() {
+  return iterator(this, NextValid(0, size()));
+}
+
+template <typename T, typename Allocator>
+typename concurrent_vector<T, Allocator>::iterator
+concurrent_vector<T, Allocator>::end() {
+  return iterator(this, size());
+}
+
+template <typename T, typename Allocator>
+typename concurrent_vector<T, Allocator>::const_iterator
+concurrent_vector<T, Allocator>::begin() const {
+  return const_iterator(this, NextValid(0, size()));
+}
+
+template <typename T, typename Allocator>
+typename concurrent_vector<T, Allocator>::const_iterator
+concurrent_vector<T, Allocator>::end() const {
+  return const_iterator(this, size());
+}
+
+template <typename T, typename Allocator>
+typename concurrent_vector<T, Allocator>::const_iterator
+concurrent_vector<T, Allocator>::cbegin() const {
+  return begin();
+}
+
+template <typename T, typename Allocator>
+typename concurrent_vector<T, Allocator>::const_iterator
+concurrent_vector<T, Allocator>::cend() const {
+  return end();
+}
+
+/* Ёмкость ********************************************************/
+
+template <typename T, typename Allocator>
+bool concurrent_vector<T, Allocator>::empty() const {
+  return size() == 0;
+}
+
+template <typename T, typename Allocator>
+typename concurrent_vector<T, Allocator>::size_type
+concurrent_vector<T, Allocator>::size() const {
+  return size_.load(std::memory_order_acquire);
+}
+
+template <typename T, typename Allocator>
+typename concurrent_vector<T, Allocator>::size_type
+concurrent_vector<T, Allocator>::max_size() const {
+  return std::numeric_limits<int64_t>::max() / sizeof(value_type);
+}
+
+template <typename T, typename Allocator>
+void concurrent_vector<T, Allocator>::reserve(size_type size) {
+  if (size > max_size()) throw std::length_error("size > max_size()");
+  for (size_type segment = 0; SegmentBase(segment) < size; ++segment) {
+    Segment(segment);
+  }
+}
+
+// число мест в непрерывно выделенных сегментах с начала
+template <typename T, typename Allocator>
+typename concurrent_vector<T, Allocator>::size_type
+concurrent_vector<T, Allocator>::capacity() const {
+  size_type segment = 0;
+  while (segment < kSegments) {
+    value_type *head = segments_[segment].load(std::memory_order_acquire);
+    if (!head || head == BrokenSegment()) break;
+    ++segment;
+  }
+  return SegmentBase(segment);
+}
+
+/* Изменение ******************************************************/
+
+// сегменты остаются выделенными, адреса мест не меняются; построенные
+// элементы уничтожаются, флаги мест сбрасываются, сломанные сегменты
+// снова можно выделить
+template <typename T, typename Allocator>
+void concurrent_vector<T, Allocator>::clear() {
+  size_type count = size_.load(std::memory_order_relaxed);
+  for (size_type segment = 0; segment < kSegments; ++segment) {
+    value_type *head = segments_[segment].load(std::memory_order_relaxed);
+    if (head == BrokenSegment()) {
+      segments_[segment].store(nullptr, std::memory_order_relaxed);
+      continue;
+    }
+    if (!head || SegmentBase(segment) >= count) continue;
+    SlotState *states = States(head, segment);
+    size_type used = std::min(SegmentSize(segment),
+                              count - SegmentBase(segment));
+    for (size_type i = 0; i < used; ++i) {
+      if (states[i].load(std::memory_order_relaxed)) {
+        AllocTraits::destroy(alloc_, head + i);
+        states[i].store(0, std::memory_order_relaxed);
+      }
+    }
+  }
+  size_.store(0, std::memory_order_relaxed);
+}
+
+template <typename T, typename Allocator>
+void concurrent_vector<T, Allocator>::push_back(const_reference value) {
+  emplace_back(value);
+}
+
+template <typename T, typename Allocator>
+void concurrent_vector<T, Allocator>::push_back(value_type &&value) {
+  emplace_back(std::move(value));
+}
+
+template <typename T, typename Allocator>
+void concurrent_vector<T, Allocator>::swap(concurrent_vector &other) noexcept {
+  SwapStorage(other);
+  if constexpr (AllocTraits::propagate_on_container_swap::value) {
+    std::swap(alloc_, other.alloc_);
+  }
+}
+
+// место занимается раньше, чем строится элемент. Флаг места ставится
+// только после конструктора, так что при исключении место остаётся
+// пустым и его пропускают итераторы, clear и деструктор
+template <typename T, typename Allocator>
+template <typename... Args>
+typename concurrent_vector<T, Allocator>::reference
+concurrent_vector<T, Allocator>::emplace_back(Args &&...args) {
+  size_type index = size_.fetch_add(1, std::memory_order_relaxed);
+  size_type segment = SegmentOf(index);
+  value_type *head = Segment(segment);
+  size_type offset = index - SegmentBase(segment);
+  AllocTraits::construct(alloc_, head + offset, std::forward<Args>(args)...);
+  States(head, segment)[offset].store(1, std::memory_order_release);
+  return head[offset];
+}
+}  // namespace s21
+#endif  // SRC_S21_CONCURRENT_VECTOR_CC_
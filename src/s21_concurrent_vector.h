@@ -0,0 +1,177 @@
+#ifndef SRC_S21_CONCURRENT_VECTOR_H_
+#define SRC_S21_CONCURRENT_VECTOR_H_
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace s21 {
+
+// Двунаправленный итератор по concurrent_vector: номер места и указатель
+// на вектор, разыменование ищет сегмент. Шаг пропускает места без
+// элементов: сломанные сегменты и места, где конструктор бросил или
+// элемент ещё строится. Vector — вектор для iterator и const-вектор для
+// const_iterator
+template <typename Vector, typename Item>
+class SegmentIterator {
+ public:
+  typedef std::bidirectional_iterator_tag iterator_category;
+  typedef std::remove_const_t<Item> value_type;
+  typedef std::ptrdiff_t difference_type;
+  typedef Item *pointer;
+  typedef Item &reference;
+
+  SegmentIterator();
+  SegmentIterator(Vector *owner, size_t index);
+  template <typename OtherVector, typename Other,
+            typename = std::enable_if_t<
+                std::is_convertible_v<OtherVector *, Vector *>>>
+  SegmentIterator(const SegmentIterator<OtherVector, Other> &other);
+
+  reference operator*() const;
+  pointer operator->() const;
+  SegmentIterator &operator++();
+  SegmentIterator operator++(int);
+  SegmentIterator &operator--();
+  SegmentIterator operator--(int);
+  bool operator==(const SegmentIterator &other) const;
+  bool operator!=(const SegmentIterator &other) const;
+
+ private:
+  template <typename OtherVector, typename Other>
+  friend class SegmentIterator;
+
+  Vector *owner_;
+  size_t index_;
+};
+
+// Вектор только для дописывания из многих потоков сразу. Элементы лежат в
+// сегментах, каждый следующий вдвое больше предыдущего (kFirstSegment,
+// 2 * kFirstSegment, 4 * kFirstSegment, ...), таблица сегментов фиксирована,
+// так что элементы никогда не переносятся: указатели и ссылки на них живут
+// до clear() или уничтожения вектора. Сегменты выделяет Allocator, его
+// allocate и construct вызываются из нескольких потоков сразу.
+//
+// push_back и emplace_back свободны от блокировок: место берётся атомарным
+// fetch_add на счётчике, сегмент выделяется при первом обращении, и если
+// два потока выделили его одновременно, CAS оставляет один буфер, второй
+// освобождается. reserve, operator[], at, size и итераторы безопасны
+// параллельно с ними. Как и в TBB, size() считает занятые места: элемент
+// может ещё строиться, поэтому другой поток читает его через operator[],
+// только узнав о нём от вставившего потока (join, мьютекс,
+// release/acquire). clear, swap, присваивание и деструктор требуют, чтобы
+// других потоков не было.
+//
+// У каждого места есть флаг «элемент построен», он ставится после
+// конструктора. Если конструктор бросил, место остаётся пустым; если не
+// хватило памяти под сегмент, он, как в TBB, помечается сломанным, и
+// вставка в него бросает std::bad_alloc. Пустые места входят в size(), но
+// элементов не содержат: valid(pos) их отличает, at бросает
+// std::out_of_range, итераторы их пропускают, а operator[] на них не
+// определён. clear() снимает пометку со сломанных сегментов
+template <typename T, typename Allocator = std::allocator<T>>
+class concurrent_vector {
+ public:
+  typedef T value_type;
+  typedef Allocator allocator_type;
+  typedef T &reference;
+  typedef const T &const_reference;
+  typedef size_t size_type;
+  typedef std::ptrdiff_t difference_type;
+  typedef SegmentIterator<concurrent_vector, T> iterator;
+  typedef SegmentIterator<const concurrent_vector, const T> const_iterator;
+
+  static constexpr size_type kFirstBits = 6;
+  static constexpr size_type kFirstSegment = size_type(1) << kFirstBits;
+
+ private:
+  template <typename Vector, typename Item>
+  friend class SegmentIterator;
+
+  typedef std::allocator_traits<allocator_type> AllocTraits;
+  static_assert(std::is_same_v<typename AllocTraits::value_type, value_type>,
+                "Allocator::value_type must be T");
+  // флаг места: 1 — элемент построен
+  typedef std::atomic<unsigned char> SlotState;
+  static constexpr size_type kSegments = 64 - kFirstBits;
+  static constexpr bool kMoveAssignSteals =
+      AllocTraits::propagate_on_container_move_assignment::value ||
+      AllocTraits::is_always_equal::value;
+
+  // счётчик в своей строке кэша, чтобы fetch_add не задевал таблицу
+  alignas(64) std::atomic<size_type> size_;
+  alignas(64) std::atomic<value_type *> segments_[kSegments];
+  allocator_type alloc_;
+
+  static size_type SegmentOf(size_type index);
+  static size_type SegmentBase(size_type segment);
+  static size_type SegmentSize(size_type segment);
+  static size_type SegmentUnits(size_type segment);
+  static SlotState *States(value_type *head, size_type segment);
+  static value_type *BrokenSegment();
+  value_type *Segment(size_type segment);
+  value_type *Slot(size_type index) const;
+  size_type NextValid(size_type index, size_type end) const;
+  size_type PrevValid(size_type index) const;
+  void SwapStorage(concurrent_vector &other) noexcept;
+  void DestroyAll() noexcept;
+
+ public:
+  concurrent_vector();
+  explicit concurrent_vector(const Allocator &alloc);
+  concurrent_vector(std::initializer_list<value_type> const &items,
+                    const Allocator &alloc = Allocator());
+  concurrent_vector(const concurrent_vector &v);
+  concurrent_vector(const concurrent_vector &v, const Allocator &alloc);
+  concurrent_vector(concurrent_vector &&v) noexcept;
+  ~concurrent_vector();
+  concurrent_vector &operator=(const concurrent_vector &v);
+  concurrent_vector &operator=(concurrent_vector &&v) noexcept(
+      kMoveAssignSteals);
+
+  allocator_type get_allocator() const;
+
+  reference at(size_type pos);
+  const_reference at(size_type pos) const;
+  reference operator[](size_type pos);
+  const_reference operator[](size_type pos) const;
+  reference front();
+  reference back();
+  // место pos < size() содержит построенный элемент
+  bool valid(size_type pos) const;
+
+  iterator begin();
+  iterator end();
+  const_iterator begin() const;
+  const_iterator end() const;
+
+  const_iterator cbegin() const;
+  const_iterator cend() const;
+
+  bool empty() const;
+  size_type size() const;
+  size_type max_size() const;
+  // выделяет сегменты под size элементов заранее
+  void reserve(size_type size);
+  size_type capacity() const;
+
+  void clear();
+  void push_back(const_reference value);
+  void push_back(value_type &&value);
+  void swap(concurrent_vector &other) noexcept;
+
+  template <typename... Args>
+  reference emplace_back(Args &&...args);
+};
+}  // namespace s21
+#include "s21_concurrent_vector.cc"
+#endif  // SRC_S21_CONCURRENT_VECTOR_H_
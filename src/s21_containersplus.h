@@ -1,7 +1,18 @@
 #ifndef SRC_S21_CONTAINERSPLUS_H_
 #define SRC_S21_CONTAINERSPLUS_H_
 
+#include "s21_aligned_vector.h"
 #include "s21_array.h"
+#include "s21_concurrent_vector.h"
+#include "s21_huge_vector.h"
+#include "s21_intrusive_list.h"
+#include "s21_memory_resource.h"
+#include "s21_mmap_vector.h"
 #include "s21_multiset.h"
+#include "s21_simd.h"
+#include "s21_small_vector.h"
+#include "s21_soa_vector.h"
+#include "s21_static_vector.h"
+#include "s21_unrolled_list.h"
 
 #endif  // SRC_S21_CONTAINERSPLUS_H_
@@ -0,0 +1,96 @@
+#ifndef SRC_S21_HUGE_VECTOR_CC_
+#define SRC_S21_HUGE_VECTOR_CC_
+
+#include "s21_huge_vector.h"
+
+namespace s21 {
+
+template <typename T>
+template <typename U>
+mmap_allocator<T>::mmap_allocator(const mmap_allocator<U> &) noexcept {}
+
+template <typename T>
+size_t mmap_allocator<T>::MappedBytes(size_t n) {
+  if (n > (std::numeric_limits<size_t>::max() - kHugePage) / sizeof(T)) {
+    throw std::bad_array_new_length();
+  }
+  size_t bytes = n * sizeof(T);
+  if (bytes < kMmapThreshold) return 0;
+  return (bytes + kHugePage - 1) / kHugePage * kHugePage;
+}
+
+// длина кратна 2 МиБ, поэтому munmap и mremap подходят для обоих вариантов
+template <typename T>
+T *mmap_allocator<T>::Map(size_t bytes) {
+  void *ptr = MAP_FAILED;
+#ifdef MAP_HUGETLB
+  int huge = MAP_HUGETLB;
+#ifdef MAP_HUGE_SHIFT
+  huge |= 21 << MAP_HUGE_SHIFT;
+#endif
+  ptr = mmap(nullptr, bytes, PROT_READ | PROT_WRITE,
+             MAP_PRIVATE | MAP_ANONYMOUS | huge, -1, 0);
+  if (ptr != MAP_FAILED) return static_cast<T *>(ptr);
+#endif
+  ptr = mmap(nullptr, bytes, PROT_READ | PROT_WRITE,
+             MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (ptr == MAP_FAILED) throw std::bad_alloc();
+#ifdef MADV_HUGEPAGE
+  madvise(ptr, bytes, MADV_HUGEPAGE);
+#endif
+  return static_cast<T *>(ptr);
+}
+
+template <typename T>
+T *mmap_allocator<T>::allocate(size_t n) {
+  size_t mapped = MappedBytes(n);
+  if (mapped) return Map(mapped);
+  return static_cast<T *>(
+      ::operator new(n * sizeof(T), std::align_val_t{alignof(T)}));
+}
+
+template <typename T>
+void mmap_allocator<T>::deallocate(T *ptr, size_t n) {
+  size_t mapped = MappedBytes(n);
+  if (mapped) {
+    munmap(ptr, mapped);
+  } else {
+    ::operator delete(ptr, std::align_val_t{alignof(T)});
+  }
+}
+
+template <typename T>
+T *mmap_allocator<T>::reallocate(T *ptr, size_t old_n, size_t new_n) {
+  static_assert(std::is_trivially_copyable_v<T>,
+                "reallocate moves elements as raw bytes");
+  if (!ptr) return new_n ? allocate(new_n) : nullptr;
+  if (!new_n) {
+    deallocate(ptr, old_n);
+    return nullptr;
+  }
+  size_t old_mapped = MappedBytes(old_n);
+  size_t new_mapped = MappedBytes(new_n);
+  if (old_mapped && old_mapped == new_mapped) return ptr;
+#ifdef MREMAP_MAYMOVE
+  if (old_mapped && new_mapped) {
+    void *moved = mremap(ptr, old_mapped, new_mapped, MREMAP_MAYMOVE);
+    if (moved != MAP_FAILED) return static_cast<T *>(moved);
+  }
+#endif
+  T *fresh = allocate(new_n);
+  std::memcpy(fresh, ptr, std::min(old_n, new_n) * sizeof(T));
+  deallocate(ptr, old_n);
+  return fresh;
+}
+
+template <typename T, typename U>
+bool operator==(const mmap_allocator<T> &, const mmap_allocator<U> &) {
+  return true;
+}
+
+template <typename T, typename U>
+bool operator!=(const mmap_allocator<T> &, const mmap_allocator<U> &) {
+  return false;
+}
+}  // namespace s21
+#endif  // SRC_S21_HUGE_VECTOR_CC_
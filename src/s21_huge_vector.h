@@ -0,0 +1,55 @@
+#ifndef SRC_S21_HUGE_VECTOR_H_
+#define SRC_S21_HUGE_VECTOR_H_
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "s21_vector.h"
+
+namespace s21 {
+
+// Аллокатор для очень больших буферов. Буферы от kMmapThreshold байт берутся
+// прямо у ядра через mmap: сначала из huge pages (MAP_HUGETLB), если они
+// зарезервированы, иначе обычной анонимной памятью с madvise(MADV_HUGEPAGE)
+// для прозрачных huge pages. Меньшие буферы идут через operator new.
+// reallocate растит и сжимает mmap-буфер через mremap: ядро переставляет
+// страницы, данные не копируются. Без mremap (не Linux) и при переходе через
+// порог содержимое копируется. Без состояния, все экземпляры равны
+template <typename T>
+class mmap_allocator {
+ public:
+  typedef T value_type;
+  typedef std::true_type is_always_equal;
+  typedef std::true_type propagate_on_container_move_assignment;
+
+  static constexpr size_t kHugePage = size_t(2) << 20;
+  static constexpr size_t kMmapThreshold = kHugePage;
+
+  mmap_allocator() noexcept = default;
+  template <typename U>
+  mmap_allocator(const mmap_allocator<U> &) noexcept;
+
+  T *allocate(size_t n);
+  void deallocate(T *ptr, size_t n);
+  // новый буфер на new_n элементов с первыми min(old_n, new_n) элементами
+  // ptr; ptr освобождается. ptr == nullptr — просто allocate
+  T *reallocate(T *ptr, size_t old_n, size_t new_n);
+
+ private:
+  // длина отображения под n элементов, 0 — буфер из operator new
+  static size_t MappedBytes(size_t n);
+  static T *Map(size_t bytes);
+};
+
+template <typename T, typename U>
+bool operator==(const mmap_allocator<T> &, const mmap_allocator<U> &);
+template <typename T, typename U>
+bool operator!=(const mmap_allocator<T> &, const mmap_allocator<U> &);
+
+// vector для десятков гигабайт: большой буфер лежит на huge pages, а рост
+// тривиально копируемых элементов идёт через mremap без копирования
+template <typename T, typename Growth = GeometricGrowth<>>
+using huge_vector = vector<T, mmap_allocator<T>, Growth>;
+}  // namespace s21
+#include "s21_huge_vector.cc"
+#endif  // SRC_S21_HUGE_VECTOR_H_
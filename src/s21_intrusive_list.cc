@@ -0,0 +1,435 @@
+#ifndef SRC_S21_INTRUSIVE_LIST_CC_
+#define SRC_S21_INTRUSIVE_LIST_CC_
+
+#include "s21_intrusive_list.h"
+
+namespace s21 {
+/* intrusive_list_hook *******************************************/
+
+template <typename Tag>
+intrusive_list_hook<Tag>::intrusive_list_hook() noexcept
+    : pPrev_{nullptr}, pNext_{nullptr} {}
+
+template <typename Tag>
+intrusive_list_hook<Tag>::intrusive_list_hook(
+    const intrusive_list_hook &) noexcept
+    : pPrev_{nullptr}, pNext_{nullptr} {}
+
+// присваивание объектов не трогает их места в списках
+template <typename Tag>
+intrusive_list_hook<Tag> &intrusive_list_hook<Tag>::operator=(
+    const intrusive_list_hook &) noexcept {
+  return *this;
+}
+
+template <typename Tag>
+bool intrusive_list_hook<Tag>::is_linked() const noexcept {
+  return pNext_ != nullptr;
+}
+
+/* итераторы *****************************************************/
+
+template <typename T, typename Tag>
+intrusive_list<T, Tag>::ListIterator::ListIterator() : iter_{nullptr} {}
+
+template <typename T, typename Tag>
+intrusive_list<T, Tag>::ListIterator::ListIterator(hook_type *iter)
+    : iter_{iter} {}
+
+template <typename T, typename Tag>
+typename intrusive_list<T, Tag>::reference
+intrusive_list<T, Tag>::iterator::operator*() const {
+  return *AsValue(iter_);
+}
+
+template <typename T, typename Tag>
+T *intrusive_list<T, Tag>::iterator::operator->() const {
+  return AsValue(iter_);
+}
+
+template <typename T, typename Tag>
+typename intrusive_list<T, Tag>::ListIterator &
+intrusive_list<T, Tag>::iterator::operator++() {
+  iter_ = iter_->pNext_;
+  return *this;
+}
+
+template <typename T, typename Tag>
+typename intrusive_list<T, Tag>::ListIterator
+intrusive_list<T, Tag>::iterator::operator++(int) {
+  ListIterator tmp(*this);
+  iter_ = iter_->pNext_;
+  return tmp;
+}
+
+template <typename T, typename Tag>
+typename intrusive_list<T, Tag>::ListIterator &
+intrusive_list<T, Tag>::iterator::operator--() {
+  iter_ = iter_->pPrev_;
+  return *this;
+}
+
+template <typename T, typename Tag>
+typename intrusive_list<T, Tag>::ListIterator
+intrusive_list<T, Tag>::iterator::operator--(int) {
+  ListIterator tmp(*this);
+  iter_ = iter_->pPrev_;
+  return tmp;
+}
+
+template <typename T, typename Tag>
+bool intrusive_list<T, Tag>::iterator::operator==(
+    const ListIterator &other) const {
+  return iter_ == other.iter_;
+}
+
+template <typename T, typename Tag>
+bool intrusive_list<T, Tag>::iterator::operator!=(
+    const ListIterator &other) const {
+  return iter_ != other.iter_;
+}
+
+template <typename T, typename Tag>
+typename intrusive_list<T, Tag>::hook_type *
+intrusive_list<T, Tag>::iterator::getNode() const {
+  return iter_;
+}
+
+template <typename T, typename Tag>
+intrusive_list<T, Tag>::ListConstIterator::ListConstIterator()
+    : ListIterator() {}
+
+template <typename T, typename Tag>
+intrusive_list<T, Tag>::ListConstIterator::ListConstIterator(hook_type *iter)
+    : ListIterator{iter} {}
+
+template <typename T, typename Tag>
+intrusive_list<T, Tag>::ListConstIterator::ListConstIterator(
+    const ListIterator &other)
+    : ListIterator{other} {}
+
+template <typename T, typename Tag>
+typename intrusive_list<T, Tag>::const_reference
+intrusive_list<T, Tag>::const_iterator::operator*() const {
+  return *AsValue(ListIterator::iter_);
+}
+
+template <typename T, typename Tag>
+const T *intrusive_list<T, Tag>::const_iterator::operator->() const {
+  return AsValue(ListIterator::iter_);
+}
+
+template <typename T, typename Tag>
+typename intrusive_list<T, Tag>::ListConstIterator &
+intrusive_list<T, Tag>::const_iterator::operator++() {
+  ListIterator::operator++();
+  return *this;
+}
+
+template <typename T, typename Tag>
+typename intrusive_list<T, Tag>::ListConstIterator
+intrusive_list<T, Tag>::const_iterator::operator++(int) {
+  ListConstIterator tmp(*this);
+  ListIterator::operator++();
+  return tmp;
+}
+
+template <typename T, typename Tag>
+typename intrusive_list<T, Tag>::ListConstIterator &
+intrusive_list<T, Tag>::const_iterator::operator--() {
+  ListIterator::operator--();
+  return *this;
+}
+
+template <typename T, typename Tag>
+typename intrusive_list<T, Tag>::ListConstIterator
+intrusive_list<T, Tag>::const_iterator::operator--(int) {
+  ListConstIterator tmp(*this);
+  ListIterator::operator--();
+  return tmp;
+}
+
+/* служебные *****************************************************/
+
+/*объект по его крюку; фиктивный узел сюда не попадает*/
+template <typename T, typename Tag>
+T *intrusive_list<T, Tag>::AsValue(hook_type *node) {
+  return static_cast<T *>(node);
+}
+
+template <typename T, typename Tag>
+typename intrusive_list<T, Tag>::hook_type *intrusive_list<T, Tag>::AsHook(
+    reference value) {
+  return static_cast<hook_type *>(&value);
+}
+
+template <typename T, typename Tag>
+void intrusive_list<T, Tag>::SwapNodes(intrusive_list &other) noexcept {
+  Links::Swap(fake_, other.fake_);
+  std::swap(size_, other.size_);
+}
+
+/*вставить перед текущим; связанный объект второй раз не вставляется*/
+template <typename T, typename Tag>
+void intrusive_list<T, Tag>::InsertBeforeCurrent(hook_type *new_node,
+                                                 hook_type *current_node) {
+  if (new_node->is_linked())
+    throw std::invalid_argument("value is already linked");
+  new_node->pNext_ = current_node;
+  new_node->pPrev_ = current_node->pPrev_;
+  current_node->pPrev_->pNext_ = new_node;
+  current_node->pPrev_ = new_node;
+  size_++;
+}
+
+/*отцепить узел, его крюк снова не связан*/
+template <typename T, typename Tag>
+void intrusive_list<T, Tag>::RemoveNode(hook_type *node) noexcept {
+  node->pPrev_->pNext_ = node->pNext_;
+  node->pNext_->pPrev_ = node->pPrev_;
+  node->pPrev_ = node->pNext_ = nullptr;
+  size_--;
+}
+
+/*перевесить [first, last) списка other перед pos, count — сколько узлов
+ * переходит из other*/
+template <typename T, typename Tag>
+void intrusive_list<T, Tag>::Transfer(hook_type *pos, intrusive_list &other,
+                                      hook_type *first, hook_type *last,
+                                      size_type count) noexcept {
+  Links::Transfer(pos, first, last);
+  other.size_ -= count;
+  size_ += count;
+}
+
+/* intrusive_list ************************************************/
+
+template <typename T, typename Tag>
+intrusive_list<T, Tag>::intrusive_list() noexcept : size_{0} {
+  Links::Reset(fake_);
+}
+
+template <typename T, typename Tag>
+intrusive_list<T, Tag>::intrusive_list(intrusive_list &&l) noexcept
+    : intrusive_list() {
+  SwapNodes(l);
+}
+
+/*объекты отцепляются, но не уничтожаются*/
+template <typename T, typename Tag>
+intrusive_list<T, Tag>::~intrusive_list() {
+  clear();
+}
+
+template <typename T, typename Tag>
+intrusive_list<T, Tag> &intrusive_list<T, Tag>::operator=(
+    intrusive_list &&l) noexcept {
+  if (this != &l) {
+    clear();
+    SwapNodes(l);
+  }
+  return *this;
+}
+
+template <typename T, typename Tag>
+typename intrusive_list<T, Tag>::iterator intrusive_list<T, Tag>::begin() {
+  return iterator(fake_.pNext_);
+}
+
+template <typename T, typename Tag>
+typename intrusive_list<T, Tag>::iterator intrusive_list<T, Tag>::end() {
+  return iterator(&fake_);
+}
+
+template <typename T, typename Tag>
+typename intrusive_list<T, Tag>::const_iterator
+intrusive_list<T, Tag>::cbegin() const {
+  return const_iterator(fake_.pNext_);
+}
+
+template <typename T, typename Tag>
+typename intrusive_list<T, Tag>::const_iterator intrusive_list<T, Tag>::cend()
+    const {
+  return const_iterator(const_cast<hook_type *>(&fake_));
+}
+
+template <typename T, typename Tag>
+typename intrusive_list<T, Tag>::iterator intrusive_list<T, Tag>::iterator_to(
+    reference value) {
+  return iterator(AsHook(value));
+}
+
+template <typename T, typename Tag>
+void intrusive_list<T, Tag>::pop_front() {
+  if (!size_) throw std::invalid_argument("list is empty");
+  RemoveNode(fake_.pNext_);
+}
+
+template <typename T, typename Tag>
+void intrusive_list<T, Tag>::pop_back() {
+  if (!size_) throw std::invalid_argument("list is empty");
+  RemoveNode(fake_.pPrev_);
+}
+
+template <typename T, typename Tag>
+void intrusive_list<T, Tag>::push_back(reference value) {
+  InsertBeforeCurrent(AsHook(value), &fake_);
+}
+
+template <typename T, typename Tag>
+void intrusive_list<T, Tag>::push_front(reference value) {
+  InsertBeforeCurrent(AsHook(value), fake_.pNext_);
+}
+
+template <typename T, typename Tag>
+void intrusive_list<T, Tag>::clear() noexcept {
+  hook_type *node = fake_.pNext_;
+  while (node != &fake_) {
+    hook_type *next = node->pNext_;
+    node->pPrev_ = node->pNext_ = nullptr;
+    node = next;
+  }
+  Links::Reset(fake_);
+  size_ = 0;
+}
+
+template <typename T, typename Tag>
+bool intrusive_list<T, Tag>::empty() const {
+  return size_ == 0;
+}
+
+template <typename T, typename Tag>
+void intrusive_list<T, Tag>::reverse() noexcept {
+  hook_type *node = &fake_;
+  do {
+    std::swap(node->pNext_, node->pPrev_);
+    node = node->pPrev_;
+  } while (node != &fake_);
+}
+
+template <typename T, typename Tag>
+typename intrusive_list<T, Tag>::size_type intrusive_list<T, Tag>::size()
+    const {
+  return size_;
+}
+
+template <typename T, typename Tag>
+typename intrusive_list<T, Tag>::size_type intrusive_list<T, Tag>::max_size()
+    const {
+  return std::numeric_limits<size_type>::max() / sizeof(T);
+}
+
+template <typename T, typename Tag>
+typename intrusive_list<T, Tag>::reference intrusive_list<T, Tag>::front() {
+  return *AsValue(fake_.pNext_);
+}
+
+template <typename T, typename Tag>
+typename intrusive_list<T, Tag>::reference intrusive_list<T, Tag>::back() {
+  return *AsValue(fake_.pPrev_);
+}
+
+template <typename T, typename Tag>
+typename intrusive_list<T, Tag>::iterator intrusive_list<T, Tag>::insert(
+    const_iterator pos, reference value) {
+  InsertBeforeCurrent(AsHook(value), pos.getNode());
+  return iterator(AsHook(value));
+}
+
+template <typename T, typename Tag>
+typename intrusive_list<T, Tag>::iterator intrusive_list<T, Tag>::erase(
+    const_iterator pos) {
+  hook_type *node = pos.getNode();
+  if (node == &fake_)
+    throw std::invalid_argument("double free or corruption (out)");
+  hook_type *next = node->pNext_;
+  RemoveNode(node);
+  return iterator(next);
+}
+
+/*за O(1) по самому объекту: крюк знает соседей. Объект должен состоять
+ * именно в этом списке*/
+template <typename T, typename Tag>
+typename intrusive_list<T, Tag>::iterator intrusive_list<T, Tag>::erase(
+    reference value) {
+  if (!AsHook(value)->is_linked())
+    throw std::invalid_argument("value is not linked");
+  return erase(const_iterator(AsHook(value)));
+}
+
+template <typename T, typename Tag>
+void intrusive_list<T, Tag>::merge(intrusive_list &other) {
+  merge(other, std::less<T>());
+}
+
+/*если comp бросит, все объекты остаются в этом списке, хоть и не по
+ * порядку*/
+template <typename T, typename Tag>
+template <class Compare>
+void intrusive_list<T, Tag>::merge(intrusive_list &other, Compare comp) {
+  if (this != &other && other.size_) {
+    size_ += other.size_;
+    other.size_ = 0;
+    Links::Merge(fake_, other.fake_, [&comp](hook_type *a, hook_type *b) {
+      return comp(*AsValue(a), *AsValue(b));
+    });
+  }
+}
+
+template <typename T, typename Tag>
+void intrusive_list<T, Tag>::splice(const_iterator pos,
+                                    intrusive_list &other) {
+  if (this != &other && other.size_) {
+    Transfer(pos.getNode(), other, other.fake_.pNext_, &other.fake_,
+             other.size_);
+  }
+}
+
+template <typename T, typename Tag>
+void intrusive_list<T, Tag>::splice(const_iterator pos, intrusive_list &other,
+                                    const_iterator it) {
+  hook_type *node = it.getNode();
+  hook_type *current_node = pos.getNode();
+  if (node != current_node && node->pNext_ != current_node) {
+    Transfer(current_node, other, node, node->pNext_, this != &other);
+  }
+}
+
+/*диапазон из другого списка считается один раз; pos не должен лежать
+ * внутри диапазона*/
+template <typename T, typename Tag>
+void intrusive_list<T, Tag>::splice(const_iterator pos, intrusive_list &other,
+                                    const_iterator first,
+                                    const_iterator last) {
+  if (first != last) {
+    size_type count = 0;
+    if (this != &other) {
+      for (const_iterator it = first; it != last; ++it) count++;
+    }
+    Transfer(pos.getNode(), other, first.getNode(), last.getNode(), count);
+  }
+}
+
+template <typename T, typename Tag>
+void intrusive_list<T, Tag>::swap(intrusive_list &other) noexcept {
+  SwapNodes(other);
+}
+
+template <typename T, typename Tag>
+void intrusive_list<T, Tag>::sort() {
+  sort(std::less<T>());
+}
+
+/*устойчивая сортировка слиянием теми же ListLinks, что и у s21::list.
+ * Если comp бросит, объекты остаются в списке в произвольном порядке*/
+template <typename T, typename Tag>
+template <class Compare>
+void intrusive_list<T, Tag>::sort(Compare comp) {
+  if (size_ > 1) {
+    Links::Sort(fake_, [&comp](hook_type *a, hook_type *b) {
+      return comp(*AsValue(a), *AsValue(b));
+    });
+  }
+}
+}  // namespace s21
+#endif  // SRC_S21_INTRUSIVE_LIST_CC_
@@ -0,0 +1,148 @@
+#ifndef SRC_S21_INTRUSIVE_LIST_H_
+#define SRC_S21_INTRUSIVE_LIST_H_
+
+#include <functional>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "s21_list_links.h"
+
+namespace s21 {
+
+template <typename T, typename Tag>
+class intrusive_list;
+
+// Связи объекта в intrusive_list. Объект наследует крюк открыто, по
+// одному на каждый список, в котором он может состоять одновременно;
+// списки различаются тегом: struct Timer : intrusive_list_hook<Wheel>,
+// intrusive_list_hook<Expired>. Копия крюка не связана: копирование
+// объекта не копирует его место в списке
+template <typename Tag = void>
+class intrusive_list_hook {
+ public:
+  intrusive_list_hook() noexcept;
+  intrusive_list_hook(const intrusive_list_hook &) noexcept;
+  intrusive_list_hook &operator=(const intrusive_list_hook &) noexcept;
+
+  bool is_linked() const noexcept;
+
+ private:
+  template <typename, typename>
+  friend class intrusive_list;
+  template <typename>
+  friend struct ListLinks;
+
+  intrusive_list_hook *pPrev_;
+  intrusive_list_hook *pNext_;
+};
+
+// Интрузивный двусвязный список: связывает уже существующие объекты через
+// их крюк intrusive_list_hook<Tag> и ничего не выделяет. Список не
+// владеет объектами: clear и деструктор только отцепляют их, а объект
+// нужно убрать из списка до своего уничтожения. Удаление по самому
+// объекту (erase(value)), splice, merge и sort перевешивают связи.
+// Объект, уже состоящий в списке с тем же тегом, вставить нельзя
+template <typename T, typename Tag = void>
+class intrusive_list {
+ public:
+  typedef T value_type;
+  typedef T &reference;
+  typedef const T &const_reference;
+  typedef size_t size_type;
+  typedef intrusive_list_hook<Tag> hook_type;
+
+  static_assert(std::is_base_of_v<hook_type, T>,
+                "T must derive from intrusive_list_hook<Tag>");
+
+ private:
+  typedef ListLinks<hook_type> Links;
+
+  size_type size_;
+  hook_type fake_;
+
+  static T *AsValue(hook_type *node);
+  static hook_type *AsHook(reference value);
+  void SwapNodes(intrusive_list &other) noexcept;
+  void InsertBeforeCurrent(hook_type *new_node, hook_type *current_node);
+  void RemoveNode(hook_type *node) noexcept;
+  void Transfer(hook_type *pos, intrusive_list &other, hook_type *first,
+                hook_type *last, size_type count) noexcept;
+
+ public:
+  intrusive_list() noexcept;
+  intrusive_list(const intrusive_list &) = delete;
+  intrusive_list(intrusive_list &&l) noexcept;
+  ~intrusive_list();
+  intrusive_list &operator=(const intrusive_list &) = delete;
+  intrusive_list &operator=(intrusive_list &&l) noexcept;
+
+  typedef class ListIterator {
+   protected:
+    hook_type *iter_;
+
+   public:
+    ListIterator();
+    ListIterator(hook_type *iter);
+    reference operator*() const;
+    T *operator->() const;
+    ListIterator &operator++();
+    ListIterator operator++(int);
+    ListIterator &operator--();
+    ListIterator operator--(int);
+    bool operator==(const ListIterator &other) const;
+    bool operator!=(const ListIterator &other) const;
+    hook_type *getNode() const;
+  } iterator;
+  iterator begin();
+  iterator end();
+
+  typedef class ListConstIterator : public ListIterator {
+   public:
+    ListConstIterator();
+    ListConstIterator(hook_type *iter);
+    ListConstIterator(const ListIterator &other);
+    const_reference operator*() const;
+    const T *operator->() const;
+    ListConstIterator &operator++();
+    ListConstIterator operator++(int);
+    ListConstIterator &operator--();
+    ListConstIterator operator--(int);
+  } const_iterator;
+  const_iterator cbegin() const;
+  const_iterator cend() const;
+
+  // итератор на объект, который уже состоит в этом списке
+  iterator iterator_to(reference value);
+
+  void pop_front();
+  void pop_back();
+  void push_back(reference value);
+  void push_front(reference value);
+  void clear() noexcept;
+  bool empty() const;
+  void reverse() noexcept;
+  size_type size() const;
+  size_type max_size() const;
+  reference front();
+  reference back();
+  iterator insert(const_iterator pos, reference value);
+  // отцепляют объект и возвращают итератор на следующий
+  iterator erase(const_iterator pos);
+  iterator erase(reference value);
+  void merge(intrusive_list &other);
+  template <class Compare>
+  void merge(intrusive_list &other, Compare comp);
+  void splice(const_iterator pos, intrusive_list &other);
+  void splice(const_iterator pos, intrusive_list &other, const_iterator it);
+  void splice(const_iterator pos, intrusive_list &other, const_iterator first,
+              const_iterator last);
+  void swap(intrusive_list &other) noexcept;
+  void sort();
+  template <class Compare>
+  void sort(Compare comp);
+};
+}  // namespace s21
+#include "s21_intrusive_list.cc"
+#endif  // SRC_S21_INTRUSIVE_LIST_H_
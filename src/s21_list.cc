@@ -5,134 +5,159 @@
 namespace s21 {
 /*Конструкторы, деструкторы ************************************/
 
-template <class value_type>
-list<value_type>::list() : list(0, value_type()) {}
+template <class value_type, class Allocator>
+list<value_type, Allocator>::list() : list(Allocator()) {}
 
-template <class value_type>
-list<value_type>::list(size_type n) : list(n, value_type()) {}
+template <class value_type, class Allocator>
+list<value_type, Allocator>::list(const Allocator &alloc)
+    : size_{0}, alloc_{alloc} {
+  Links::Reset(fake_);
+}
+
+template <class value_type, class Allocator>
+list<value_type, Allocator>::list(size_type n, const Allocator &alloc)
+    : list(n, value_type(), alloc) {}
 
-template <class value_type>
-list<value_type>::list(size_type n, value_type x) : size_{0} {
-  CreateFake();
+template <class value_type, class Allocator>
+list<value_type, Allocator>::list(size_type n, value_type x,
+                                  const Allocator &alloc)
+    : list(alloc) {
   for (size_type i = 0; i < n; i++) push_back(x);
 }
 
-template <class value_type>
-list<value_type>::list(std::initializer_list<value_type> const &items)
-    : list(0, 0) {
+template <class value_type, class Allocator>
+list<value_type, Allocator>::list(
+    std::initializer_list<value_type> const &items, const Allocator &alloc)
+    : list(alloc) {
   for (const_reference val : items) {
     push_back(val);
   }
 }
 
 /* Copy Constructor*/
-template <class value_type>
-list<value_type>::list(const list &l) : list(0, 0) {
-  if (this != &l) {
-    const_iterator iter = l.cbegin();
-    const_iterator iter_end = l.cend();
-    for (; iter != iter_end; ++iter) {
-      push_back(*iter);
-    }
+template <class value_type, class Allocator>
+list<value_type, Allocator>::list(const list &l)
+    : list(l, AllocTraits::select_on_container_copy_construction(
+                  l.get_allocator())) {}
+
+/* копия l, узлы которой выделяет alloc*/
+template <class value_type, class Allocator>
+list<value_type, Allocator>::list(const list &l, const Allocator &alloc)
+    : list(alloc) {
+  const_iterator iter = l.cbegin();
+  const_iterator iter_end = l.cend();
+  for (; iter != iter_end; ++iter) {
+    push_back(*iter);
   }
 }
 
-/* Move Constructor*/
+/* Move Constructor: узлы l забираются за O(1) без выделений, поэтому
+ * vector перемещает, а не копирует списки при росте*/
 
-template <class value_type>
-list<value_type>::list(list &&l) : list(0, 0) {
-  if (this != &l) {
-    std::swap(head_, l.head_);
-    std::swap(fake_, l.fake_);
-    std::swap(size_, l.size_);
-  }
+template <class value_type, class Allocator>
+list<value_type, Allocator>::list(list &&l) noexcept
+    : list(l.get_allocator()) {
+  SwapNodes(l);
 }
 
 /* мусоросжигающая печь*/
-template <class value_type>
-list<value_type>::~list() {
-  while (size_) {
-    pop_front();
-  }
-  delete fake_;
+template <class value_type, class Allocator>
+list<value_type, Allocator>::~list() {
+  clear();
+}
+
+template <class value_type, class Allocator>
+typename list<value_type, Allocator>::allocator_type
+list<value_type, Allocator>::get_allocator() const {
+  return allocator_type(alloc_);
 }
 
 /* список итераторов*/
-template <class value_type>
-list<value_type>::ListIterator::ListIterator() : iter_{nullptr} {}
+template <class value_type, class Allocator>
+list<value_type, Allocator>::ListIterator::ListIterator() : iter_{nullptr} {}
 
 /* обнуление*/
-template <class value_type>
-list<value_type>::ListIterator::ListIterator(Node *iter) : iter_{iter} {}
+template <class value_type, class Allocator>
+list<value_type, Allocator>::ListIterator::ListIterator(NodeBase *iter)
+    : iter_{iter} {}
 
 /* ну я так понимаю присваивание одного итерала узла другому*/
-template <class value_type>
-typename list<value_type>::ListIterator &list<value_type>::iterator::operator=(
-    const ListIterator &other) {
+template <class value_type, class Allocator>
+typename list<value_type, Allocator>::ListIterator &
+list<value_type, Allocator>::iterator::operator=(const ListIterator &other) {
   if (this->iter_ != other.iter_) {
     this->iter_ = other.iter_;
   }
   return *this;
 }
 
-template <class value_type>
-typename list<value_type>::reference list<value_type>::iterator::operator*() {
-  return iter_->data_;
+template <class value_type, class Allocator>
+typename list<value_type, Allocator>::reference
+list<value_type, Allocator>::iterator::operator*() {
+  return AsNode(iter_)->data_;
 }
 
-template <class value_type>
-typename list<value_type>::ListIterator &
-list<value_type>::iterator::operator++() {
+template <class value_type, class Allocator>
+typename list<value_type, Allocator>::ListIterator &
+list<value_type, Allocator>::iterator::operator++() {
   iter_ = iter_->pNext_;
   return *this;
 }
 
-template <class value_type>
-typename list<value_type>::ListIterator &
-list<value_type>::iterator::operator--() {
+template <class value_type, class Allocator>
+typename list<value_type, Allocator>::ListIterator &
+list<value_type, Allocator>::iterator::operator--() {
   iter_ = iter_->pPrev_;
   return *this;
 }
 
-template <class value_type>
-bool list<value_type>::iterator::operator==(const ListIterator &other) const {
+template <class value_type, class Allocator>
+bool list<value_type, Allocator>::iterator::operator==(
+    const ListIterator &other) const {
   return iter_ == other.iter_;
 }
 
-template <class value_type>
-bool list<value_type>::iterator::operator!=(const ListIterator &other) const {
+template <class value_type, class Allocator>
+bool list<value_type, Allocator>::iterator::operator!=(
+    const ListIterator &other) const {
   return iter_ != other.iter_;
 }
 
 /*получить узел*/
-template <class value_type>
-typename list<value_type>::Node *list<value_type>::iterator::getNode() const {
-  return list<value_type>::iterator::iter_;
+template <class value_type, class Allocator>
+typename list<value_type, Allocator>::NodeBase *
+list<value_type, Allocator>::iterator::getNode() const {
+  return list<value_type, Allocator>::iterator::iter_;
 }
 
 /*начинать*/
-template <class value_type>
-typename list<value_type>::iterator list<value_type>::begin() {
-  return iterator(this->head_);
+template <class value_type, class Allocator>
+typename list<value_type, Allocator>::iterator
+list<value_type, Allocator>::begin() {
+  return iterator(fake_.pNext_);
 }
 
 /*конец*/
-template <class value_type>
-typename list<value_type>::iterator list<value_type>::end() {
-  return iterator(this->fake_);
+template <class value_type, class Allocator>
+typename list<value_type, Allocator>::iterator
+list<value_type, Allocator>::end() {
+  return iterator(&fake_);
 }
 
 /*список интералов*/
-template <class value_type>
-list<value_type>::ListConstIterator::ListConstIterator() : ListIterator() {}
+template <class value_type, class Allocator>
+list<value_type, Allocator>::ListConstIterator::ListConstIterator()
+    : ListIterator() {}
 
-template <class value_type>
-list<value_type>::ListConstIterator::ListConstIterator(Node *iter)
+template <class value_type, class Allocator>
+list<value_type, Allocator>::ListConstIterator::ListConstIterator(
+    NodeBase *iter)
     : ListIterator{iter} {}
 
-template <class value_type>
-typename list<value_type>::ListConstIterator &
-list<value_type>::const_iterator::operator=(const ListConstIterator &other) {
+template <class value_type, class Allocator>
+typename list<value_type, Allocator>::ListConstIterator &
+list<value_type, Allocator>::const_iterator::operator=(
+    const ListConstIterator &other) {
   if (ListIterator::iter_ != other.iter_) {
     clear();
     ListIterator::iter_ = other.iter_;
@@ -140,393 +165,349 @@ list<value_type>::const_iterator::operator=(const ListConstIterator &other) {
   return *this;
 }
 
-template <class value_type>
-typename list<value_type>::const_reference
-list<value_type>::const_iterator::operator*() {
-  return ListIterator::iter_->data_;
+template <class value_type, class Allocator>
+typename list<value_type, Allocator>::const_reference
+list<value_type, Allocator>::const_iterator::operator*() {
+  return AsNode(ListIterator::iter_)->data_;
 }
 
-template <class value_type>
-typename list<value_type>::ListConstIterator &
-list<value_type>::const_iterator::operator++() {
+template <class value_type, class Allocator>
+typename list<value_type, Allocator>::ListConstIterator &
+list<value_type, Allocator>::const_iterator::operator++() {
   ListIterator::iter_ = ListIterator::iter_->pNext_;
   return *this;
 }
 
-template <class value_type>
-typename list<value_type>::ListConstIterator &
-list<value_type>::const_iterator::operator--() {
+template <class value_type, class Allocator>
+typename list<value_type, Allocator>::ListConstIterator &
+list<value_type, Allocator>::const_iterator::operator--() {
   ListIterator::iter_ = ListIterator::iter_->pPrev_;
   return *this;
 }
 
-template <class value_type>
-bool list<value_type>::const_iterator::operator==(
+template <class value_type, class Allocator>
+bool list<value_type, Allocator>::const_iterator::operator==(
     const ListConstIterator &other) const {
   return ListIterator::iter_ == other.iter_;
 }
 
-template <class value_type>
-bool list<value_type>::const_iterator::operator!=(
+template <class value_type, class Allocator>
+bool list<value_type, Allocator>::const_iterator::operator!=(
     const ListConstIterator &other) const {
   return ListIterator::iter_ != other.iter_;
 }
 
-template <class value_type>
-list<value_type> &list<value_type>::operator=(list &&l) {
-  head_ = l.head_;
-  fake_ = l.fake_;
-  size_ = l.size_;
-  l.head_ = l.fake_ = nullptr;
-  l.size_ = 0;
+/*копирующее присваивание через copy-and-swap. Копия строится на том
+ * аллокаторе, который останется у списка после присваивания*/
+template <class value_type, class Allocator>
+list<value_type, Allocator> &list<value_type, Allocator>::operator=(
+    const list &l) {
+  if (this != &l) {
+    if constexpr (AllocTraits::propagate_on_container_copy_assignment::value) {
+      list tmp(l, l.get_allocator());
+      SwapNodes(tmp);
+      std::swap(alloc_, tmp.alloc_);
+    } else {
+      list tmp(l, get_allocator());
+      SwapNodes(tmp);
+    }
+  }
+  return *this;
+}
+
+/*перемещающее присваивание: узлы l забираются за O(1), l остаётся пустым.
+ * Узлы из чужого неравного аллокатора забрать нельзя, тогда элементы
+ * перемещаются по одному в новые узлы*/
+template <class value_type, class Allocator>
+list<value_type, Allocator> &list<value_type, Allocator>::operator=(
+    list &&l) noexcept(kMoveAssignSteals) {
+  if (this != &l) {
+    if constexpr (AllocTraits::propagate_on_container_move_assignment::value) {
+      list tmp(std::move(l));
+      SwapNodes(tmp);
+      std::swap(alloc_, tmp.alloc_);
+    } else if (kMoveAssignSteals || alloc_ == l.alloc_) {
+      list tmp(std::move(l));
+      SwapNodes(tmp);
+    } else {
+      list tmp(get_allocator());
+      for (iterator it = l.begin(); it != l.end(); ++it) {
+        tmp.push_back(std::move(*it));
+      }
+      SwapNodes(tmp);
+      l.clear();
+    }
+  }
   return *this;
 }
 
 /*********************************************************************************/
 
 /*c начало*/
-template <class value_type>
-typename list<value_type>::const_iterator list<value_type>::cbegin() const {
-  return const_iterator(this->head_);
+template <class value_type, class Allocator>
+typename list<value_type, Allocator>::const_iterator
+list<value_type, Allocator>::cbegin() const {
+  return const_iterator(fake_.pNext_);
 }
 
 /*с конца*/
-template <class value_type>
-typename list<value_type>::const_iterator list<value_type>::cend() const {
-  return const_iterator(this->fake_);
+template <class value_type, class Allocator>
+typename list<value_type, Allocator>::const_iterator
+list<value_type, Allocator>::cend() const {
+  return const_iterator(const_cast<NodeBase *>(&fake_));
 }
 
 /*********************************************************************************/
 
-/*Создать подделку*/
-template <class value_type>
-void list<value_type>::CreateFake() {
-  fake_ = new Node;
-  fake_->data_ = 0;
-  head_ = fake_->pNext_ = fake_->pPrev_ = fake_;
-}
-
-/*Увеличить размер*/
-template <class value_type>
-void list<value_type>::IncreaseSize() {
-  size_++;
-  fake_->data_++;
-}
-
-/*вставить узел вперёд*/
-template <class value_type>
-void list<value_type>::InsertNodeFront(Node *node) {
-  node->pPrev_ = fake_;
-  node->pNext_ = head_;
-  if (head_ == fake_) {
-    fake_->pPrev_ = node;
-  } else {
-    head_->pPrev_ = node;
-  }
-  head_ = node;
-}
-
-/*Вставить узел назад*/
-template <class value_type>
-void list<value_type>::InsertNodeBack(Node *node) {
-  node->pNext_ = fake_;
-  node->pPrev_ = fake_->pPrev_;
-  if (head_ == fake_) {
-    head_ = node;
-    fake_->pNext_ = head_;
-  } else {
-    fake_->pPrev_->pNext_ = node;
+/*Узел с данными по указателю на его связи*/
+template <class value_type, class Allocator>
+typename list<value_type, Allocator>::Node *
+list<value_type, Allocator>::AsNode(NodeBase *node) {
+  return static_cast<Node *>(node);
+}
+
+/*Создать узел: память из аллокатора узлов, данные строятся из args*/
+template <class value_type, class Allocator>
+template <typename... Args>
+typename list<value_type, Allocator>::Node *
+list<value_type, Allocator>::CreateNode(Args &&...args) {
+  Node *node = NodeTraits::allocate(alloc_, 1);
+  try {
+    NodeTraits::construct(alloc_, &node->data_, std::forward<Args>(args)...);
+  } catch (...) {
+    NodeTraits::deallocate(alloc_, node, 1);
+    throw;
   }
-  fake_->pPrev_ = node;
+  node->pPrev_ = node->pNext_ = nullptr;
+  return node;
 }
 
-/*Вставить узел перед текущим*/
-template <class value_type>
-void list<value_type>::InsertNodeBeforeCurrent(Node *new_node,
-                                               Node *current_node) {
-  new_node->pNext_ = current_node;
-  new_node->pPrev_ = current_node->pPrev_;
-  current_node->pPrev_->pNext_ = new_node;
-  current_node->pPrev_ = new_node;
+/*Уничтожить узел и вернуть память аллокатору*/
+template <class value_type, class Allocator>
+void list<value_type, Allocator>::DestroyNode(Node *node) {
+  NodeTraits::destroy(alloc_, &node->data_);
+  NodeTraits::deallocate(alloc_, node, 1);
 }
 
-/*вставить вперед*/
-template <class value_type>
-void list<value_type>::InsertFront(Node *node) {
-  InsertNodeFront(node);
-  fake_->pNext_ = head_;
-  IncreaseSize();
-}
-
-/*Вставить Назад*/
-template <class value_type>
-void list<value_type>::InsertBack(Node *node) {
-  InsertNodeBack(node);
-  IncreaseSize();
+/*Поменять местами узлы, аллокаторы остаются на месте. Фиктивные узлы
+ * лежат в самих списках, поэтому крайние узлы перевешиваются на них*/
+template <class value_type, class Allocator>
+void list<value_type, Allocator>::SwapNodes(list &other) noexcept {
+  Links::Swap(fake_, other.fake_);
+  std::swap(size_, other.size_);
 }
 
 /*вставить перед текущим*/
-template <class value_type>
-void list<value_type>::InsertBeforeCurrent(Node *new_node, Node *current_node) {
-  InsertNodeBeforeCurrent(new_node, current_node);
-  IncreaseSize();
-}
-
-/*переместить ущел спереди*/
-template <class value_type>
-void list<value_type>::MoveNodeFront(Node *moving_node) {
-  moving_node->pPrev_->pNext_ = moving_node->pNext_;
-  moving_node->pNext_->pPrev_ = moving_node->pPrev_;
-  InsertNodeFront(moving_node);
-}
-
-/*Переместить узел перед текущим справа налево*/
-template <class value_type>
-void list<value_type>::MoveNodeBeforeCurrentFromRightToLeft(
-    Node *moving_node, Node *current_node) {
-  moving_node->pPrev_->pNext_ = moving_node->pNext_;
-  moving_node->pNext_->pPrev_ = moving_node->pPrev_;
-  InsertNodeBeforeCurrent(moving_node, current_node);
+template <class value_type, class Allocator>
+void list<value_type, Allocator>::InsertBeforeCurrent(NodeBase *new_node,
+                                                      NodeBase *current_node) {
+  new_node->pNext_ = current_node;
+  new_node->pPrev_ = current_node->pPrev_;
+  current_node->pPrev_->pNext_ = new_node;
+  current_node->pPrev_ = new_node;
+  size_++;
 }
 
-/*Сортировка слиянием*/
-template <class value_type>
-void list<value_type>::MergeSort(Node **node1_start, Node **node2_start) {
-  Node *node1 = *node1_start;
-  Node *node2 = *node2_start;
-
-  do {
-    if (node1 == fake_ || node2->data_ < node1->data_) {
-      // перемещение node_2 перед node_1
-      Node *node2_pNext = node2->pNext_;
-      if (node1 == head_) {
-        MoveNodeFront(node2);
-      } else if (node1 != fake_) {
-        MoveNodeBeforeCurrentFromRightToLeft(node2, node1);
-      }
-      if (node2_pNext->data_ < node2->data_) {
-        *node1_start = node2_pNext;
-        break;
-      } else {
-        *node2_start = node2 = node2_pNext;
-      }
-    } else {
-      node1 = node1->pNext_;
-    }
-  } while (node2 != fake_ && node1 != *node2_start);
-  if (node1 == *node2_start) *node1_start = node1->pNext_;
+/*Перевесить узлы [first, last) списка other перед pos и поправить
+ * счётчики, узлы не копируются и не перевыделяются. count — сколько узлов
+ * переходит из other, для splice внутри одного списка 0. Узлы выделены
+ * аллокатором other, поэтому он должен быть равен своему*/
+template <class value_type, class Allocator>
+void list<value_type, Allocator>::Transfer(NodeBase *pos, list &other,
+                                           NodeBase *first, NodeBase *last,
+                                           size_type count) {
+  Links::Transfer(pos, first, last);
+  other.size_ -= count;
+  size_ += count;
 }
 
 /*Удалить узел*/
-template <class value_type>
-void list<value_type>::RemoveNode(Node *node) {
-  if (node == fake_)
+template <class value_type, class Allocator>
+void list<value_type, Allocator>::RemoveNode(NodeBase *node) {
+  if (node == &fake_)
     throw std::invalid_argument("double free or corruption (out)");
-  if (node == head_) {
-    pop_front();
-  } else if (node == fake_->pPrev_) {
-    pop_back();
-  } else {
-    node->pPrev_->pNext_ = node->pNext_;
-    node->pNext_->pPrev_ = node->pPrev_;
-    delete node;
-    size_--;
-    fake_->data_--;
-  }
+  node->pPrev_->pNext_ = node->pNext_;
+  node->pNext_->pPrev_ = node->pPrev_;
+  DestroyNode(AsNode(node));
+  size_--;
 }
 
 /********************************************************************************/
 
 /* удаляет первый элемент*/
-template <class value_type>
-void list<value_type>::pop_front() {
-  if (head_ == fake_)
+template <class value_type, class Allocator>
+void list<value_type, Allocator>::pop_front() {
+  if (!size_)
     throw std::invalid_argument("pointer being freed was not allocated");
-  Node *temp = head_->pNext_;
-  delete head_;
-  head_ = temp;
-  head_->pPrev_ = fake_;
-  fake_->pNext_ = temp;
-  size_--;
-  fake_->data_--;
+  RemoveNode(fake_.pNext_);
 }
 
 /*удалять последний элемент*/
-template <class value_type>
-void list<value_type>::pop_back() {
-  if (fake_->pPrev_ == fake_)
+template <class value_type, class Allocator>
+void list<value_type, Allocator>::pop_back() {
+  if (!size_)
     throw std::invalid_argument("pointer being freed was not allocated");
-  Node *temp = fake_->pPrev_->pPrev_;
-  delete fake_->pPrev_;
-  temp->pNext_ = fake_;
-  if (size_ == 2)
-    head_->pNext_ = fake_;
-  else if (size_ == 1)
-    head_ = fake_;
-  fake_->pPrev_ = temp;
-  if (size_ == 1) fake_->pNext_ = fake_;
-
-  size_--;
-  fake_->data_--;
+  RemoveNode(fake_.pPrev_);
 }
 
 /* добавляет элемент в конец*/
-template <class value_type>
-void list<value_type>::push_back(value_type data) {
-  Node *new_node = new Node;
-  new_node->data_ = data;
-  InsertBack(new_node);
+template <class value_type, class Allocator>
+void list<value_type, Allocator>::push_back(value_type data) {
+  InsertBeforeCurrent(CreateNode(std::move(data)), &fake_);
 }
 
 /*добовлять элемент в начало*/
-template <class value_type>
-void list<value_type>::push_front(value_type data) {
-  Node *new_node = new Node;
-  new_node->data_ = data;
-  InsertFront(new_node);
+template <class value_type, class Allocator>
+void list<value_type, Allocator>::push_front(value_type data) {
+  InsertBeforeCurrent(CreateNode(std::move(data)), fake_.pNext_);
 }
 
 /*удалять целиком*/
-template <class value_type>
-void list<value_type>::clear() {
-  while (size_) {
-    pop_front();
+template <class value_type, class Allocator>
+void list<value_type, Allocator>::clear() {
+  NodeBase *node = fake_.pNext_;
+  while (node != &fake_) {
+    NodeBase *next = node->pNext_;
+    DestroyNode(AsNode(node));
+    node = next;
   }
+  Links::Reset(fake_);
+  size_ = 0;
 }
 
 /*пустой*/
-template <class value_type>
-bool list<value_type>::empty() {
-  return bool(!size_);
+template <class value_type, class Allocator>
+bool list<value_type, Allocator>::empty() {
+  return size_ == 0;
 }
 
 /*перевернуть*/
-template <class value_type>
-void list<value_type>::reverse() {
-  Node *iter = fake_->pPrev_;
-  while (iter != fake_) {
-    std::swap(iter->pNext_, iter->pPrev_);
-    iter = iter->pNext_;
-  }
-  head_ = fake_->pPrev_;
-  std::swap(fake_->pNext_, fake_->pPrev_);
+template <class value_type, class Allocator>
+void list<value_type, Allocator>::reverse() {
+  NodeBase *node = &fake_;
+  do {
+    std::swap(node->pNext_, node->pPrev_);
+    node = node->pPrev_;
+  } while (node != &fake_);
 }
 
 /*размер*/
-template <class value_type>
-typename list<value_type>::size_type list<value_type>::size() {
+template <class value_type, class Allocator>
+typename list<value_type, Allocator>::size_type
+list<value_type, Allocator>::size() {
   return size_;
 }
 
 /*передний*/
-template <class value_type>
-typename list<value_type>::const_reference list<value_type>::front() {
-  return head_->data_;
+template <class value_type, class Allocator>
+typename list<value_type, Allocator>::const_reference
+list<value_type, Allocator>::front() {
+  return AsNode(fake_.pNext_)->data_;
 }
 
 /*задний*/
-template <class value_type>
-typename list<value_type>::const_reference list<value_type>::back() {
-  return fake_->pPrev_->data_;
+template <class value_type, class Allocator>
+typename list<value_type, Allocator>::const_reference
+list<value_type, Allocator>::back() {
+  return AsNode(fake_.pPrev_)->data_;
 }
 
 /*вставлять*/
-template <class value_type>
-typename list<value_type>::iterator list<value_type>::insert(
+template <class value_type, class Allocator>
+typename list<value_type, Allocator>::iterator
+list<value_type, Allocator>::insert(
     iterator pos, const_reference value) {
-  Node *current_node = pos.getNode();
-  if (current_node == head_) {
-    push_front(value);
-    return begin();
-  } else if (current_node == head_) {
-    push_back(value);
-    return iterator(this->fake_->pPrev_);
-  } else {
-    Node *new_node = new Node;
-    new_node->data_ = value;
-    InsertBeforeCurrent(new_node, current_node);
-    return iterator(new_node);
-  }
+  Node *new_node = CreateNode(value);
+  InsertBeforeCurrent(new_node, pos.getNode());
+  return iterator(new_node);
 }
 
 /*стереть*/
-template <class value_type>
-void list<value_type>::erase(iterator pos) {
-  Node *node = pos.getNode();
-  RemoveNode(node);
+template <class value_type, class Allocator>
+void list<value_type, Allocator>::erase(iterator pos) {
+  RemoveNode(pos.getNode());
 }
 
 /*максимальный размер*/
-template <class value_type>
-typename list<value_type>::size_type list<value_type>::max_size() {
-  return std::numeric_limits<int64_t>::max() / sizeof(*this);
+template <class value_type, class Allocator>
+typename list<value_type, Allocator>::size_type
+list<value_type, Allocator>::max_size() {
+  return NodeTraits::max_size(alloc_);
 }
 
 /*сливаться*/
-template <class value_type>
-void list<value_type>::merge(list &other) {
-  Node *current_node = head_;
-  while (other.head_ != other.fake_) {
-    if (current_node == fake_ || other.head_->data_ < current_node->data_) {
-      // перемещение ноды other перед current_node
-      Node *other_pNext = other.head_->pNext_;
-      if (current_node == head_) {
-        InsertFront(other.head_);
-      } else if (current_node == fake_) {
-        InsertBack(other.head_);
-      } else {
-        InsertBeforeCurrent(other.head_, current_node);
-      }
-      //  схлапывание листа other
-      other.head_ = other_pNext;
-      other.size_--;
-      other.fake_->data_--;
-    } else {
-      current_node = current_node->pNext_;
-    }
+template <class value_type, class Allocator>
+void list<value_type, Allocator>::merge(list &other) {
+  merge(other, std::less<value_type>());
+}
+
+/*если comp бросит, все узлы остаются в этом списке, хоть и не по порядку*/
+template <class value_type, class Allocator>
+template <class Compare>
+void list<value_type, Allocator>::merge(list &other, Compare comp) {
+  if (this != &other && other.size_) {
+    size_ += other.size_;
+    other.size_ = 0;
+    Links::Merge(fake_, other.fake_, [&comp](NodeBase *a, NodeBase *b) {
+      return comp(AsNode(a)->data_, AsNode(b)->data_);
+    });
   }
 }
 
-/*соединение*/
-/*// TODO: НЕОБХОДИМО изменить позиция итератора на константную позицию
- * итератора*/
-template <class value_type>
-void list<value_type>::splice(const_iterator pos, list &other) {
-  Node *current_node = pos.getNode();
-  while (other.head_ != other.fake_) {
-    // перемещение ноды other перед current_node
-    Node *other_pNext = other.head_->pNext_;
-    if (current_node == head_) {
-      InsertFront(other.head_);
-    } else if (current_node == fake_) {
-      InsertBack(other.head_);
-    } else {
-      InsertBeforeCurrent(other.head_, current_node);
+/*соединение: весь other перед pos*/
+template <class value_type, class Allocator>
+void list<value_type, Allocator>::splice(const_iterator pos, list &other) {
+  if (other.size_) {
+    Transfer(pos.getNode(), other, other.fake_.pNext_, &other.fake_,
+             other.size_);
+  }
+}
+
+/*соединение: один узел it из other перед pos*/
+template <class value_type, class Allocator>
+void list<value_type, Allocator>::splice(const_iterator pos, list &other,
+                                         const_iterator it) {
+  NodeBase *node = it.getNode();
+  NodeBase *current_node = pos.getNode();
+  if (node != current_node && node->pNext_ != current_node) {
+    Transfer(current_node, other, node, node->pNext_, this != &other);
+  }
+}
+
+/*соединение: узлы [first, last) из other перед pos. pos не должен лежать
+ * внутри диапазона*/
+template <class value_type, class Allocator>
+void list<value_type, Allocator>::splice(const_iterator pos, list &other,
+                                         const_iterator first,
+                                         const_iterator last) {
+  if (first != last) {
+    size_type count = 0;
+    if (this != &other) {
+      for (const_iterator it = first; it != last; ++it) count++;
     }
-    //  схлапывание листа other
-    other.head_ = other_pNext;
-    other.size_--;
-    other.fake_->data_--;
+    Transfer(pos.getNode(), other, first.getNode(), last.getNode(), count);
   }
 }
 
-/* меняет содержимое*/
-template <class value_type>
-void list<value_type>::swap(list &other) {
-  std::swap(head_, other.head_);
-  std::swap(fake_, other.fake_);
-  std::swap(size_, other.size_);
+/* меняет содержимое; аллокаторы меняются, только если этого требует
+ * propagate_on_container_swap*/
+template <class value_type, class Allocator>
+void list<value_type, Allocator>::swap(list &other) noexcept {
+  SwapNodes(other);
+  if constexpr (AllocTraits::propagate_on_container_swap::value) {
+    std::swap(alloc_, other.alloc_);
+  }
 }
 
 /*уникальный*/
-template <class value_type>
-void list<value_type>::unique() {
+template <class value_type, class Allocator>
+void list<value_type, Allocator>::unique() {
   if (size_ > 1) {
-    Node *first = head_;
-    for (; first != fake_;) {
-      Node *second = first->pNext_;
-      if (second != fake_) {
-        if (first->data_ == second->data_) {
+    NodeBase *first = fake_.pNext_;
+    for (; first != &fake_;) {
+      NodeBase *second = first->pNext_;
+      if (second != &fake_) {
+        if (AsNode(first)->data_ == AsNode(second)->data_) {
           RemoveNode(second);
         } else {
           first = first->pNext_;
@@ -539,46 +520,34 @@ void list<value_type>::unique() {
 }
 
 /*сортировка*/
-template <class value_type>
-void list<value_type>::sort() {
-  bool return_sort = false;
+template <class value_type, class Allocator>
+void list<value_type, Allocator>::sort() {
+  sort(std::less<value_type>());
+}
+
+/*Устойчивая восходящая сортировка слиянием перевешиванием узлов, см.
+ * ListLinks::Sort. Если comp бросит, узлы остаются в списке в
+ * произвольном порядке, как у std::list::sort*/
+template <class value_type, class Allocator>
+template <class Compare>
+void list<value_type, Allocator>::sort(Compare comp) {
   if (size_ > 1) {
-    Node *node1_start = head_;
-    Node *node = head_->pNext_;
-    bool sublist1 = true;
-    while (node != fake_) {
-      if (node->data_ < node->pPrev_->data_) {
-        if (!sublist1) {
-          sublist1 = true;
-          node = node->pNext_;
-        } else {
-          Node *node2_start = node;
-          MergeSort(&node1_start, &node2_start);
-          if (node1_start != fake_) return_sort = true;
-          sublist1 = false;
-          node = node1_start;
-        }
-      } else {
-        node = node->pNext_;
-      }
-    }
+    Links::Sort(fake_, [&comp](NodeBase *a, NodeBase *b) {
+      return comp(AsNode(a)->data_, AsNode(b)->data_);
+    });
   }
-  if (return_sort) sort();
 }
 
 /*заменить узел*/
-template <class value_type>
-void list<value_type>::replace_node(Node &first, Node &second) {
-  Node *tmp = new Node;
-  tmp->data = first.data_;
-  first.data_ = second.data_;
-  second.data_ = tmp->data_;
+template <class value_type, class Allocator>
+void list<value_type, Allocator>::replace_node(Node &first, Node &second) {
+  std::swap(first.data_, second.data_);
 }
 
 /*устанавливать back*/
-template <class value_type>
+template <class value_type, class Allocator>
 template <class... Args>
-void list<value_type>::emplace_back(Args &&...args) {
+void list<value_type, Allocator>::emplace_back(Args &&...args) {
   std::vector<value_type> arguments = {args...};
   for (auto &a : arguments) {
     push_back(a);
@@ -586,9 +555,9 @@ void list<value_type>::emplace_back(Args &&...args) {
 }
 
 /*устанавливать front*/
-template <class value_type>
+template <class value_type, class Allocator>
 template <class... Args>
-void list<value_type>::emplace_front(Args &&...args) {
+void list<value_type, Allocator>::emplace_front(Args &&...args) {
   std::vector<value_type> arguments = {args...};
   for (auto &a : arguments) {
     push_front(a);
@@ -596,9 +565,10 @@ void list<value_type>::emplace_front(Args &&...args) {
 }
 
 /*emplace*/
-template <class value_type>
+template <class value_type, class Allocator>
 template <class... Args>
-typename list<value_type>::iterator list<value_type>::emplace(
+typename list<value_type, Allocator>::iterator
+list<value_type, Allocator>::emplace(
     const_iterator pos, Args &&...args) {
   std::vector<value_type> arguments = {args...};
   iterator res;
@@ -608,8 +578,8 @@ typename list<value_type>::iterator list<value_type>::emplace(
   return res;
 }
 
-template <class value_type>
-void list<value_type>::PrintList() {
+template <class value_type, class Allocator>
+void list<value_type, Allocator>::PrintList() {
   std::cout << "size of lise: " << size_ << std::endl;
   for (iterator i = begin(); i != end(); ++i) {
     std::cout << *i << " ";
@@ -1,61 +1,90 @@
 #ifndef SRC_S21_LIST_H_
 #define SRC_S21_LIST_H_
 
+#include <functional>
 #include <initializer_list>
 #include <iostream>
-#include <limits>
+#include <memory>
 #include <vector>
 
+#include "s21_list_links.h"
+#include "s21_node_pool.h"
+
 namespace s21 {
 
-template <typename T>
+// Узлы с данными выделяются аллокатором, полученным из Allocator через
+// rebind на тип узла. Фиктивный узел без данных лежит в самом списке, так
+// что пустой список ничего не выделяет, а value_type не обязан быть числом
+template <typename T, typename Allocator = pool_allocator<T>>
 class list {
+ public:
+  typedef Allocator allocator_type;
+
  private:
   typedef T value_type;
   typedef T &reference;
   typedef const T &const_reference;
   typedef size_t size_type;
 
-  struct Node {
+  struct NodeBase {
+    NodeBase *pPrev_;
+    NodeBase *pNext_;
+  };
+
+  struct Node : NodeBase {
     value_type data_;
-    Node *pPrev_;
-    Node *pNext_;
   };
 
-  int size_;
-  Node *head_;
-  Node *fake_;
-  void CreateFake();
-  void IncreaseSize();
-  void ReferenceToFake();
-  void InsertNodeFront(Node *node);
-  void InsertNodeBack(Node *node);
-  void InsertNodeBeforeCurrent(Node *new_node, Node *current_node);
-  void InsertFront(Node *node);
-  void InsertBack(Node *node);
-  void InsertBeforeCurrent(Node *new_node, Node *current_node);
-  void MoveNodeFront(Node *moving_node);
-  void MoveNodeBeforeCurrentFromRightToLeft(Node *moving_node,
-                                            Node *current_node);
-  void MergeSort(Node **node1_start, Node **node2_start);
-  void RemoveNode(Node *node);
+  typedef ListLinks<NodeBase> Links;
+
+  typedef std::allocator_traits<allocator_type> AllocTraits;
+  typedef typename AllocTraits::template rebind_alloc<Node> NodeAllocator;
+  typedef std::allocator_traits<NodeAllocator> NodeTraits;
+
+ public:
+  // аллокатор узлов, по нему s21::node_pool_stats находит статистику
+  typedef NodeAllocator node_allocator_type;
+
+ private:
+  // перемещающее присваивание всегда забирает узлы, не копируя элементы
+  static constexpr bool kMoveAssignSteals =
+      AllocTraits::propagate_on_container_move_assignment::value ||
+      AllocTraits::is_always_equal::value;
+
+  size_type size_;
+  NodeBase fake_;
+  NodeAllocator alloc_;
+  static Node *AsNode(NodeBase *node);
+  template <typename... Args>
+  Node *CreateNode(Args &&...args);
+  void DestroyNode(Node *node);
+  void SwapNodes(list &other) noexcept;
+  void InsertBeforeCurrent(NodeBase *new_node, NodeBase *current_node);
+  void Transfer(NodeBase *pos, list &other, NodeBase *first, NodeBase *last,
+                size_type count);
+  void RemoveNode(NodeBase *node);
 
  public:
   list();
-  list(size_type n);
-  list(size_type n, value_type x);
-  list(std::initializer_list<value_type> const &items);
+  explicit list(const Allocator &alloc);
+  list(size_type n, const Allocator &alloc = Allocator());
+  list(size_type n, value_type x, const Allocator &alloc = Allocator());
+  list(std::initializer_list<value_type> const &items,
+       const Allocator &alloc = Allocator());
   list(const list &l);
-  list(list &&l);
+  list(const list &l, const Allocator &alloc);
+  list(list &&l) noexcept;
   ~list();
 
+  allocator_type get_allocator() const;
+
   typedef class ListIterator {
    protected:
-    Node *iter_;
+    NodeBase *iter_;
 
    public:
     ListIterator();
-    ListIterator(Node *iter);
+    ListIterator(NodeBase *iter);
     ListIterator(const ListIterator &other) = default;
     ListIterator &operator=(const ListIterator &other);
     reference operator*();
@@ -63,7 +92,7 @@ class list {
     ListIterator &operator--();
     bool operator==(const ListIterator &other) const;
     bool operator!=(const ListIterator &other) const;
-    Node *getNode() const;
+    NodeBase *getNode() const;
   } iterator;
   iterator begin();
   iterator end();
@@ -71,7 +100,7 @@ class list {
   typedef class ListConstIterator : public ListIterator {
    public:
     ListConstIterator();
-    ListConstIterator(Node *iter);
+    ListConstIterator(NodeBase *iter);
     ListConstIterator(const ListConstIterator &other) = default;
     ListConstIterator &operator=(const ListConstIterator &other);
     const_reference operator*();
@@ -83,7 +112,8 @@ class list {
   const_iterator cbegin() const;
   const_iterator cend() const;
 
-  list<value_type> &operator=(list &&l);
+  list &operator=(const list &l);
+  list &operator=(list &&l) noexcept(kMoveAssignSteals);
 
   void pop_front();
   void pop_back();
@@ -98,11 +128,22 @@ class list {
   iterator insert(iterator pos, const_reference value);
   void erase(iterator pos);
   size_type max_size();
+  // merge и sort устойчивы и только перевешивают узлы: merge за
+  // O(size() + other.size()), sort — восходящее слияние за O(n log n)
   void merge(list &other);
+  template <class Compare>
+  void merge(list &other, Compare comp);
+  // splice перевешивает узлы без копирования: O(1), кроме диапазона из
+  // другого списка, где его длина считается один раз
   void splice(const_iterator pos, list &other);
-  void swap(list &other);
+  void splice(const_iterator pos, list &other, const_iterator it);
+  void splice(const_iterator pos, list &other, const_iterator first,
+              const_iterator last);
+  void swap(list &other) noexcept;
   void unique();
   void sort();
+  template <class Compare>
+  void sort(Compare comp);
   void swap_move(list &&other);
   void replace_node(Node &first, Node &second);
 
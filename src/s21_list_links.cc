@@ -0,0 +1,165 @@
+#ifndef SRC_S21_LIST_LINKS_CC_
+#define SRC_S21_LIST_LINKS_CC_
+
+#include "s21_list_links.h"
+
+namespace s21 {
+
+template <typename Node>
+void ListLinks<Node>::Reset(Node &fake) noexcept {
+  fake.pNext_ = fake.pPrev_ = &fake;
+}
+
+// вернуть крайние узлы на фиктивный после того, как его связи скопированы
+// из другого кольца
+template <typename Node>
+void ListLinks<Node>::Relink(Node &fake, bool empty) noexcept {
+  if (empty) {
+    Reset(fake);
+  } else {
+    fake.pNext_->pPrev_ = &fake;
+    fake.pPrev_->pNext_ = &fake;
+  }
+}
+
+// пустое кольцо узнаётся по фиктивному узлу, замкнутому на себя
+template <typename Node>
+void ListLinks<Node>::Swap(Node &first, Node &second) noexcept {
+  bool first_empty = first.pNext_ == &first;
+  bool second_empty = second.pNext_ == &second;
+  std::swap(first.pPrev_, second.pPrev_);
+  std::swap(first.pNext_, second.pNext_);
+  Relink(first, second_empty);
+  Relink(second, first_empty);
+}
+
+// Отцепить узлы от фиктивного: цепочка по pNext_ до nullptr, кольцо
+// остаётся пустым
+template <typename Node>
+Node *ListLinks<Node>::Detach(Node &fake) noexcept {
+  Node *chain = nullptr;
+  if (fake.pNext_ != &fake) {
+    chain = fake.pNext_;
+    fake.pPrev_->pNext_ = nullptr;
+  }
+  Reset(fake);
+  return chain;
+}
+
+// повесить цепочку по pNext_ в пустое кольцо, восстановив pPrev_
+template <typename Node>
+void ListLinks<Node>::Attach(Node &fake, Node *chain) noexcept {
+  Node *prev = &fake;
+  for (Node *node = chain; node; node = node->pNext_) {
+    node->pPrev_ = prev;
+    prev = node;
+  }
+  prev->pNext_ = &fake;
+  fake.pPrev_ = prev;
+  fake.pNext_ = chain ? chain : &fake;
+}
+
+// Перевесить узлы [first, last) перед pos, в том же кольце или в другом:
+// шесть указателей, pos не должен лежать внутри диапазона
+template <typename Node>
+void ListLinks<Node>::Transfer(Node *pos, Node *first, Node *last) noexcept {
+  Node *tail = last->pPrev_;
+  first->pPrev_->pNext_ = last;
+  last->pPrev_ = first->pPrev_;
+
+  first->pPrev_ = pos->pPrev_;
+  tail->pNext_ = pos;
+  pos->pPrev_->pNext_ = first;
+  pos->pPrev_ = tail;
+}
+
+// Слить упорядоченные кольца в fake, other пустеет. Если less бросит, все
+// узлы обоих колец остаются в fake в произвольном порядке
+template <typename Node>
+template <class Less>
+void ListLinks<Node>::Merge(Node &fake, Node &other, Less less) {
+  Node *mine = Detach(fake);
+  Node *theirs = Detach(other);
+  try {
+    Attach(fake, MergeRuns(mine, theirs, less));
+  } catch (...) {
+    Attach(fake, mine);
+    throw;
+  }
+}
+
+// Восходящая сортировка слиянием: bins[i] пуст или хранит упорядоченную
+// цепочку из 2^i узлов. Очередной узел сливается с занятыми младшими
+// корзинами, как перенос при прибавлении единицы, поэтому каждый узел
+// проходит не больше log n слияний. В старшей корзине узлы из начала
+// кольца, она всегда идёт первым аргументом, и сортировка устойчива. Если
+// less бросит, узлы из корзин, run и node возвращаются в кольцо в
+// произвольном порядке, как у std::list::sort
+template <typename Node>
+template <class Less>
+void ListLinks<Node>::Sort(Node &fake, Less less) {
+  Node *bins[std::numeric_limits<size_t>::digits] = {};
+  Node *node = Detach(fake);
+  Node *run = nullptr;
+  try {
+    while (node) {
+      run = node;
+      node = node->pNext_;
+      run->pNext_ = nullptr;
+      size_t i = 0;
+      for (; bins[i]; ++i) run = MergeRuns(bins[i], run, less);
+      bins[i] = run;
+      run = nullptr;
+    }
+    for (Node *&bin : bins) {
+      if (bin) run = MergeRuns(bin, run, less);
+    }
+  } catch (...) {
+    for (Node *bin : bins) run = Concat(bin, run);
+    Attach(fake, Concat(run, node));
+    throw;
+  }
+  Attach(fake, run);
+}
+
+// дописать цепочку second в конец цепочки first
+template <typename Node>
+Node *ListLinks<Node>::Concat(Node *first, Node *second) noexcept {
+  if (!first) return second;
+  Node *last = first;
+  while (last->pNext_) last = last->pNext_;
+  last->pNext_ = second;
+  return first;
+}
+
+// Слить две упорядоченные цепочки по pNext_. При равенстве первым идёт
+// узел из first, поэтому слияние устойчиво. Если less бросит, все узлы
+// обеих цепочек в произвольном порядке остаются в first, second пуст
+template <typename Node>
+template <class Less>
+Node *ListLinks<Node>::MergeRuns(Node *&first, Node *&second, Less &less) {
+  Node *result = nullptr;
+  Node **tail = &result;
+  try {
+    while (first && second) {
+      if (less(second, first)) {
+        *tail = second;
+        second = second->pNext_;
+      } else {
+        *tail = first;
+        first = first->pNext_;
+      }
+      tail = &(*tail)->pNext_;
+    }
+  } catch (...) {
+    *tail = Concat(first, second);
+    first = result;
+    second = nullptr;
+    throw;
+  }
+  *tail = first ? first : second;
+  first = second = nullptr;
+  return result;
+}
+}  // namespace s21
+#endif  // SRC_S21_LIST_LINKS_CC_
@@ -0,0 +1,36 @@
+#ifndef SRC_S21_LIST_LINKS_H_
+#define SRC_S21_LIST_LINKS_H_
+
+#include <cstddef>
+#include <limits>
+#include <utility>
+
+namespace s21 {
+
+// Операции над связями двусвязного кольца с фиктивным узлом, общие для
+// list и intrusive_list. Node — тип с полями pPrev_ и pNext_: NodeBase
+// списка или крюк intrusive_list. Двигаются только указатели, размер
+// ведёт сам список. Less сравнивает узлы: less(a, b) — a строго меньше b
+template <typename Node>
+struct ListLinks {
+  // пустой фиктивный узел замкнут сам на себя
+  static void Reset(Node &fake) noexcept;
+  // поменять кольца местами вместе с фиктивными связями
+  static void Swap(Node &first, Node &second) noexcept;
+  static Node *Detach(Node &fake) noexcept;
+  static void Attach(Node &fake, Node *chain) noexcept;
+  static void Transfer(Node *pos, Node *first, Node *last) noexcept;
+  template <class Less>
+  static void Merge(Node &fake, Node &other, Less less);
+  template <class Less>
+  static void Sort(Node &fake, Less less);
+
+ private:
+  static void Relink(Node &fake, bool empty) noexcept;
+  static Node *Concat(Node *first, Node *second) noexcept;
+  template <class Less>
+  static Node *MergeRuns(Node *&first, Node *&second, Less &less);
+};
+}  // namespace s21
+#include "s21_list_links.cc"
+#endif  // SRC_S21_LIST_LINKS_H_
@@ -4,38 +4,47 @@
 
 namespace s21 {
 
-template <typename Key, typename T>
-map<Key, T>::map() : size_(0) {
-  fake_ = new Node({key_type(), mapped_type()});
-  fake_->left_ = fake_->right_ = fake_;
-}
+template <typename Key, typename T, typename Allocator>
+map<Key, T, Allocator>::map() : map(Allocator()) {}
+
+template <typename Key, typename T, typename Allocator>
+map<Key, T, Allocator>::map(const Allocator &alloc)
+    : size_(0), fake_(nullptr), alloc_(alloc) {}
 
-template <typename Key, typename T>
-map<Key, T>::map(std::initializer_list<value_type> const &items) : map() {
+template <typename Key, typename T, typename Allocator>
+map<Key, T, Allocator>::map(std::initializer_list<value_type> const &items,
+                            const Allocator &alloc)
+    : map(alloc) {
   for (const_reference val : items) insert(val);
 }
 
-template <typename Key, typename T>
-map<Key, T>::map(const map &m) : map() {
-  if (this != &m) {
-    if (m.size_) {
-      Node *new_node = nullptr;
-      Node *m_node = m.fake_->parent_;
-      const Node *m_fake = m.fake_;
-      fake_->parent_ = CopyAll(m_node, m_fake, new_node);
-      size_ = m.size_;
-    }
+template <typename Key, typename T, typename Allocator>
+map<Key, T, Allocator>::map(const map &m)
+    : map(m, AllocTraits::select_on_container_copy_construction(
+                 m.get_allocator())) {}
+
+// копия m, узлы которой выделяет alloc
+template <typename Key, typename T, typename Allocator>
+map<Key, T, Allocator>::map(const map &m, const Allocator &alloc)
+    : map(alloc) {
+  if (m.size_) {
+    CreateFake();
+    Node *new_node = nullptr;
+    Node *m_node = m.fake_->parent_;
+    const Node *m_fake = m.fake_;
+    fake_->parent_ = CopyAll(m_node, m_fake, new_node);
+    size_ = m.size_;
   }
 }
 
-template <typename Key, typename T>
-typename map<Key, T>::Node *map<Key, T>::CopyAll(Node *&m_node,
-                                                 const Node *&m_fake,
-                                                 Node *node) {
+template <typename Key, typename T, typename Allocator>
+typename map<Key, T, Allocator>::Node *
+map<Key, T, Allocator>::CopyAll(Node *&m_node, const Node *&m_fake,
+                                Node *node) {
   if (!m_node) return nullptr;
   if (m_node == m_fake) return fake_;
   Node *parent = node;
-  node = new Node(m_node->data_);
+  node = CreateNode(m_node->data_);
   node->left_ = CopyAll(m_node->left_, m_fake, node);
   if (node->left_ == fake_) {
     fake_->left_ = node;
@@ -48,56 +57,145 @@ typename map<Key, T>::Node *map<Key, T>::CopyAll(Node *&m_node,
   return node;
 }
 
-template <typename Key, typename T>
-map<Key, T>::map(map &&m) : map() {
-  if (this != &m) swap(m);
+// дерево m забирается за O(1) обменом указателей, m остаётся без
+// фиктивного узла и ничего не выделяется
+template <typename Key, typename T, typename Allocator>
+map<Key, T, Allocator>::map(map &&m) noexcept : map(m.get_allocator()) {
+  SwapTrees(m);
 }
 
-template <typename Key, typename T>
-map<Key, T>::~map() {
+template <typename Key, typename T, typename Allocator>
+map<Key, T, Allocator>::~map() {
   clear();
-  delete fake_;
+  DestroyNode(fake_);
 }
 
-template <typename Key, typename T>
-void map<Key, T>::operator=(map &&m) {
+// копирующее присваивание через copy-and-swap; копия строится на том
+// аллокаторе, который останется у map после присваивания
+template <typename Key, typename T, typename Allocator>
+map<Key, T, Allocator> &map<Key, T, Allocator>::operator=(const map &m) {
   if (this != &m) {
-    clear();
-    swap(m);
+    if constexpr (AllocTraits::propagate_on_container_copy_assignment::value) {
+      map tmp(m, m.get_allocator());
+      SwapTrees(tmp);
+      std::swap(alloc_, tmp.alloc_);
+    } else {
+      map tmp(m, get_allocator());
+      SwapTrees(tmp);
+    }
+  }
+  return *this;
+}
+
+// узлы из чужого неравного аллокатора забрать нельзя, тогда элементы
+// перемещаются по одному в новые узлы
+template <typename Key, typename T, typename Allocator>
+map<Key, T, Allocator> &map<Key, T, Allocator>::operator=(map &&m) noexcept(
+    kMoveAssignSteals) {
+  if (this != &m) {
+    if constexpr (AllocTraits::propagate_on_container_move_assignment::value) {
+      map tmp(std::move(m));
+      SwapTrees(tmp);
+      std::swap(alloc_, tmp.alloc_);
+    } else if (kMoveAssignSteals || alloc_ == m.alloc_) {
+      map tmp(std::move(m));
+      SwapTrees(tmp);
+    } else {
+      map tmp(get_allocator());
+      for (iterator it = m.begin(); it != m.end(); ++it) {
+        tmp.insert(std::move(*it));
+      }
+      SwapTrees(tmp);
+      m.clear();
+    }
+  }
+  return *this;
+}
+
+template <typename Key, typename T, typename Allocator>
+typename map<Key, T, Allocator>::allocator_type
+map<Key, T, Allocator>::get_allocator() const {
+  return allocator_type(alloc_);
+}
+
+// узел целиком строится аллокатором узлов
+template <typename Key, typename T, typename Allocator>
+template <typename... Args>
+typename map<Key, T, Allocator>::Node *map<Key, T, Allocator>::CreateNode(
+    Args &&...args) {
+  Node *node = NodeTraits::allocate(alloc_, 1);
+  try {
+    NodeTraits::construct(alloc_, node, std::forward<Args>(args)...);
+  } catch (...) {
+    NodeTraits::deallocate(alloc_, node, 1);
+    throw;
+  }
+  return node;
+}
+
+template <typename Key, typename T, typename Allocator>
+void map<Key, T, Allocator>::DestroyNode(Node *node) {
+  if (node) {
+    NodeTraits::destroy(alloc_, node);
+    NodeTraits::deallocate(alloc_, node, 1);
+  }
+}
+
+// фиктивный узел: parent_ — корень, left_ и right_ — крайние узлы
+template <typename Key, typename T, typename Allocator>
+void map<Key, T, Allocator>::CreateFake() {
+  if (!fake_) {
+    fake_ = CreateNode(value_type{key_type(), mapped_type()});
+    fake_->left_ = fake_->right_ = fake_;
   }
 }
 
-template <typename Key, typename T>
-map<Key, T>::Node::Node(value_type data, Node *parent)
-    : data_{data}, parent_{parent}, left_{nullptr}, right_{nullptr} {}
+// меняет местами деревья, аллокаторы остаются на месте
+template <typename Key, typename T, typename Allocator>
+void map<Key, T, Allocator>::SwapTrees(map &other) noexcept {
+  std::swap(fake_, other.fake_);
+  std::swap(size_, other.size_);
+}
 
-template <typename Key, typename T>
-map<Key, T>::MapIterator::MapIterator() : obj_{nullptr}, iter_{nullptr} {}
+template <typename Key, typename T, typename Allocator>
+template <typename Value>
+map<Key, T, Allocator>::Node::Node(Value &&data, Node *parent)
+    : data_{std::forward<Value>(data)},
+      parent_{parent},
+      left_{nullptr},
+      right_{nullptr} {}
 
-template <typename Key, typename T>
-map<Key, T>::MapIterator::MapIterator(Node *&iter, const map &obj)
+template <typename Key, typename T, typename Allocator>
+map<Key, T, Allocator>::MapIterator::MapIterator()
+    : obj_{nullptr}, iter_{nullptr} {}
+
+template <typename Key, typename T, typename Allocator>
+map<Key, T, Allocator>::MapIterator::MapIterator(Node *&iter, const map &obj)
     : obj_{&obj}, iter_{iter} {}
 
-template <typename Key, typename T>
-typename map<Key, T>::MapIterator &map<Key, T>::iterator::operator=(
-    const MapIterator &other) {
+template <typename Key, typename T, typename Allocator>
+typename map<Key, T, Allocator>::MapIterator &
+map<Key, T, Allocator>::iterator::operator=(const MapIterator &other) {
   this->iter_ = other.iter_;
   this->obj_ = other.obj_;
   return *this;
 }
 
-template <typename Key, typename T>
-typename map<Key, T>::reference map<Key, T>::iterator::operator*() {
+template <typename Key, typename T, typename Allocator>
+typename map<Key, T, Allocator>::reference
+map<Key, T, Allocator>::iterator::operator*() {
   return iter_->data_;
 }
 
-template <typename Key, typename T>
-typename map<Key, T>::value_type *map<Key, T>::iterator::operator->() {
+template <typename Key, typename T, typename Allocator>
+typename map<Key, T, Allocator>::value_type *
+map<Key, T, Allocator>::iterator::operator->() {
   return &operator*();
 }
 
-template <typename Key, typename T>
-typename map<Key, T>::MapIterator &map<Key, T>::iterator::operator++() {
+template <typename Key, typename T, typename Allocator>
+typename map<Key, T, Allocator>::MapIterator &
+map<Key, T, Allocator>::iterator::operator++() {
   if (iter_->right_) {
     iter_ = iter_->right_;
     while (iter_ != obj_->fake_ && iter_->left_) iter_ = iter_->left_;
@@ -111,15 +209,17 @@ typename map<Key, T>::MapIterator &map<Key, T>::iterator::operator++() {
   return *this;
 }
 
-template <typename Key, typename T>
-typename map<Key, T>::MapIterator map<Key, T>::iterator::operator++(int) {
+template <typename Key, typename T, typename Allocator>
+typename map<Key, T, Allocator>::MapIterator
+map<Key, T, Allocator>::iterator::operator++(int) {
   iterator tmp(*this);
   operator++();
   return tmp;
 }
 
-template <typename Key, typename T>
-typename map<Key, T>::MapIterator &map<Key, T>::iterator::operator--() {
+template <typename Key, typename T, typename Allocator>
+typename map<Key, T, Allocator>::MapIterator &
+map<Key, T, Allocator>::iterator::operator--() {
   if (iter_ == obj_->fake_) {
     iter_ = obj_->fake_->right_;
   } else if (iter_->left_) {
@@ -137,100 +237,115 @@ typename map<Key, T>::MapIterator &map<Key, T>::iterator::operator--() {
   return *this;
 }
 
-template <typename Key, typename T>
-bool map<Key, T>::iterator::operator==(const MapIterator &other) const {
+template <typename Key, typename T, typename Allocator>
+bool map<Key, T, Allocator>::iterator::operator==(
+    const MapIterator &other) const {
   return iter_ == other.iter_;
 }
 
-template <typename Key, typename T>
-bool map<Key, T>::iterator::operator!=(const MapIterator &other) const {
+template <typename Key, typename T, typename Allocator>
+bool map<Key, T, Allocator>::iterator::operator!=(
+    const MapIterator &other) const {
   return iter_ != other.iter_;
 }
 
-template <typename Key, typename T>
-typename map<Key, T>::iterator map<Key, T>::begin() {
+template <typename Key, typename T, typename Allocator>
+typename map<Key, T, Allocator>::iterator map<Key, T, Allocator>::begin() {
   if (!empty()) return iterator(fake_->left_, *this);
   return end();
 }
 
-template <typename Key, typename T>
-typename map<Key, T>::iterator map<Key, T>::end() {
+template <typename Key, typename T, typename Allocator>
+typename map<Key, T, Allocator>::iterator map<Key, T, Allocator>::end() {
   return iterator(this->fake_, *this);
 }
 
-template <typename Key, typename T>
-typename map<Key, T>::mapped_type &map<Key, T>::at(const key_type &key) {
+template <typename Key, typename T, typename Allocator>
+typename map<Key, T, Allocator>::mapped_type &
+map<Key, T, Allocator>::at(const key_type &key) {
   if (size_) {
     Child child = Child::LEFT_CHILD;
-    std::pair<bool, Node *> res_pair =
-        FindPosToInsert(Root(), std::make_pair(key, mapped_type()), child);
+    std::pair<bool, Node *> res_pair = FindPosToInsert(Root(), key, child);
     if (!res_pair.first) return res_pair.second->GetValue();
   }
   throw std::out_of_range("Out of range");
 }
 
-template <typename Key, typename T>
-typename map<Key, T>::mapped_type &map<Key, T>::operator[](
-    const key_type &key) {
+template <typename Key, typename T, typename Allocator>
+typename map<Key, T, Allocator>::mapped_type &
+map<Key, T, Allocator>::operator[](const key_type &key) {
   return insert(std::make_pair(key, mapped_type())).first->second;
 }
 
-template <typename Key, typename T>
-bool map<Key, T>::empty() const {
+template <typename Key, typename T, typename Allocator>
+bool map<Key, T, Allocator>::empty() const {
   return !size_;
 }
 
-template <typename Key, typename T>
-typename map<Key, T>::size_type map<Key, T>::size() const {
+template <typename Key, typename T, typename Allocator>
+typename map<Key, T, Allocator>::size_type
+map<Key, T, Allocator>::size() const {
   return size_;
 }
 
-template <typename Key, typename T>
-typename map<Key, T>::size_type map<Key, T>::max_size() const {
-  return std::numeric_limits<int64_t>::max() / sizeof(Node);
+template <typename Key, typename T, typename Allocator>
+typename map<Key, T, Allocator>::size_type
+map<Key, T, Allocator>::max_size() const {
+  return NodeTraits::max_size(alloc_);
 }
 
-template <typename Key, typename T>
-void map<Key, T>::clear() {
-  DeleteAll(fake_->parent_);
+template <typename Key, typename T, typename Allocator>
+void map<Key, T, Allocator>::clear() {
+  if (fake_) {
+    DeleteAll(fake_->parent_);
+    fake_->parent_ = fake_->left_ = fake_->right_ = nullptr;
+  }
   size_ = 0;
-  fake_->parent_ = fake_->left_ = fake_->right_ = nullptr;
 }
 
-template <typename Key, typename T>
-void map<Key, T>::DeleteAll(Node *node) {
+template <typename Key, typename T, typename Allocator>
+void map<Key, T, Allocator>::DeleteAll(Node *node) {
   if (!node || node == fake_) return;
   DeleteAll(node->left_);
   DeleteAll(node->right_);
-  delete node;
+  DestroyNode(node);
 }
 
-template <typename Key, typename T>
-std::pair<typename map<Key, T>::iterator, bool> map<Key, T>::insert(
-    const_reference value) {
+template <typename Key, typename T, typename Allocator>
+std::pair<typename map<Key, T, Allocator>::iterator, bool>
+map<Key, T, Allocator>::insert(const_reference value) {
   return UniversalInsert(value, false);
 }
 
-template <typename Key, typename T>
-std::pair<typename map<Key, T>::iterator, bool> map<Key, T>::insert(
-    const key_type &key, const mapped_type &obj) {
-  return insert(std::make_pair(key, obj));
+template <typename Key, typename T, typename Allocator>
+std::pair<typename map<Key, T, Allocator>::iterator, bool>
+map<Key, T, Allocator>::insert(value_type &&value) {
+  return UniversalInsert(std::move(value), false);
+}
+
+template <typename Key, typename T, typename Allocator>
+std::pair<typename map<Key, T, Allocator>::iterator, bool>
+map<Key, T, Allocator>::insert(const key_type &key,
+                               const mapped_type &obj) {
+  return insert(value_type(key, obj));
 }
 
-template <typename Key, typename T>
-std::pair<typename map<Key, T>::iterator, bool> map<Key, T>::insert_or_assign(
-    const key_type &key, const mapped_type &obj) {
+template <typename Key, typename T, typename Allocator>
+std::pair<typename map<Key, T, Allocator>::iterator, bool>
+map<Key, T, Allocator>::insert_or_assign(const key_type &key,
+                                         const mapped_type &obj) {
   return UniversalInsert(std::make_pair(key, obj), true);
 }
 
-template <typename Key, typename T>
-std::pair<bool, typename map<Key, T>::Node *> map<Key, T>::FindPosToInsert(
-    Node *node, const_reference value, map<Key, T>::Child &child) {
-  key_type key = node->GetKey();
-  if (value.first == key) {
+template <typename Key, typename T, typename Allocator>
+std::pair<bool, typename map<Key, T, Allocator>::Node *>
+map<Key, T, Allocator>::FindPosToInsert(
+    Node *node, const key_type &key, map<Key, T, Allocator>::Child &child) {
+  const key_type &node_key = node->GetKey();
+  if (key == node_key) {
     return {false, node};
   }
-  if (value.first < key) {
+  if (key < node_key) {
     if (!node->left_ || node->left_ == fake_) {
       return {true, node};
     }
@@ -242,20 +357,22 @@ std::pair<bool, typename map<Key, T>::Node *> map<Key, T>::FindPosToInsert(
     }
     node = node->right_;
   }
-  return FindPosToInsert(node, value, child);
+  return FindPosToInsert(node, key, child);
 }
 
-template <typename Key, typename T>
-void map<Key, T>::InsertToBlank(Node *&new_node) {
+template <typename Key, typename T, typename Allocator>
+void map<Key, T, Allocator>::InsertToBlank(Node *&new_node) {
   new_node->left_ = new_node->right_ = fake_;
   Root() = fake_->left_ = fake_->right_ = new_node;
   ++size_;
 }
 
-template <typename Key, typename T>
-void map<Key, T>::InsertToNotBlank(Node *&node, const Child &child,
-                                   const_reference value) {
-  Node *new_node = new Node(value, node);
+template <typename Key, typename T, typename Allocator>
+template <typename Value>
+void map<Key, T, Allocator>::InsertToNotBlank(Node *&node,
+                                              const Child &child,
+                                              Value &&value) {
+  Node *new_node = CreateNode(std::forward<Value>(value), node);
   if (child == Child::LEFT_CHILD) {
     if (node == fake_->left_) {
       fake_->left_ = new_node;
@@ -273,11 +390,11 @@ void map<Key, T>::InsertToNotBlank(Node *&node, const Child &child,
   ++size_;
 }
 
-template <typename Key, typename T>
-void map<Key, T>::erase(iterator pos) {
+template <typename Key, typename T, typename Allocator>
+void map<Key, T, Allocator>::erase(iterator pos) {
   if (size_ == 1) {
     fake_->left_ = fake_->right_ = nullptr;
-    delete fake_->parent_;
+    DestroyNode(fake_->parent_);
     fake_->parent_ = nullptr;
     size_ = 0;
     return;
@@ -330,8 +447,8 @@ void map<Key, T>::erase(iterator pos) {
     DeleteNodeRight(node->parent_);
 }
 
-template <typename Key, typename T>
-void map<Key, T>::DeleteNodeLeft(Node *&node) {
+template <typename Key, typename T, typename Allocator>
+void map<Key, T, Allocator>::DeleteNodeLeft(Node *&node) {
   Node *child = node->left_;
   if (child->left_ == fake_) {
     fake_->left_ = node;
@@ -339,12 +456,12 @@ void map<Key, T>::DeleteNodeLeft(Node *&node) {
   } else {
     node->left_ = nullptr;
   }
-  delete child;
+  DestroyNode(child);
   --size_;
 }
 
-template <typename Key, typename T>
-void map<Key, T>::DeleteNodeRight(Node *&node) {
+template <typename Key, typename T, typename Allocator>
+void map<Key, T, Allocator>::DeleteNodeRight(Node *&node) {
   Node *child = node->right_;
   if (child->right_ == fake_) {
     fake_->right_ = node;
@@ -352,12 +469,12 @@ void map<Key, T>::DeleteNodeRight(Node *&node) {
   } else {
     node->right_ = nullptr;
   }
-  delete child;
+  DestroyNode(child);
   --size_;
 }
 
-template <typename Key, typename T>
-void map<Key, T>::SwapNodes(Node *&node1, Node *&node2) {
+template <typename Key, typename T, typename Allocator>
+void map<Key, T, Allocator>::SwapNodes(Node *&node1, Node *&node2) {
   if (node1->left_ == fake_ || node1->right_ == fake_) {
     if (node1->left_ == fake_) {
       node2->left_ = fake_;
@@ -374,80 +491,88 @@ void map<Key, T>::SwapNodes(Node *&node1, Node *&node2) {
   else
     node1->parent_->right_ = node2;
   node2->parent_ = node1->parent_;
-  delete node1;
+  DestroyNode(node1);
   --size_;
 }
 
-template <typename Key, typename T>
-std::pair<typename map<Key, T>::iterator, bool> map<Key, T>::UniversalInsert(
-    const_reference value, bool is_assign) {
+// value копируется или перемещается только в новый узел или при is_assign
+template <typename Key, typename T, typename Allocator>
+template <typename Value>
+std::pair<typename map<Key, T, Allocator>::iterator, bool>
+map<Key, T, Allocator>::UniversalInsert(Value &&value, bool is_assign) {
   if (size_) {
     Child child = Child::LEFT_CHILD;
-    std::pair<bool, Node *> res_pair = FindPosToInsert(Root(), value, child);
+    std::pair<bool, Node *> res_pair =
+        FindPosToInsert(Root(), value.first, child);
     bool res = res_pair.first;
     Node *node = res_pair.second;
     if (res) {
-      InsertToNotBlank(node, child, value);
+      InsertToNotBlank(node, child, std::forward<Value>(value));
     } else if (is_assign) {
-      node->GetValue() = value.second;
+      node->GetValue() = std::forward<Value>(value).second;
     }
     return {iterator(node, *this), res};
   } else {
-    Node *new_node = new Node(value);
+    CreateFake();
+    Node *new_node = CreateNode(std::forward<Value>(value));
     InsertToBlank(new_node);
     return {iterator(new_node, *this), true};
   }
 }
 
-template <typename Key, typename T>
-bool map<Key, T>::Node::IsNodeLeftChild() const {
+template <typename Key, typename T, typename Allocator>
+bool map<Key, T, Allocator>::Node::IsNodeLeftChild() const {
   if (!parent_) throw std::runtime_error("Parent is NULL");
   return this == parent_->left_;
 }
 
-template <typename Key, typename T>
-bool map<Key, T>::Node::IsNodeRightChild() const {
+template <typename Key, typename T, typename Allocator>
+bool map<Key, T, Allocator>::Node::IsNodeRightChild() const {
   return !IsNodeLeftChild();
 }
 
-template <typename Key, typename T>
-bool map<Key, T>::HasNodeLeftChild(Node *&node) const {
+template <typename Key, typename T, typename Allocator>
+bool map<Key, T, Allocator>::HasNodeLeftChild(Node *&node) const {
   return node->left_ && node->left_ != fake_;
 }
 
-template <typename Key, typename T>
-bool map<Key, T>::HasNodeRightChild(Node *&node) const {
+template <typename Key, typename T, typename Allocator>
+bool map<Key, T, Allocator>::HasNodeRightChild(Node *&node) const {
   return node->right_ && node->right_ != fake_;
 }
 
-template <typename Key, typename T>
-int map<Key, T>::HowMuchChildren(Node *&node) const {
+template <typename Key, typename T, typename Allocator>
+int map<Key, T, Allocator>::HowMuchChildren(Node *&node) const {
   return (HasNodeLeftChild(node) << 1) + HasNodeRightChild(node);
 }
 
-template <typename Key, typename T>
-typename map<Key, T>::Node *&map<Key, T>::Root() {
+template <typename Key, typename T, typename Allocator>
+typename map<Key, T, Allocator>::Node *&map<Key, T, Allocator>::Root() {
   return fake_->parent_;
 }
 
-template <typename Key, typename T>
-const typename map<Key, T>::key_type &map<Key, T>::Node::GetKey() const {
+template <typename Key, typename T, typename Allocator>
+const typename map<Key, T, Allocator>::key_type &
+map<Key, T, Allocator>::Node::GetKey() const {
   return data_.first;
 }
 
-template <typename Key, typename T>
-typename map<Key, T>::mapped_type &map<Key, T>::Node::GetValue() {
+template <typename Key, typename T, typename Allocator>
+typename map<Key, T, Allocator>::mapped_type &
+map<Key, T, Allocator>::Node::GetValue() {
   return data_.second;
 }
 
-template <typename Key, typename T>
-void map<Key, T>::swap(map &other) {
-  std::swap(fake_, other.fake_);
-  std::swap(size_, other.size_);
+template <typename Key, typename T, typename Allocator>
+void map<Key, T, Allocator>::swap(map &other) noexcept {
+  SwapTrees(other);
+  if constexpr (AllocTraits::propagate_on_container_swap::value) {
+    std::swap(alloc_, other.alloc_);
+  }
 }
 
-template <typename Key, typename T>
-void map<Key, T>::merge(map &other) {
+template <typename Key, typename T, typename Allocator>
+void map<Key, T, Allocator>::merge(map &other) {
   iterator other_it = other.begin();
   iterator other_it_end = other.end();
   while (other_it != other_it_end) {
@@ -460,15 +585,15 @@ void map<Key, T>::merge(map &other) {
   }
 }
 
-template <typename Key, typename T>
-bool map<Key, T>::contains(const key_type &key) const {
-  return ContainsKey(fake_->parent_, key);
+template <typename Key, typename T, typename Allocator>
+bool map<Key, T, Allocator>::contains(const key_type &key) const {
+  return size_ && ContainsKey(fake_->parent_, key);
 }
 
-template <typename Key, typename T>
+template <typename Key, typename T, typename Allocator>
 template <class... Args>
-std::vector<std::pair<typename map<Key, T>::iterator, bool>>
-map<Key, T>::emplace(Args &&...args) {
+std::vector<std::pair<typename map<Key, T, Allocator>::iterator, bool>>
+map<Key, T, Allocator>::emplace(Args &&...args) {
   std::vector<std::pair<iterator, bool>> result;
   std::vector<value_type> arguments = {args...};
   for (const auto &val : arguments) {
@@ -477,10 +602,11 @@ map<Key, T>::emplace(Args &&...args) {
   return result;
 }
 
-template <typename Key, typename T>
-bool map<Key, T>::ContainsKey(Node *node, const key_type &key) const {
+template <typename Key, typename T, typename Allocator>
+bool map<Key, T, Allocator>::ContainsKey(Node *node,
+                                         const key_type &key) const {
   if (!node || node == fake_) return false;
-  key_type this_key = node->GetKey();
+  const key_type &this_key = node->GetKey();
   if (key == this_key)
     return true;
   else if (key > this_key)
@@ -4,12 +4,21 @@
 #include <initializer_list>
 #include <iostream>
 #include <limits>
+#include <memory>
 #include <queue>
 
+#include "s21_node_pool.h"
+
 namespace s21 {
 
-template <typename Key, typename T>
+// Allocator выделяет память под std::pair<const Key, T>, узлы дерева
+// создаются аллокатором, полученным из него через rebind
+template <typename Key, typename T,
+          typename Allocator = pool_allocator<std::pair<const Key, T>>>
 class map {
+ public:
+  typedef Allocator allocator_type;
+
  private:
   typedef Key key_type;
   typedef T mapped_type;
@@ -21,7 +30,9 @@ class map {
 
   class Node {
    public:
-    Node(value_type data, Node *parent = nullptr);
+    // data пересылается прямо в data_: const-ключ копируется один раз
+    template <typename Value>
+    Node(Value &&data, Node *parent = nullptr);
     value_type data_;
     Node *parent_;
     Node *left_;
@@ -33,14 +44,37 @@ class map {
     bool IsNodeRightChild() const;
   };
 
+  typedef std::allocator_traits<allocator_type> AllocTraits;
+  typedef typename AllocTraits::template rebind_alloc<Node> NodeAllocator;
+  typedef std::allocator_traits<NodeAllocator> NodeTraits;
+
+ public:
+  // аллокатор узлов, по нему s21::node_pool_stats находит статистику
+  typedef NodeAllocator node_allocator_type;
+
+ private:
+  // перемещающее присваивание всегда забирает узлы, не копируя элементы
+  static constexpr bool kMoveAssignSteals =
+      AllocTraits::propagate_on_container_move_assignment::value ||
+      AllocTraits::is_always_equal::value;
+
   int size_;
+  // фиктивный узел создаётся при первой вставке: пустой и перемещённый
+  // map ничего не держат
   Node *fake_;
+  NodeAllocator alloc_;
 
+  template <typename... Args>
+  Node *CreateNode(Args &&...args);
+  void CreateFake();
+  void DestroyNode(Node *node);
+  void SwapTrees(map &other) noexcept;
   Node *&Root();
-  std::pair<bool, Node *> FindPosToInsert(Node *node, const_reference value,
+  std::pair<bool, Node *> FindPosToInsert(Node *node, const key_type &key,
                                           Child &child = Child::LEFT_CHILD);
   void InsertToBlank(Node *&new_node);
-  void InsertToNotBlank(Node *&node, const Child &child, const_reference value);
+  template <typename Value>
+  void InsertToNotBlank(Node *&node, const Child &child, Value &&value);
   bool HasNodeLeftChild(Node *&node) const;
   bool HasNodeRightChild(Node *&node) const;
   int HowMuchChildren(Node *&node) const;
@@ -54,11 +88,17 @@ class map {
 
  public:
   map();
-  map(std::initializer_list<value_type> const &items);
+  explicit map(const Allocator &alloc);
+  map(std::initializer_list<value_type> const &items,
+      const Allocator &alloc = Allocator());
   map(const map &m);
-  map(map &&m);
+  map(const map &m, const Allocator &alloc);
+  map(map &&m) noexcept;
   ~map();
-  void operator=(map &&m);
+  map &operator=(const map &m);
+  map &operator=(map &&m) noexcept(kMoveAssignSteals);
+
+  allocator_type get_allocator() const;
 
   typedef class MapIterator {
    protected:
@@ -93,11 +133,12 @@ class map {
 
   void clear();
   std::pair<iterator, bool> insert(const_reference value);
+  std::pair<iterator, bool> insert(value_type &&value);
   std::pair<iterator, bool> insert(const key_type &key, const mapped_type &obj);
   std::pair<iterator, bool> insert_or_assign(const key_type &key,
                                              const mapped_type &obj);
   void erase(iterator pos);
-  void swap(map &other);
+  void swap(map &other) noexcept;
   void merge(map &other);
 
   bool contains(const key_type &key) const;
@@ -106,8 +147,8 @@ class map {
   std::vector<std::pair<iterator, bool>> emplace(Args &&...args);
 
  private:
-  std::pair<iterator, bool> UniversalInsert(const_reference value,
-                                            bool is_assign);
+  template <typename Value>
+  std::pair<iterator, bool> UniversalInsert(Value &&value, bool is_assign);
 };
 }  // namespace s21
 #include "s21_map.cc"
@@ -0,0 +1,125 @@
+#ifndef SRC_S21_MEMORY_RESOURCE_CC_
+#define SRC_S21_MEMORY_RESOURCE_CC_
+
+#include "s21_memory_resource.h"
+
+namespace s21 {
+
+inline monotonic_arena::monotonic_arena(std::pmr::memory_resource *upstream)
+    : monotonic_arena(kFirstChunk, upstream) {}
+
+inline monotonic_arena::monotonic_arena(size_t first_chunk,
+                                        std::pmr::memory_resource *upstream)
+    : upstream_(upstream),
+      buffer_(nullptr),
+      buffer_size_(0),
+      cur_(nullptr),
+      end_(nullptr),
+      chunks_(nullptr),
+      current_(nullptr),
+      next_chunk_(std::max(first_chunk, sizeof(Chunk) * 2)),
+      used_(0),
+      reserved_(0) {}
+
+// начальный буфер принадлежит вызывающему, арена его только использует
+inline monotonic_arena::monotonic_arena(void *buffer, size_t size,
+                                        std::pmr::memory_resource *upstream)
+    : monotonic_arena(std::max(size * 2, kFirstChunk), upstream) {
+  buffer_ = static_cast<char *>(buffer);
+  buffer_size_ = size;
+  cur_ = buffer_;
+  end_ = buffer_ + size;
+}
+
+inline monotonic_arena::~monotonic_arena() {
+  while (chunks_) {
+    Chunk *next = chunks_->next;
+    FreeChunk(chunks_);
+    chunks_ = next;
+  }
+}
+
+// Все блоки, кроме текущего, возвращаются в upstream. Текущий — самый
+// большой из обычных — остаётся и переиспользуется с начала
+inline void monotonic_arena::release() {
+  while (chunks_) {
+    Chunk *next = chunks_->next;
+    if (chunks_ != current_) FreeChunk(chunks_);
+    chunks_ = next;
+  }
+  used_ = 0;
+  if (current_) {
+    current_->next = nullptr;
+    chunks_ = current_;
+    UseChunk(current_);
+  } else {
+    cur_ = buffer_;
+    end_ = buffer_ + buffer_size_;
+  }
+}
+
+inline size_t monotonic_arena::bytes_used() const { return used_; }
+
+inline size_t monotonic_arena::bytes_reserved() const { return reserved_; }
+
+inline std::pmr::memory_resource *monotonic_arena::upstream_resource() const {
+  return upstream_;
+}
+
+inline void *monotonic_arena::do_allocate(size_t bytes, size_t alignment) {
+  uintptr_t addr = reinterpret_cast<uintptr_t>(cur_);
+  uintptr_t aligned = (addr + alignment - 1) & ~(uintptr_t(alignment) - 1);
+  if (cur_ && aligned + bytes <= reinterpret_cast<uintptr_t>(end_)) {
+    cur_ = reinterpret_cast<char *>(aligned + bytes);
+    used_ += bytes;
+    return reinterpret_cast<void *>(aligned);
+  }
+  return AllocateSlow(bytes, alignment);
+}
+
+inline void monotonic_arena::do_deallocate(void *, size_t, size_t) {}
+
+inline bool monotonic_arena::do_is_equal(
+    const std::pmr::memory_resource &other) const noexcept {
+  return this == &other;
+}
+
+// Запрос больше половины очередного блока получает собственный блок, а
+// текущий продолжает раздаваться: иначе один большой вектор выбрасывал бы
+// остаток блока, в который поместились бы сотни узлов
+inline void *monotonic_arena::AllocateSlow(size_t bytes, size_t alignment) {
+  size_t need = bytes + (alignment > alignof(Chunk) ? alignment : 0);
+  if (need > next_chunk_ / 2) {
+    Chunk *chunk = NewChunk(sizeof(Chunk) + need);
+    uintptr_t addr = reinterpret_cast<uintptr_t>(chunk + 1);
+    used_ += bytes;
+    return reinterpret_cast<void *>((addr + alignment - 1) &
+                                    ~(uintptr_t(alignment) - 1));
+  }
+  current_ = NewChunk(next_chunk_);
+  UseChunk(current_);
+  next_chunk_ = std::min(next_chunk_ * 2, kMaxChunk);
+  return do_allocate(bytes, alignment);
+}
+
+inline monotonic_arena::Chunk *monotonic_arena::NewChunk(size_t size) {
+  Chunk *chunk =
+      static_cast<Chunk *>(upstream_->allocate(size, alignof(Chunk)));
+  chunk->next = chunks_;
+  chunk->size = size;
+  chunks_ = chunk;
+  reserved_ += size;
+  return chunk;
+}
+
+inline void monotonic_arena::FreeChunk(Chunk *chunk) {
+  reserved_ -= chunk->size;
+  upstream_->deallocate(chunk, chunk->size, alignof(Chunk));
+}
+
+inline void monotonic_arena::UseChunk(Chunk *chunk) {
+  cur_ = reinterpret_cast<char *>(chunk + 1);
+  end_ = reinterpret_cast<char *>(chunk) + chunk->size;
+}
+}  // namespace s21
+#endif  // SRC_S21_MEMORY_RESOURCE_CC_
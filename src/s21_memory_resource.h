@@ -0,0 +1,99 @@
+#ifndef SRC_S21_MEMORY_RESOURCE_H_
+#define SRC_S21_MEMORY_RESOURCE_H_
+
+#include <cstdint>
+#include <memory_resource>
+
+#include "s21_list.h"
+#include "s21_map.h"
+#include "s21_multiset.h"
+#include "s21_queue.h"
+#include "s21_set.h"
+#include "s21_stack.h"
+#include "s21_vector.h"
+
+namespace s21 {
+
+// Монотонная арена для контейнеров, живущих в пределах одного запроса.
+// Память раздаётся сдвигом указателя внутри блоков, deallocate ничего не
+// делает, всё освобождается разом в release() или в деструкторе. Под
+// узловые контейнеры: мелкие выделения одного размера идут по быстрому
+// пути без ветвлений на размер, блоки растут вдвое до kMaxChunk, а крупные
+// запросы получают отдельный блок и не сбрасывают текущий. В отличие от
+// std::pmr::monotonic_buffer_resource, release() оставляет себе последний
+// блок, и следующий запрос начинает работу без обращения к upstream
+class monotonic_arena : public std::pmr::memory_resource {
+ public:
+  static constexpr size_t kFirstChunk = 4096;
+  static constexpr size_t kMaxChunk = size_t(1) << 20;
+
+  explicit monotonic_arena(
+      std::pmr::memory_resource *upstream = std::pmr::new_delete_resource());
+  explicit monotonic_arena(
+      size_t first_chunk,
+      std::pmr::memory_resource *upstream = std::pmr::new_delete_resource());
+  monotonic_arena(
+      void *buffer, size_t size,
+      std::pmr::memory_resource *upstream = std::pmr::new_delete_resource());
+  monotonic_arena(const monotonic_arena &) = delete;
+  monotonic_arena &operator=(const monotonic_arena &) = delete;
+  ~monotonic_arena() override;
+
+  void release();
+  size_t bytes_used() const;
+  size_t bytes_reserved() const;
+  std::pmr::memory_resource *upstream_resource() const;
+
+ protected:
+  void *do_allocate(size_t bytes, size_t alignment) override;
+  void do_deallocate(void *ptr, size_t bytes, size_t alignment) override;
+  bool do_is_equal(const std::pmr::memory_resource &other) const
+      noexcept override;
+
+ private:
+  // заголовок блока лежит в его начале, данные — сразу за ним
+  struct alignas(std::max_align_t) Chunk {
+    Chunk *next;
+    size_t size;
+  };
+
+  void *AllocateSlow(size_t bytes, size_t alignment);
+  Chunk *NewChunk(size_t size);
+  void FreeChunk(Chunk *chunk);
+  void UseChunk(Chunk *chunk);
+
+  std::pmr::memory_resource *upstream_;
+  char *buffer_;
+  size_t buffer_size_;
+  char *cur_;
+  char *end_;
+  Chunk *chunks_;
+  Chunk *current_;
+  size_t next_chunk_;
+  size_t used_;
+  size_t reserved_;
+};
+
+// Контейнеры на std::pmr::polymorphic_allocator, память берётся из
+// переданного memory_resource. Аллокатор не переезжает при присваивании,
+// поэтому присваивание между разными ресурсами копирует элементы
+namespace pmr {
+template <typename T>
+using vector = s21::vector<T, std::pmr::polymorphic_allocator<T>>;
+template <typename T>
+using list = s21::list<T, std::pmr::polymorphic_allocator<T>>;
+template <typename Key, typename T>
+using map = s21::map<Key, T,
+                     std::pmr::polymorphic_allocator<std::pair<const Key, T>>>;
+template <typename Key>
+using set = s21::set<Key, std::pmr::polymorphic_allocator<Key>>;
+template <typename Key>
+using multiset = s21::multiset<Key, std::pmr::polymorphic_allocator<Key>>;
+template <typename T>
+using stack = s21::stack<T, std::pmr::polymorphic_allocator<T>>;
+template <typename T>
+using queue = s21::queue<T, std::pmr::polymorphic_allocator<T>>;
+}  // namespace pmr
+}  // namespace s21
+#include "s21_memory_resource.cc"
+#endif  // SRC_S21_MEMORY_RESOURCE_H_
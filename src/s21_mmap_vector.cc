@@ -0,0 +1,425 @@
+#ifndef SRC_S21_MMAP_VECTOR_CC_
+#define SRC_S21_MMAP_VECTOR_CC_
+
+#include "s21_mmap_vector.h"
+
+namespace s21 {
+/* MappedFile ****************************************************/
+
+inline MappedFile::MappedFile(const std::string &path)
+    : fd_{-1}, base_{nullptr}, size_{0} {
+  fd_ = open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+  if (fd_ < 0) {
+    throw std::system_error(errno, std::generic_category(), "open " + path);
+  }
+  struct stat info;
+  if (fstat(fd_, &info) != 0) {
+    int error = errno;
+    Close();
+    throw std::system_error(error, std::generic_category(), "fstat " + path);
+  }
+  if (info.st_size > 0) {
+    void *ptr = mmap(nullptr, info.st_size, PROT_READ | PROT_WRITE,
+                     MAP_SHARED, fd_, 0);
+    if (ptr == MAP_FAILED) {
+      int error = errno;
+      Close();
+      throw std::system_error(error, std::generic_category(), "mmap " + path);
+    }
+    base_ = static_cast<unsigned char *>(ptr);
+    size_ = info.st_size;
+  }
+}
+
+inline MappedFile::MappedFile(MappedFile &&other) noexcept
+    : fd_{other.fd_}, base_{other.base_}, size_{other.size_} {
+  other.fd_ = -1;
+  other.base_ = nullptr;
+  other.size_ = 0;
+}
+
+inline MappedFile::~MappedFile() { Close(); }
+
+inline MappedFile &MappedFile::operator=(MappedFile &&other) noexcept {
+  if (this != &other) {
+    Close();
+    Swap(other);
+  }
+  return *this;
+}
+
+inline unsigned char *MappedFile::Data() const { return base_; }
+
+inline size_t MappedFile::Size() const { return size_; }
+
+// при росте файл удлиняется до отображения, при сжатии — укорачивается
+// после, чтобы за концом файла никогда не было отображённых страниц
+inline void MappedFile::Resize(size_t bytes) {
+  if (bytes == size_) return;
+  bool shrink = bytes < size_;
+  if (!shrink && ftruncate(fd_, bytes) != 0) {
+    throw std::system_error(errno, std::generic_category(), "ftruncate");
+  }
+  void *ptr = MAP_FAILED;
+  if (!base_) {
+    ptr = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+  } else {
+#ifdef MREMAP_MAYMOVE
+    ptr = mremap(base_, size_, bytes, MREMAP_MAYMOVE);
+#else
+    ptr = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+    if (ptr != MAP_FAILED) munmap(base_, size_);
+#endif
+  }
+  if (ptr == MAP_FAILED) {
+    throw std::system_error(errno, std::generic_category(), "mmap");
+  }
+  base_ = static_cast<unsigned char *>(ptr);
+  size_ = bytes;
+  if (shrink && ftruncate(fd_, bytes) != 0) {
+    throw std::system_error(errno, std::generic_category(), "ftruncate");
+  }
+}
+
+inline void MappedFile::Sync() {
+  if (base_ && msync(base_, size_, MS_SYNC) != 0) {
+    throw std::system_error(errno, std::generic_category(), "msync");
+  }
+}
+
+inline void MappedFile::Swap(MappedFile &other) noexcept {
+  std::swap(fd_, other.fd_);
+  std::swap(base_, other.base_);
+  std::swap(size_, other.size_);
+}
+
+inline void MappedFile::Close() noexcept {
+  if (base_) munmap(base_, size_);
+  if (fd_ >= 0) close(fd_);
+  fd_ = -1;
+  base_ = nullptr;
+  size_ = 0;
+}
+
+/* Конструкторы ***************************************************/
+
+// новый файл получает заголовок с нулевым числом элементов, существующий
+// только проверяется: элементы не читаются
+template <typename T, typename Growth>
+mmap_vector<T, Growth>::mmap_vector(const std::string &path)
+    : file_{path}, capacity_{0} {
+  constexpr size_t kOffset = MmapVectorHeader::kDataOffset;
+  if (file_.Size() == 0) {
+    file_.Resize(kOffset);
+    MmapVectorHeader *header = Header();
+    std::memcpy(header->magic, MmapVectorHeader::kMagic,
+                sizeof(header->magic));
+    header->version = MmapVectorHeader::kVersion;
+    header->element_size = sizeof(T);
+    header->count = 0;
+  } else {
+    const MmapVectorHeader *header = Header();
+    if (file_.Size() < kOffset ||
+        std::memcmp(header->magic, MmapVectorHeader::kMagic,
+                    sizeof(header->magic)) != 0 ||
+        header->version != MmapVectorHeader::kVersion ||
+        header->element_size != sizeof(T) ||
+        header->count > (file_.Size() - kOffset) / sizeof(T)) {
+      throw std::runtime_error(path + " is not an mmap_vector of this type");
+    }
+  }
+  capacity_ = (file_.Size() - kOffset) / sizeof(T);
+}
+
+// перемещённый вектор остаётся без файла: его можно только уничтожить
+// или присвоить ему другой
+template <typename T, typename Growth>
+mmap_vector<T, Growth>::mmap_vector(mmap_vector &&v) noexcept
+    : file_{std::move(v.file_)}, capacity_{v.capacity_} {
+  v.capacity_ = 0;
+}
+
+template <typename T, typename Growth>
+mmap_vector<T, Growth> &mmap_vector<T, Growth>::operator=(
+    mmap_vector &&v) noexcept {
+  if (this != &v) {
+    file_ = std::move(v.file_);
+    capacity_ = v.capacity_;
+    v.capacity_ = 0;
+  }
+  return *this;
+}
+
+/* Служебные ******************************************************/
+
+template <typename T, typename Growth>
+MmapVectorHeader *mmap_vector<T, Growth>::Header() const {
+  return reinterpret_cast<MmapVectorHeader *>(file_.Data());
+}
+
+template <typename T, typename Growth>
+typename mmap_vector<T, Growth>::value_type *mmap_vector<T, Growth>::Head()
+    const {
+  return reinterpret_cast<value_type *>(file_.Data() +
+                                        MmapVectorHeader::kDataOffset);
+}
+
+template <typename T, typename Growth>
+void mmap_vector<T, Growth>::SetSize(size_type size) {
+  Header()->count = size;
+}
+
+template <typename T, typename Growth>
+void mmap_vector<T, Growth>::Remap(size_type new_capacity) {
+  file_.Resize(MmapVectorHeader::kDataOffset + new_capacity * sizeof(T));
+  capacity_ = new_capacity;
+}
+
+template <typename T, typename Growth>
+void mmap_vector<T, Growth>::GrowFor(size_type required) {
+  if (required <= capacity_) return;
+  size_type next = Growth::Next(capacity_, required);
+  if (next > max_size()) next = max_size();
+  if (required > next) throw std::length_error("capacity_ > max_size()");
+  Remap(next);
+}
+
+// освобождает место под count элементов перед pos; буфер может переехать,
+// поэтому возвращается новый адрес промежутка
+template <typename T, typename Growth>
+typename mmap_vector<T, Growth>::value_type *mmap_vector<T, Growth>::MakeRoom(
+    value_type *pos, size_type count) {
+  size_type index = pos - Head();
+  size_type old_size = size();
+  GrowFor(old_size + count);
+  Ops::OpenGap(Head() + index, Head() + old_size, count);
+  SetSize(old_size + count);
+  return Head() + index;
+}
+
+template <typename T, typename Growth>
+typename mmap_vector<T, Growth>::value_type *mmap_vector<T, Growth>::Unconst(
+    const_iterator pos) {
+  return Head() + (pos - cbegin());
+}
+
+/* Доступ к элементам *********************************************/
+
+template <typename T, typename Growth>
+typename mmap_vector<T, Growth>::reference mmap_vector<T, Growth>::at(
+    size_type pos) {
+  if (pos < size()) return operator[](pos);
+  throw std::out_of_range("Out of range");
+}
+
+template <typename T, typename Growth>
+typename mmap_vector<T, Growth>::reference mmap_vector<T, Growth>::operator[](
+    size_type pos) {
+  return Head()[pos];
+}
+
+template <typename T, typename Growth>
+typename mmap_vector<T, Growth>::const_reference
+mmap_vector<T, Growth>::front() {
+  return *Head();
+}
+
+template <typename T, typename Growth>
+typename mmap_vector<T, Growth>::const_reference
+mmap_vector<T, Growth>::back() {
+  return Head()[size() - 1];
+}
+
+template <typename T, typename Growth>
+typename mmap_vector<T, Growth>::value_type *mmap_vector<T, Growth>::data() {
+  return Head();
+}
+
+/* Итераторы ******************************************************/
+
+template <typename T, typename Growth>
+typename mmap_vector<T, Growth>::iterator mmap_vector<T, Growth>::begin() {
+  return iterator(Head());
+}
+
+template <typename T, typename Growth>
+typename mmap_vector<T, Growth>::iterator mmap_vector<T, Growth>::end() {
+  return iterator(Head() + size());
+}
+
+template <typename T, typename Growth>
+typename mmap_vector<T, Growth>::const_iterator mmap_vector<T, Growth>::begin()
+    const {
+  return const_iterator(Head());
+}
+
+template <typename T, typename Growth>
+typename mmap_vector<T, Growth>::const_iterator mmap_vector<T, Growth>::end()
+    const {
+  return const_iterator(Head() + Header()->count);
+}
+
+template <typename T, typename Growth>
+typename mmap_vector<T, Growth>::const_iterator mmap_vector<T, Growth>::cbegin()
+    const {
+  return begin();
+}
+
+template <typename T, typename Growth>
+typename mmap_vector<T, Growth>::const_iterator mmap_vector<T, Growth>::cend()
+    const {
+  return end();
+}
+
+/* Ёмкость ********************************************************/
+
+template <typename T, typename Growth>
+bool mmap_vector<T, Growth>::empty() {
+  return size() == 0;
+}
+
+template <typename T, typename Growth>
+typename mmap_vector<T, Growth>::size_type mmap_vector<T, Growth>::size() {
+  return Header()->count;
+}
+
+template <typename T, typename Growth>
+typename mmap_vector<T, Growth>::size_type mmap_vector<T, Growth>::max_size() {
+  return (std::numeric_limits<int64_t>::max() - MmapVectorHeader::kDataOffset) /
+         sizeof(value_type);
+}
+
+template <typename T, typename Growth>
+void mmap_vector<T, Growth>::reserve(size_type size) {
+  if (size > capacity_ && size < max_size()) Remap(size);
+}
+
+template <typename T, typename Growth>
+typename mmap_vector<T, Growth>::size_type mmap_vector<T, Growth>::capacity() {
+  return capacity_;
+}
+
+// отрезает от файла запас ёмкости
+template <typename T, typename Growth>
+void mmap_vector<T, Growth>::shrink_to_fit() {
+  if (capacity_ > size()) Remap(size());
+}
+
+/* Изменение ******************************************************/
+
+template <typename T, typename Growth>
+void mmap_vector<T, Growth>::clear() {
+  SetSize(0);
+}
+
+// value копируется заранее: он может лежать в этом же буфере
+template <typename T, typename Growth>
+typename mmap_vector<T, Growth>::iterator mmap_vector<T, Growth>::insert(
+    const_iterator pos, const_reference value) {
+  return insert(pos, 1, value);
+}
+
+template <typename T, typename Growth>
+typename mmap_vector<T, Growth>::iterator mmap_vector<T, Growth>::insert(
+    const_iterator pos, size_type count, const_reference value) {
+  value_type copy(value);
+  value_type *gap = MakeRoom(Unconst(pos), count);
+  std::fill(gap, gap + count, copy);
+  return iterator(gap);
+}
+
+template <typename T, typename Growth>
+template <typename InputIt, typename>
+typename mmap_vector<T, Growth>::iterator mmap_vector<T, Growth>::insert(
+    const_iterator pos, InputIt first, InputIt last) {
+  typedef typename std::iterator_traits<InputIt>::iterator_category Category;
+  if constexpr (std::is_base_of_v<std::forward_iterator_tag, Category>) {
+    size_type count = std::distance(first, last);
+    value_type *gap = MakeRoom(Unconst(pos), count);
+    std::copy(first, last, gap);
+    return iterator(gap);
+  } else {
+    // если рост файла не удастся, дописанное стирается
+    return Ops::InsertByAppend(*this, Unconst(pos) - Head(), first, last);
+  }
+}
+
+template <typename T, typename Growth>
+typename mmap_vector<T, Growth>::iterator mmap_vector<T, Growth>::insert(
+    const_iterator pos, std::initializer_list<value_type> items) {
+  return insert(pos, items.begin(), items.end());
+}
+
+template <typename T, typename Growth>
+void mmap_vector<T, Growth>::erase(const_iterator pos) {
+  erase(pos, pos + 1);
+}
+
+template <typename T, typename Growth>
+typename mmap_vector<T, Growth>::iterator mmap_vector<T, Growth>::erase(
+    const_iterator first, const_iterator last) {
+  value_type *from = Unconst(first);
+  size_type count = last - first;
+  if (count) {
+    Ops::CloseGap(from, Head() + size(), count);
+    SetSize(size() - count);
+  }
+  return iterator(from);
+}
+
+template <typename T, typename Growth>
+template <typename Predicate>
+typename mmap_vector<T, Growth>::size_type mmap_vector<T, Growth>::erase_if(
+    Predicate pred) {
+  value_type *last = Head() + size();
+  value_type *out = Ops::RemoveIf(Head(), last, pred);
+  size_type removed = last - out;
+  SetSize(size() - removed);
+  return removed;
+}
+
+template <typename T, typename Growth>
+void mmap_vector<T, Growth>::push_back(const_reference value) {
+  emplace_back(value);
+}
+
+template <typename T, typename Growth>
+void mmap_vector<T, Growth>::pop_back() {
+  if (size() == 0)
+    throw std::invalid_argument("pointer being freed was not allocated");
+  SetSize(size() - 1);
+}
+
+template <typename T, typename Growth>
+void mmap_vector<T, Growth>::swap(mmap_vector &other) noexcept {
+  file_.Swap(other.file_);
+  std::swap(capacity_, other.capacity_);
+}
+
+template <typename T, typename Growth>
+template <typename... Args>
+typename mmap_vector<T, Growth>::iterator mmap_vector<T, Growth>::emplace(
+    const_iterator pos, Args &&...args) {
+  return Ops::Emplace(*this, pos, std::forward<Args>(args)...);
+}
+
+// элемент создаётся до роста: args может ссылаться на этот же буфер,
+// а переотображение его сдвигает
+template <typename T, typename Growth>
+template <typename... Args>
+typename mmap_vector<T, Growth>::reference mmap_vector<T, Growth>::emplace_back(
+    Args &&...args) {
+  value_type value(std::forward<Args>(args)...);
+  size_type old_size = size();
+  GrowFor(old_size + 1);
+  Head()[old_size] = value;
+  SetSize(old_size + 1);
+  return Head()[old_size];
+}
+
+template <typename T, typename Growth>
+void mmap_vector<T, Growth>::sync() {
+  file_.Sync();
+}
+}  // namespace s21
+#endif  // SRC_S21_MMAP_VECTOR_CC_
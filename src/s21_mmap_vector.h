@@ -0,0 +1,152 @@
+#ifndef SRC_S21_MMAP_VECTOR_H_
+#define SRC_S21_MMAP_VECTOR_H_
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <string>
+#include <system_error>
+
+#include "s21_vector.h"
+
+namespace s21 {
+
+// Файл, целиком отображённый в память через MAP_SHARED: изменения в памяти
+// попадают в файл без явной записи. Владеет дескриптором и отображением,
+// только перемещается. Ошибки системных вызовов — std::system_error
+class MappedFile {
+ public:
+  explicit MappedFile(const std::string &path);
+  MappedFile(const MappedFile &) = delete;
+  MappedFile(MappedFile &&other) noexcept;
+  ~MappedFile();
+  MappedFile &operator=(const MappedFile &) = delete;
+  MappedFile &operator=(MappedFile &&other) noexcept;
+
+  unsigned char *Data() const;
+  size_t Size() const;
+  // меняет длину файла и отображения; адрес может измениться
+  void Resize(size_t bytes);
+  // дожидается записи изменённых страниц на диск
+  void Sync();
+  void Swap(MappedFile &other) noexcept;
+
+ private:
+  void Close() noexcept;
+
+  int fd_;
+  unsigned char *base_;
+  size_t size_;
+};
+
+// Заголовок файла mmap_vector. Данные начинаются через kDataOffset байт,
+// поэтому выровнены для любого T с alignof(T) <= 64
+struct MmapVectorHeader {
+  static constexpr char kMagic[8] = {'S', '2', '1', 'M', 'V', 'E', 'C', '\0'};
+  static constexpr uint32_t kVersion = 1;
+  static constexpr size_t kDataOffset = 64;
+
+  char magic[8];
+  uint32_t version;
+  uint32_t element_size;
+  uint64_t count;
+};
+
+// Вектор тривиально копируемых T, живущий в файле: заголовок (магия,
+// версия, размер элемента, число элементов) и сразу за ним элементы.
+// Открытие существующего файла — O(1): файл только отображается, страницы
+// подгружаются при первом обращении. Число элементов хранится в самом
+// заголовке, так что файл всегда согласован с вектором. Рост —
+// ftruncate и переотображение (mremap на Linux); хвост файла за size()
+// — запас ёмкости, shrink_to_fit его отрезает. Интерфейс как у vector,
+// копирования нет: два вектора на одном файле разошлись бы
+template <typename T, typename Growth = GeometricGrowth<>>
+class mmap_vector {
+  static_assert(std::is_trivially_copyable_v<T>,
+                "mmap_vector stores elements as raw bytes");
+  static_assert(alignof(T) <= MmapVectorHeader::kDataOffset,
+                "element alignment exceeds the data offset");
+
+ public:
+  typedef T value_type;
+  typedef T &reference;
+  typedef const T &const_reference;
+  typedef size_t size_type;
+  typedef std::ptrdiff_t difference_type;
+  typedef VectorIterator<value_type> iterator;
+  typedef VectorIterator<const value_type> const_iterator;
+
+ private:
+  typedef ElementOps<value_type> Ops;
+
+  MappedFile file_;
+  size_type capacity_;
+
+  MmapVectorHeader *Header() const;
+  value_type *Head() const;
+  void SetSize(size_type size);
+  void Remap(size_type new_capacity);
+  void GrowFor(size_type required);
+  value_type *MakeRoom(value_type *pos, size_type count);
+  value_type *Unconst(const_iterator pos);
+
+ public:
+  // открывает файл path или создаёт пустой вектор в новом файле. Чужой или
+  // повреждённый файл — std::runtime_error
+  explicit mmap_vector(const std::string &path);
+  mmap_vector(const mmap_vector &) = delete;
+  mmap_vector(mmap_vector &&v) noexcept;
+  mmap_vector &operator=(const mmap_vector &) = delete;
+  mmap_vector &operator=(mmap_vector &&v) noexcept;
+
+  reference at(size_type pos);
+  reference operator[](size_type pos);
+  const_reference front();
+  const_reference back();
+  value_type *data();
+
+  iterator begin();
+  iterator end();
+  const_iterator begin() const;
+  const_iterator end() const;
+
+  const_iterator cbegin() const;
+  const_iterator cend() const;
+
+  bool empty();
+  size_type size();
+  size_type max_size();
+  void reserve(size_type size);
+  size_type capacity();
+  void shrink_to_fit();
+
+  void clear();
+  iterator insert(const_iterator pos, const_reference value);
+  iterator insert(const_iterator pos, size_type count, const_reference value);
+  template <typename InputIt,
+            typename = std::enable_if_t<!std::is_integral_v<InputIt>>>
+  iterator insert(const_iterator pos, InputIt first, InputIt last);
+  iterator insert(const_iterator pos, std::initializer_list<value_type> items);
+  void erase(const_iterator pos);
+  iterator erase(const_iterator first, const_iterator last);
+  template <typename Predicate>
+  size_type erase_if(Predicate pred);
+  void push_back(const_reference value);
+  void pop_back();
+  void swap(mmap_vector &other) noexcept;
+
+  template <typename... Args>
+  iterator emplace(const_iterator pos, Args &&...args);
+
+  template <typename... Args>
+  reference emplace_back(Args &&...args);
+
+  // сбрасывает изменения на диск (msync); без него их запишет ядро
+  void sync();
+};
+}  // namespace s21
+#include "s21_mmap_vector.cc"
+#endif  // SRC_S21_MMAP_VECTOR_H_
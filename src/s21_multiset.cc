@@ -4,65 +4,155 @@
 
 namespace s21 {
 
-template <class value_type>
-multiset<value_type>::multiset() : set<value_type>::set() {}
+template <class value_type, class Allocator>
+multiset<value_type, Allocator>::multiset() : multiset(Allocator()) {}
 
-template <class value_type>
-multiset<value_type>::multiset(const multiset<value_type>& other)
-    : set<value_type>::set(other) {}
+template <class value_type, class Allocator>
+multiset<value_type, Allocator>::multiset(const Allocator& alloc)
+    : set<value_type, Allocator>::set(alloc) {}
 
-template <class value_type>
-multiset<value_type>::multiset(multiset<value_type>&& other)
-    : set<value_type>::set(other) {}
+template <class value_type, class Allocator>
+multiset<value_type, Allocator>::multiset(
+    const multiset<value_type, Allocator>& other)
+    : multiset(other, AllocTraits::select_on_container_copy_construction(
+                          other.get_allocator())) {}
 
-template <class value_type>
-multiset<value_type>::multiset(std::initializer_list<value_type> const& items) {
+// копирует поэлементно через multiset::insert, чтобы сохранить дубликаты
+template <class value_type, class Allocator>
+multiset<value_type, Allocator>::multiset(
+    const multiset<value_type, Allocator>& other, const Allocator& alloc)
+    : set<value_type, Allocator>::set(alloc) {
+  if (other.root_ == nullptr) return;
+  iterator iter;
+  iter.iter_ = other.root_;
+  while (iter.iter_->pLeft_ != nullptr) {
+    iter.iter_ = iter.iter_->pLeft_;
+  }
+  for (size_t i = 0; i < other.size_; i++) {
+    insert(*iter);
+    ++iter;
+  }
+}
+
+template <class value_type, class Allocator>
+multiset<value_type, Allocator>::multiset(
+    multiset<value_type, Allocator>&& other) noexcept
+    : set<value_type, Allocator>::set(std::move(other)) {}
+
+template <class value_type, class Allocator>
+multiset<value_type, Allocator>::multiset(
+    std::initializer_list<value_type> const& items, const Allocator& alloc)
+    : set<value_type, Allocator>::set(alloc) {
   for (auto& i : items) {
     insert(i);
   }
 }
 
-template <class value_type>
-multiset<value_type>::~multiset() {}
+template <class value_type, class Allocator>
+multiset<value_type, Allocator>::~multiset() {}
+
+// те же правила распространения аллокатора, что и у set, но копия
+// строится через multiset, чтобы сохранить дубликаты
+template <class value_type, class Allocator>
+multiset<value_type, Allocator>& multiset<value_type, Allocator>::operator=(
+    const multiset& other) {
+  if (this != &other) {
+    if constexpr (AllocTraits::propagate_on_container_copy_assignment::value) {
+      multiset tmp(other, other.get_allocator());
+      this->SwapTrees(tmp);
+      std::swap(this->alloc_, tmp.alloc_);
+    } else {
+      multiset tmp(other, this->get_allocator());
+      this->SwapTrees(tmp);
+    }
+  }
+  return *this;
+}
+
+template <class value_type, class Allocator>
+multiset<value_type, Allocator>& multiset<value_type, Allocator>::operator=(
+    multiset&& other) noexcept(set<value_type, Allocator>::kMoveAssignSteals) {
+  if (this != &other) {
+    if constexpr (AllocTraits::propagate_on_container_move_assignment::value) {
+      multiset tmp(std::move(other));
+      this->SwapTrees(tmp);
+      std::swap(this->alloc_, tmp.alloc_);
+    } else if (set<value_type, Allocator>::kMoveAssignSteals ||
+               this->alloc_ == other.alloc_) {
+      multiset tmp(std::move(other));
+      this->SwapTrees(tmp);
+    } else {
+      // чужие узлы забрать нельзя, элементы перемещаются по одному
+      multiset tmp(this->get_allocator());
+      if (other.root_ != nullptr) {
+        iterator iter = other.begin();
+        for (size_t i = 0; i < other.size_; i++) {
+          tmp.insert(std::move(*iter));
+          ++iter;
+        }
+      }
+      this->SwapTrees(tmp);
+      other.clear();
+    }
+  }
+  return *this;
+}
+
+template <class value_type, class Allocator>
+typename multiset<value_type, Allocator>::iterator
+multiset<value_type, Allocator>::insert(const_reference value) {
+  return InsertValue(value);
+}
+
+template <class value_type, class Allocator>
+typename multiset<value_type, Allocator>::iterator
+multiset<value_type, Allocator>::insert(value_type&& value) {
+  return InsertValue(std::move(value));
+}
 
-template <class value_type>
-typename multiset<value_type>::iterator multiset<value_type>::insert(
-    const_reference value) {
+template <class value_type, class Allocator>
+template <typename Value>
+typename multiset<value_type, Allocator>::iterator
+multiset<value_type, Allocator>::InsertValue(Value&& value) {
   iterator iterResult;
   if (this->root_ == nullptr) {
-    this->root_ = new NodeSet(value);
+    this->root_ = this->CreateNode(std::forward<Value>(value));
     ++this->size_;
     this->createEndNode(this->root_);
     this->root_->pRight_ = this->endNode_;
     iterResult.iter_ = this->root_;
   } else {
-    iterResult = addNode(this->root_, value);
+    iterResult = addNode(this->root_, std::forward<Value>(value));
   }
   return iterResult;
 }
 
-template <class value_type>
-typename multiset<value_type>::iterator multiset<value_type>::addNode(
-    NodeSet* node, const value_type& key) {
+template <class value_type, class Allocator>
+template <typename Value>
+typename multiset<value_type, Allocator>::iterator
+multiset<value_type, Allocator>::addNode(NodeSet* node, Value&& key) {
   iterator result;
   if (node->value_ > key) {
     if (node->pLeft_ != nullptr) {
-      result = addNode(node->pLeft_, key);
+      result = addNode(node->pLeft_, std::forward<Value>(key));
     } else {
-      node->pLeft_ = new NodeSet(key, nullptr, nullptr, node);
+      node->pLeft_ = this->CreateNode(std::forward<Value>(key), nullptr,
+                                      nullptr, node);
       ++this->size_;
       result.iter_ = node->pLeft_;
     }
   } else if (node->value_ <= key) {
     if (node->pRight_ != nullptr && node->pRight_ != this->endNode_) {
-      result = addNode(node->pRight_, key);
+      result = addNode(node->pRight_, std::forward<Value>(key));
     } else {
       if (node->pRight_ == nullptr) {
-        node->pRight_ = new NodeSet(key, nullptr, nullptr, node);
+        node->pRight_ = this->CreateNode(std::forward<Value>(key), nullptr,
+                                         nullptr, node);
         ++this->size_;
         result.iter_ = node->pRight_;
       } else if (node->pRight_ == this->endNode_) {
-        node->pRight_ = new NodeSet(key, nullptr, this->endNode_, node);
+        node->pRight_ = this->CreateNode(std::forward<Value>(key), nullptr,
+                                         this->endNode_, node);
         ++this->size_;
         this->endNode_->parent_ = node->pRight_;
         result.iter_ = node->pRight_;
@@ -72,9 +162,9 @@ typename multiset<value_type>::iterator multiset<value_type>::addNode(
   return result;
 }
 
-template <class value_type>
-typename multiset<value_type>::iterator multiset<value_type>::upper_bound(
-    const value_type& key) {
+template <class value_type, class Allocator>
+typename multiset<value_type, Allocator>::iterator
+multiset<value_type, Allocator>::upper_bound(const value_type& key) {
   iterator iterResult;
   iterResult = this->find(key);
   if (iterResult == this->end()) {
@@ -98,9 +188,9 @@ typename multiset<value_type>::iterator multiset<value_type>::upper_bound(
   return iterResult;
 }
 
-template <class value_type>
-typename multiset<value_type>::iterator multiset<value_type>::lower_bound(
-    const value_type& key) {
+template <class value_type, class Allocator>
+typename multiset<value_type, Allocator>::iterator
+multiset<value_type, Allocator>::lower_bound(const value_type& key) {
   iterator iterResult;
   iterResult = this->find(key);
   if (iterResult == this->end()) {
@@ -116,29 +206,29 @@ typename multiset<value_type>::iterator multiset<value_type>::lower_bound(
   return iterResult;
 }
 
-template <class value_type>
-void multiset<value_type>::erase(const value_type& key) {
+template <class value_type, class Allocator>
+void multiset<value_type, Allocator>::erase(const value_type& key) {
   while (this->find(key) != this->end()) {
     iterator it = this->deleteOneNode(this->root_, key);
-    delete it.iter_;
+    this->DestroyNode(it.iter_);
     it.iter_ = nullptr;
     --this->size_;
   }
 }
 
-template <class value_type>
-void multiset<value_type>::erase(iterator deleteIter) {
+template <class value_type, class Allocator>
+void multiset<value_type, Allocator>::erase(iterator deleteIter) {
   if (deleteIter.iter_ != nullptr) {
     iterator it = this->deleteOneNode(this->root_, deleteIter.iter_->value_);
-    delete it.iter_;
+    this->DestroyNode(it.iter_);
     it.iter_ = nullptr;
     --this->size_;
   }
 }
 
-template <class value_type>
-typename multiset<value_type>::size_type multiset<value_type>::count(
-    const value_type& key) {
+template <class value_type, class Allocator>
+typename multiset<value_type, Allocator>::size_type
+multiset<value_type, Allocator>::count(const value_type& key) {
   size_type count = 0;
   if (this->contains(key)) {
     iterator it = this->find(key);
@@ -150,17 +240,17 @@ typename multiset<value_type>::size_type multiset<value_type>::count(
   return count;
 }
 
-template <class value_type>
-std::pair<typename multiset<value_type>::iterator,
-          typename multiset<value_type>::iterator>
-multiset<value_type>::equal_range(const value_type& key) {
+template <class value_type, class Allocator>
+std::pair<typename multiset<value_type, Allocator>::iterator,
+          typename multiset<value_type, Allocator>::iterator>
+multiset<value_type, Allocator>::equal_range(const value_type& key) {
   return std::pair<iterator, iterator>(lower_bound(key), upper_bound(key));
 }
 
-template <class value_type>
+template <class value_type, class Allocator>
 template <class... Args>
-typename multiset<value_type>::iterator multiset<value_type>::emplace(
-    Args&&... args) {
+typename multiset<value_type, Allocator>::iterator
+multiset<value_type, Allocator>::emplace(Args&&... args) {
   iterator result;
   std::vector<value_type> arguments = {args...};
   for (auto& a : arguments) {
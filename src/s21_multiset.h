@@ -5,24 +5,32 @@
 #include "s21_set.h"
 
 namespace s21 {
-template <class Key>
-class multiset : public set<Key> {
+template <class Key, class Allocator = pool_allocator<Key>>
+class multiset : public set<Key, Allocator> {
  public:
   typedef Key key_type;
   typedef key_type value_type;
   typedef value_type& reference;
   typedef const value_type& const_reference;
   typedef size_t size_type;
-  typedef typename set<value_type>::iterator iterator;
-  typedef typename set<value_type>::Node NodeSet;
+  typedef Allocator allocator_type;
+  typedef typename set<value_type, Allocator>::iterator iterator;
+  typedef typename set<value_type, Allocator>::Node NodeSet;
 
   multiset();
-  multiset(std::initializer_list<value_type> const& items);
-  multiset(const multiset<value_type>& other);
-  multiset(multiset<value_type>&& other);
+  explicit multiset(const Allocator& alloc);
+  multiset(std::initializer_list<value_type> const& items,
+           const Allocator& alloc = Allocator());
+  multiset(const multiset& other);
+  multiset(const multiset& other, const Allocator& alloc);
+  multiset(multiset&& other) noexcept;
   ~multiset();
+  multiset& operator=(const multiset& other);
+  multiset& operator=(multiset&& other) noexcept(
+      set<value_type, Allocator>::kMoveAssignSteals);
 
   iterator insert(const value_type& value);
+  iterator insert(value_type&& value);
 
   void erase(iterator pos);
   void erase(const value_type& key);
@@ -36,8 +44,12 @@ class multiset : public set<Key> {
   iterator emplace(Args&&... args);
 
  private:
-  multiset<value_type>& operator=(multiset&& other);
-  iterator addNode(NodeSet* node, const value_type& value);
+  typedef typename set<value_type, Allocator>::AllocTraits AllocTraits;
+
+  template <typename Value>
+  iterator InsertValue(Value&& value);
+  template <typename Value>
+  iterator addNode(NodeSet* node, Value&& value);
   // iterator deleteOneNode(NodeSet* node, const value_type& value);
 };
 
@@ -0,0 +1,386 @@
+#ifndef SRC_S21_NODE_POOL_CC_
+#define SRC_S21_NODE_POOL_CC_
+
+#include "s21_node_pool.h"
+
+namespace s21 {
+/* Счётчики *******************************************************/
+
+inline void PoolCounters::Bump(std::atomic<size_t> &counter) {
+  counter.store(counter.load(std::memory_order_relaxed) + 1,
+                std::memory_order_relaxed);
+}
+
+inline PoolCounters *&PoolCounters::ThreadList() {
+  static thread_local PoolCounters *head = nullptr;
+  return head;
+}
+
+// отдаёт итоги блоков потока их реестрам и обнуляет thread_local
+// указатели на блоки: выделение после этого заведёт новый блок
+inline void PoolCounters::RetireThread() {
+  PoolCounters *counters = ThreadList();
+  ThreadList() = nullptr;
+  while (counters) {
+    PoolCounters *next = counters->thread_next;
+    *counters->slot = nullptr;
+    counters->owner->Retire(counters);
+    counters = next;
+  }
+}
+
+// slot — thread_local указатель потока на этот блок
+inline PoolCounters *PoolStatsRegistry::Register(PoolCounters **slot) {
+  PoolCounters *counters = new PoolCounters;
+  counters->owner = this;
+  counters->slot = slot;
+  counters->thread_next = PoolCounters::ThreadList();
+  PoolCounters::ThreadList() = counters;
+  std::lock_guard<std::mutex> lock(mutex_);
+  counters->next = head_;
+  head_ = counters;
+  return counters;
+}
+
+inline void PoolStatsRegistry::Retire(PoolCounters *counters) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  slabs_ += counters->slabs.load(std::memory_order_relaxed);
+  allocs_ += counters->allocs.load(std::memory_order_relaxed);
+  deallocs_ += counters->deallocs.load(std::memory_order_relaxed);
+  hits_ += counters->hits.load(std::memory_order_relaxed);
+  PoolCounters **link = &head_;
+  while (*link != counters) link = &(*link)->next;
+  *link = counters->next;
+  delete counters;
+}
+
+inline PoolStats PoolStatsRegistry::Sum() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  size_t allocs = allocs_, deallocs = deallocs_;
+  PoolStats stats;
+  stats.slabs_allocated = slabs_;
+  stats.free_list_hits = hits_;
+  // Счётчики потоков читаются не одним снимком: узел, выделенный в одном
+  // потоке и освобождённый в другом, может попасть в deallocs раньше, чем
+  // в allocs. Поэтому освобождения суммируются первыми, а разность
+  // ограничивается нулём
+  for (PoolCounters *c = head_; c; c = c->next) {
+    deallocs += c->deallocs.load(std::memory_order_relaxed);
+  }
+  for (PoolCounters *c = head_; c; c = c->next) {
+    stats.slabs_allocated += c->slabs.load(std::memory_order_relaxed);
+    stats.free_list_hits += c->hits.load(std::memory_order_relaxed);
+    allocs += c->allocs.load(std::memory_order_relaxed);
+  }
+  stats.nodes_live = allocs > deallocs ? allocs - deallocs : 0;
+  return stats;
+}
+
+/* Пул ************************************************************/
+
+inline size_t NodePool::Index(size_t size) {
+  return size ? (size - 1) / kAlign : 0;
+}
+
+inline size_t NodePool::ClassSize(size_t index) { return (index + 1) * kAlign; }
+
+inline size_t NodePool::Capacity(size_t index) {
+  return (kSlabBytes - kHeader) / ClassSize(index);
+}
+
+inline NodePool::Slab *NodePool::SlabOf(void *node) {
+  return reinterpret_cast<Slab *>(reinterpret_cast<uintptr_t>(node) &
+                                  ~uintptr_t{kSlabBytes - 1});
+}
+
+inline std::atomic<size_t> &NodePool::LiveSlabs() {
+  static std::atomic<size_t> slabs{0};
+  return slabs;
+}
+
+inline size_t NodePool::slabs_in_use() {
+  return LiveSlabs().load(std::memory_order_relaxed);
+}
+
+inline NodePool::ThreadCache &NodePool::Cache() {
+  static thread_local ThreadCache cache;
+  return cache;
+}
+
+// общие классы живут до конца процесса: узлы статических контейнеров
+// освобождаются уже после разрушения обычных статических объектов
+inline NodePool::SizeClass &NodePool::Global(size_t index) {
+  static SizeClass *classes = new SizeClass[kClasses];
+  return classes[index];
+}
+
+inline void NodePool::Guard(ThreadCache &cache) {
+  static thread_local CacheGuard guard;
+  (void)guard;
+  cache.guarded = true;
+}
+
+inline NodePool::CacheGuard::~CacheGuard() {
+  ThreadCache &cache = Cache();
+  for (size_t index = 0; index < kClasses; ++index) {
+    for (char *p = cache.bump[index]; p != cache.bump_end[index];
+         p += ClassSize(index)) {
+      FreeNode *node = reinterpret_cast<FreeNode *>(p);
+      node->next = cache.free[index];
+      cache.free[index] = node;
+      ++cache.count[index];
+    }
+    cache.bump[index] = cache.bump_end[index] = nullptr;
+    Flush(index, cache, cache.count[index]);
+  }
+  cache.guarded = false;
+  cache.dead = true;
+  PoolCounters::RetireThread();
+}
+
+inline void *NodePool::Allocate(size_t size, PoolCounters &counters) {
+  size_t index = Index(size);
+  ThreadCache &cache = Cache();
+  if (FreeNode *node = cache.free[index]) {
+    cache.free[index] = node->next;
+    --cache.count[index];
+    PoolCounters::Bump(counters.hits);
+    PoolCounters::Bump(counters.allocs);
+    return node;
+  }
+  if (cache.bump[index] != cache.bump_end[index]) {
+    void *ptr = cache.bump[index];
+    cache.bump[index] += ClassSize(index);
+    PoolCounters::Bump(counters.allocs);
+    return ptr;
+  }
+  return AllocateSlow(index, counters);
+}
+
+inline void NodePool::Deallocate(void *ptr, size_t size,
+                                 PoolCounters &counters) {
+  PoolCounters::Bump(counters.deallocs);
+  size_t index = Index(size);
+  ThreadCache &cache = Cache();
+  FreeNode *node = static_cast<FreeNode *>(ptr);
+  if (!cache.guarded) {
+    if (cache.dead) {
+      SizeClass &global = Global(index);
+      std::lock_guard<std::mutex> lock(global.mutex);
+      PushFree(global, index, node);
+      return;
+    }
+    Guard(cache);
+  }
+  node->next = cache.free[index];
+  cache.free[index] = node;
+  if (++cache.count[index] > 2 * kBatch) Flush(index, cache, kBatch);
+}
+
+// кэш потока пуст: берём пачку из общего списка или свежий кусок слэба.
+// После завершения потока кэша нет, и каждый узел берётся под блокировкой
+inline void *NodePool::AllocateSlow(size_t index, PoolCounters &counters) {
+  ThreadCache &cache = Cache();
+  if (cache.dead) {
+    SizeClass &global = Global(index);
+    std::lock_guard<std::mutex> lock(global.mutex);
+    PoolCounters::Bump(counters.allocs);
+    if (FreeNode *node = PopFree(global)) {
+      PoolCounters::Bump(counters.hits);
+      return node;
+    }
+    size_t bytes = ClassSize(index);
+    return TakeRun(global, index, bytes, counters);
+  }
+  if (!cache.guarded) Guard(cache);
+  Refill(index, cache, counters);
+  return Allocate(ClassSize(index), counters);
+}
+
+inline void NodePool::Refill(size_t index, ThreadCache &cache,
+                             PoolCounters &counters) {
+  SizeClass &global = Global(index);
+  std::lock_guard<std::mutex> lock(global.mutex);
+  if (global.partial) {
+    size_t count = 0;
+    FreeNode *node;
+    while (count < kBatch && (node = PopFree(global))) {
+      node->next = cache.free[index];
+      cache.free[index] = node;
+      ++count;
+    }
+    cache.count[index] = count;
+  } else {
+    size_t bytes = kBatch * ClassSize(index);
+    cache.bump[index] = TakeRun(global, index, bytes, counters);
+    cache.bump_end[index] = cache.bump[index] + bytes;
+  }
+}
+
+// Слэб берётся у системы через mmap с запасом в kSlabBytes и обрезается
+// до выровненного по kSlabBytes куска. Выровненный operator new в glibc
+// держит под такой блок почти вдвое больше памяти, а здесь лишние
+// страницы сразу возвращаются системе
+inline void *NodePool::NewSlab() {
+  void *ptr = mmap(nullptr, 2 * kSlabBytes, PROT_READ | PROT_WRITE,
+                   MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (ptr == MAP_FAILED) throw std::bad_alloc();
+  char *base = static_cast<char *>(ptr);
+  char *slab = reinterpret_cast<char *>(
+      (reinterpret_cast<uintptr_t>(base) + kSlabBytes - 1) &
+      ~uintptr_t{kSlabBytes - 1});
+  if (slab != base) munmap(base, slab - base);
+  if (slab + kSlabBytes != base + 2 * kSlabBytes) {
+    munmap(slab + kSlabBytes, base + kSlabBytes - slab);
+  }
+  return slab;
+}
+
+inline void NodePool::FreeSlab(void *slab) { munmap(slab, kSlabBytes); }
+
+// Отрезает от текущего слэба класса до bytes байт, в bytes возвращается
+// фактическая длина. Слэб кончился — выделяется новый, выровненный по
+// своему размеру, в его начале заголовок
+inline char *NodePool::TakeRun(SizeClass &global, size_t index, size_t &bytes,
+                               PoolCounters &counters) {
+  if (global.bump == global.bump_end) {
+    char *slab = static_cast<char *>(NewSlab());
+    new (slab) Slab{nullptr, nullptr, nullptr, 0};
+    global.bump = slab + kHeader;
+    global.bump_end = global.bump + Capacity(index) * ClassSize(index);
+    LiveSlabs().fetch_add(1, std::memory_order_relaxed);
+    PoolCounters::Bump(counters.slabs);
+  }
+  bytes = std::min<size_t>(bytes, global.bump_end - global.bump);
+  char *run = global.bump;
+  global.bump += bytes;
+  return run;
+}
+
+// возвращает count узлов из головы кэша потока в общий пул
+inline void NodePool::Flush(size_t index, ThreadCache &cache, size_t count) {
+  if (!count) return;
+  cache.count[index] -= count;
+  SizeClass &global = Global(index);
+  std::lock_guard<std::mutex> lock(global.mutex);
+  for (size_t i = 0; i < count; ++i) {
+    FreeNode *node = cache.free[index];
+    cache.free[index] = node->next;
+    PushFree(global, index, node);
+  }
+}
+
+// Кладёт узел в список его слэба. Слэб с первым свободным узлом встаёт в
+// начало списка класса; слэб, все узлы которого вернулись, остаётся про
+// запас, если запасного ещё нет, иначе уходит в систему. Под mutex класса
+inline void NodePool::PushFree(SizeClass &global, size_t index,
+                               FreeNode *node) {
+  Slab *slab = SlabOf(node);
+  node->next = slab->free;
+  slab->free = node;
+  if (slab->count++ == 0) {
+    slab->prev = nullptr;
+    slab->next = global.partial;
+    if (global.partial) global.partial->prev = slab;
+    global.partial = slab;
+  }
+  if (slab->count == Capacity(index)) {
+    if (!global.spare) {
+      global.spare = slab;
+      return;
+    }
+    if (slab->prev) {
+      slab->prev->next = slab->next;
+    } else {
+      global.partial = slab->next;
+    }
+    if (slab->next) slab->next->prev = slab->prev;
+    // слэб целиком нарезан; текущий слэб класса больше не нужен
+    if (global.bump_end && SlabOf(global.bump_end - 1) == slab) {
+      global.bump = global.bump_end = nullptr;
+    }
+    FreeSlab(slab);
+    LiveSlabs().fetch_sub(1, std::memory_order_relaxed);
+  }
+}
+
+// Снимает узел со слэба в начале списка класса, nullptr — свободных нет.
+// Опустевший по свободным узлам слэб уходит из списка. Под mutex класса
+inline NodePool::FreeNode *NodePool::PopFree(SizeClass &global) {
+  Slab *slab = global.partial;
+  if (!slab) return nullptr;
+  if (slab == global.spare) global.spare = nullptr;
+  FreeNode *node = slab->free;
+  slab->free = node->next;
+  if (--slab->count == 0) {
+    global.partial = slab->next;
+    if (global.partial) global.partial->prev = nullptr;
+  }
+  return node;
+}
+
+/* pool_allocator *************************************************/
+
+template <typename T>
+template <typename U>
+pool_allocator<T>::pool_allocator(const pool_allocator<U> &) noexcept {}
+
+template <typename T>
+T *pool_allocator<T>::allocate(size_t n) {
+  if constexpr (kPooled) {
+    if (n == 1) {
+      return static_cast<T *>(NodePool::Allocate(sizeof(T), Counters()));
+    }
+  }
+  return std::allocator<T>().allocate(n);
+}
+
+template <typename T>
+void pool_allocator<T>::deallocate(T *ptr, size_t n) {
+  if constexpr (kPooled) {
+    if (n == 1) return NodePool::Deallocate(ptr, sizeof(T), Counters());
+  }
+  std::allocator<T>().deallocate(ptr, n);
+}
+
+// тот же предел, что у std::allocator: массивы уходят к нему
+template <typename T>
+size_t pool_allocator<T>::max_size() const noexcept {
+  return std::allocator_traits<std::allocator<T>>::max_size(
+      std::allocator<T>());
+}
+
+template <typename T>
+PoolStats pool_allocator<T>::stats() {
+  return Registry().Sum();
+}
+
+template <typename T>
+PoolStatsRegistry &pool_allocator<T>::Registry() {
+  static PoolStatsRegistry *registry = new PoolStatsRegistry;
+  return *registry;
+}
+
+template <typename T>
+PoolCounters &pool_allocator<T>::Counters() {
+  static thread_local PoolCounters *counters = nullptr;
+  if (!counters) counters = Registry().Register(&counters);
+  return *counters;
+}
+
+template <typename T, typename U>
+bool operator==(const pool_allocator<T> &, const pool_allocator<U> &) {
+  return true;
+}
+
+template <typename T, typename U>
+bool operator!=(const pool_allocator<T> &, const pool_allocator<U> &) {
+  return false;
+}
+
+template <typename Container>
+PoolStats node_pool_stats() {
+  return Container::node_allocator_type::stats();
+}
+}  // namespace s21
+#endif  // SRC_S21_NODE_POOL_CC_
@@ -0,0 +1,190 @@
+#ifndef SRC_S21_NODE_POOL_H_
+#define SRC_S21_NODE_POOL_H_
+
+#include <sys/mman.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <type_traits>
+
+namespace s21 {
+
+// Статистика пула для одного типа узла, сумма по всем потокам
+struct PoolStats {
+  size_t slabs_allocated = 0;  // слэбов, выделенных ради этого типа
+  size_t nodes_live = 0;       // узлов выделено и ещё не возвращено
+  size_t free_list_hits = 0;   // выделений из списка свободных узлов
+};
+
+class PoolStatsRegistry;
+
+// Счётчики одного потока для одного типа узла. Пишет только поток-владелец
+// (load + store без lock-префикса), читает кто угодно. При завершении
+// потока итоги блока переносятся в реестр, а сам блок освобождается
+struct PoolCounters {
+  std::atomic<size_t> slabs{0};
+  std::atomic<size_t> allocs{0};
+  std::atomic<size_t> deallocs{0};
+  std::atomic<size_t> hits{0};
+  PoolCounters *next = nullptr;         // в списке реестра
+  PoolCounters *thread_next = nullptr;  // в списке блоков потока
+  PoolStatsRegistry *owner = nullptr;
+  PoolCounters **slot = nullptr;  // thread_local указатель на этот блок
+
+  static void Bump(std::atomic<size_t> &counter);
+  // блоки текущего потока, их освобождает NodePool при его завершении
+  static PoolCounters *&ThreadList();
+  static void RetireThread();
+};
+
+// Список счётчиков всех потоков для одного типа узла и итоги уже
+// завершившихся потоков
+class PoolStatsRegistry {
+ public:
+  PoolCounters *Register(PoolCounters **slot);
+  void Retire(PoolCounters *counters);
+  PoolStats Sum();
+
+ private:
+  std::mutex mutex_;
+  PoolCounters *head_ = nullptr;
+  size_t slabs_ = 0;
+  size_t allocs_ = 0;
+  size_t deallocs_ = 0;
+  size_t hits_ = 0;
+};
+
+// Общий пул узлов, разбитый на классы размеров по kAlign байт до kMaxSize.
+// Каждый класс берёт у системы слэбы по kSlabBytes и раздаёт их потокам
+// пачками по kBatch узлов. У потока свой кэш на класс: список свободных
+// узлов и остаток пачки из слэба, поэтому выделение и освобождение узла
+// в обычном случае не берут блокировку. Кэш, переросший 2 * kBatch,
+// возвращает пачку в общий пул; при завершении потока кэш целиком уходит
+// в общий пул.
+//
+// В общем пуле свободные узлы лежат в списках своих слэбов. Слэб, все узлы
+// которого вернулись в общий пул, освобождается: в системе остаются только
+// слэбы с живыми узлами или узлами в кэшах потоков и не больше одного
+// пустого слэба на класс про запас. Пока слэб жив, его узлы
+// переиспользуются узлами любых типов того же класса
+class NodePool {
+ public:
+  static constexpr size_t kAlign = alignof(std::max_align_t);
+  static constexpr size_t kMaxSize = 256;
+  static constexpr size_t kClasses = kMaxSize / kAlign;
+  static constexpr size_t kSlabBytes = 64 * 1024;
+  static constexpr size_t kBatch = 32;
+
+  static void *Allocate(size_t size, PoolCounters &counters);
+  static void Deallocate(void *ptr, size_t size, PoolCounters &counters);
+  // слэбов, выделенных и ещё не возвращённых, по всем классам
+  static size_t slabs_in_use();
+
+ private:
+  struct FreeNode {
+    FreeNode *next;
+  };
+
+  // заголовок в начале слэба; слэб выровнен по kSlabBytes, так что
+  // заголовок находится по адресу узла. free и count — узлы слэба в
+  // общем пуле, prev и next — список слэбов класса, где такие узлы есть
+  struct Slab {
+    Slab *prev;
+    Slab *next;
+    FreeNode *free;
+    size_t count;
+  };
+  static constexpr size_t kHeader =
+      (sizeof(Slab) + kAlign - 1) / kAlign * kAlign;
+
+  // кэш потока — POD без деструктора: к нему можно обратиться и после
+  // разрушения thread_local объектов, например из деструктора
+  // статического контейнера. Тогда dead = true и узлы идут мимо кэша
+  struct ThreadCache {
+    FreeNode *free[kClasses];
+    size_t count[kClasses];
+    char *bump[kClasses];
+    char *bump_end[kClasses];
+    bool guarded;
+    bool dead;
+  };
+
+  // сбрасывает кэш потока в общие списки при завершении потока
+  struct CacheGuard {
+    ~CacheGuard();
+  };
+
+  struct SizeClass {
+    std::mutex mutex;
+    Slab *partial = nullptr;  // слэбы со свободными узлами
+    Slab *spare = nullptr;    // пустой слэб, оставленный про запас
+    char *bump = nullptr;
+    char *bump_end = nullptr;
+  };
+
+  static size_t Index(size_t size);
+  static size_t ClassSize(size_t index);
+  static size_t Capacity(size_t index);
+  static Slab *SlabOf(void *node);
+  static std::atomic<size_t> &LiveSlabs();
+  static void *NewSlab();
+  static void FreeSlab(void *slab);
+  static ThreadCache &Cache();
+  static SizeClass &Global(size_t index);
+  static void PushFree(SizeClass &global, size_t index, FreeNode *node);
+  static FreeNode *PopFree(SizeClass &global);
+  static void Guard(ThreadCache &cache);
+  static void *AllocateSlow(size_t index, PoolCounters &counters);
+  static void Refill(size_t index, ThreadCache &cache,
+                     PoolCounters &counters);
+  static char *TakeRun(SizeClass &global, size_t index, size_t &bytes,
+                       PoolCounters &counters);
+  static void Flush(size_t index, ThreadCache &cache, size_t count);
+};
+
+// Аллокатор узлов по умолчанию для list, map, set, multiset, stack и
+// queue. Одиночные объекты до NodePool::kMaxSize байт берутся из пула,
+// массивы и крупные объекты — из std::allocator. Без состояния: все
+// экземпляры равны, поэтому перемещение контейнеров забирает узлы
+template <typename T>
+class pool_allocator {
+ public:
+  typedef T value_type;
+  typedef std::true_type is_always_equal;
+  typedef std::true_type propagate_on_container_move_assignment;
+
+  pool_allocator() noexcept = default;
+  template <typename U>
+  pool_allocator(const pool_allocator<U> &) noexcept;
+
+  T *allocate(size_t n);
+  void deallocate(T *ptr, size_t n);
+  size_t max_size() const noexcept;
+
+  static PoolStats stats();
+
+ private:
+  static constexpr bool kPooled = sizeof(T) <= NodePool::kMaxSize &&
+                                  alignof(T) <= NodePool::kAlign;
+
+  static PoolStatsRegistry &Registry();
+  static PoolCounters &Counters();
+};
+
+template <typename T, typename U>
+bool operator==(const pool_allocator<T> &, const pool_allocator<U> &);
+template <typename T, typename U>
+bool operator!=(const pool_allocator<T> &, const pool_allocator<U> &);
+
+// Статистика пула по узлам контейнера, например
+// s21::node_pool_stats<s21::map<int, int>>()
+template <typename Container>
+PoolStats node_pool_stats();
+}  // namespace s21
+#include "s21_node_pool.cc"
+#endif  // SRC_S21_NODE_POOL_H_
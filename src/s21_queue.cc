@@ -9,23 +9,35 @@ namespace s21 {
 /* Конструкторы, деструкторы *************************************/
 
 //конструктор по умолчанию, создает пустую очередь
-template <class value_type>
-queue<value_type>::queue() : first_(nullptr), last_(nullptr), size_(0) {}
+template <class value_type, class Allocator>
+queue<value_type, Allocator>::queue() : queue(Allocator()) {}
+
+// пустая очередь, узлы которой выделяет alloc
+template <class value_type, class Allocator>
+queue<value_type, Allocator>::queue(const Allocator &alloc)
+    : first_(nullptr), last_(nullptr), size_(0), alloc_(alloc) {}
 
 //конструктор списка инициализаторов,
 //создает очередь, инициализированную с помощью std::initializer_list<T>
-template <class value_type>
-queue<value_type>::queue(std::initializer_list<value_type> const &items)
-    : queue() {
+template <class value_type, class Allocator>
+queue<value_type, Allocator>::queue(
+    std::initializer_list<value_type> const &items, const Allocator &alloc)
+    : queue(alloc) {
   for (auto i = items.begin(); i != items.end(); i++) {
     push(*i);
   }
 }
 
 //конструктор копирования
-template <class value_type>
-queue<value_type>::queue(const queue &q)
-    : first_(nullptr), last_(nullptr), size_(0) {
+template <class value_type, class Allocator>
+queue<value_type, Allocator>::queue(const queue &q)
+    : queue(q, AllocTraits::select_on_container_copy_construction(
+                   q.get_allocator())) {}
+
+// копия q, узлы которой выделяет alloc
+template <class value_type, class Allocator>
+queue<value_type, Allocator>::queue(const queue &q, const Allocator &alloc)
+    : queue(alloc) {
   if (q.first_ != nullptr && this != &q) {
     push(q.first_->data_);
     if (q.first_->pNext_ != nullptr) {
@@ -39,36 +51,87 @@ queue<value_type>::queue(const queue &q)
 }
 
 // конструктор переноса
-template <class value_type>
-queue<value_type>::queue(queue &&q)
-    : first_(nullptr), last_(nullptr), size_(0) {
+template <class value_type, class Allocator>
+queue<value_type, Allocator>::queue(queue &&q) noexcept
+    : queue(q.get_allocator()) {
   swap_queue(std::move(q));
 }
 
 //мусоросжигающая печь
-template <class value_type>
-queue<value_type>::~queue() {
+template <class value_type, class Allocator>
+queue<value_type, Allocator>::~queue() {
   while (size_) {
     pop();
   }
 }
 
-// Перегрузка оператора присваивания для движущегося объекта
-template <class value_type>
-value_type &queue<value_type>::operator=(queue &&q) {
-  this->first_ = q.first_;
-  this->last_ = q.last_;
-  this->size_ = q.size_;
-  q.first_ = q.last_ = nullptr;
-  q.size_ = 0;
+// копирующее присваивание через copy-and-swap; копия строится на том
+// аллокаторе, который останется у очереди после присваивания
+template <class value_type, class Allocator>
+queue<value_type, Allocator> &queue<value_type, Allocator>::operator=(
+    const queue &q) {
+  if (this != &q) {
+    if constexpr (AllocTraits::propagate_on_container_copy_assignment::value) {
+      queue tmp(q, q.get_allocator());
+      swap_queue(std::move(tmp));
+      std::swap(alloc_, tmp.alloc_);
+    } else {
+      queue tmp(q, get_allocator());
+      swap_queue(std::move(tmp));
+    }
+  }
+  return *this;
+}
+
+// Перегрузка оператора присваивания для движущегося объекта: узлы q
+// забираются за O(1), q остаётся пустым, старые узлы освобождаются. Узлы
+// из чужого неравного аллокатора забрать нельзя, тогда они копируются
+template <class value_type, class Allocator>
+queue<value_type, Allocator> &queue<value_type, Allocator>::operator=(
+    queue &&q) noexcept(kMoveAssignSteals) {
+  if (this != &q) {
+    if constexpr (AllocTraits::propagate_on_container_move_assignment::value) {
+      queue tmp(std::move(q));
+      swap_queue(std::move(tmp));
+      std::swap(alloc_, tmp.alloc_);
+    } else if (kMoveAssignSteals || alloc_ == q.alloc_) {
+      queue tmp(std::move(q));
+      swap_queue(std::move(tmp));
+    } else {
+      queue tmp(q, get_allocator());
+      swap_queue(std::move(tmp));
+      while (q.size_) q.pop();
+    }
+  }
   return *this;
 }
 
+template <class value_type, class Allocator>
+typename queue<value_type, Allocator>::allocator_type
+queue<value_type, Allocator>::get_allocator() const {
+  return allocator_type(alloc_);
+}
+
+// создаёт узел со значением value из аллокатора узлов
+template <class value_type, class Allocator>
+typename queue<value_type, Allocator>::Node *
+queue<value_type, Allocator>::CreateNode(const_reference value) {
+  Node *node = NodeTraits::allocate(alloc_, 1);
+  try {
+    NodeTraits::construct(alloc_, node, value);
+  } catch (...) {
+    NodeTraits::deallocate(alloc_, node, 1);
+    throw;
+  }
+  return node;
+}
+
 /******************************************************************/
 
 // получить доступ к первому элементу
-template <class value_type>
-typename s21::queue<value_type>::const_reference queue<value_type>::front() {
+template <class value_type, class Allocator>
+typename s21::queue<value_type, Allocator>::const_reference
+queue<value_type, Allocator>::front() {
   if (first_ == nullptr) {
     throw std::invalid_argument("first_ = null pointer");
   }
@@ -76,8 +139,9 @@ typename s21::queue<value_type>::const_reference queue<value_type>::front() {
 }
 
 // получить доступ к последниму элементу элементу
-template <class value_type>
-typename s21::queue<value_type>::const_reference queue<value_type>::back() {
+template <class value_type, class Allocator>
+typename s21::queue<value_type, Allocator>::const_reference
+queue<value_type, Allocator>::back() {
   if (last_ == nullptr) {
     throw std::invalid_argument("last_ = null pointer");
   }
@@ -87,43 +151,45 @@ typename s21::queue<value_type>::const_reference queue<value_type>::back() {
 /*******************************************************************/
 
 //проверяет, пуст ли контейнер
-template <class value_type>
-bool queue<value_type>::empty() const {
+template <class value_type, class Allocator>
+bool queue<value_type, Allocator>::empty() const {
   return bool(size_);
 }
 
 // возвращает количество элементов
-template <class value_type>
-typename queue<value_type>::size_type queue<value_type>::size() const {
+template <class value_type, class Allocator>
+typename queue<value_type, Allocator>::size_type
+queue<value_type, Allocator>::size() const {
   return size_;
 }
 
-template <class value_type>
-typename queue<value_type>::size_type queue<value_type>::max_size() const {
+template <class value_type, class Allocator>
+typename queue<value_type, Allocator>::size_type
+queue<value_type, Allocator>::max_size() const {
   return (SIZE_MAX / (sizeof(first_) + sizeof(first_->data_)));
 }
 
 /*******************************************************************/
 
 //вставляет элемент в конце
-template <class value_type>
-void queue<value_type>::push(const_reference value) {
+template <class value_type, class Allocator>
+void queue<value_type, Allocator>::push(const_reference value) {
   if (first_ == nullptr) {
-    first_ = last_ = new Node(value);
+    first_ = last_ = CreateNode(value);
   } else {
     Node *tmp = this->first_;
     while (tmp->pNext_ != nullptr) {
       tmp = tmp->pNext_;
     }
-    tmp->pNext_ = new Node(value);
+    tmp->pNext_ = CreateNode(value);
     last_ = tmp->pNext_;
   }
   size_++;
 }
 
 // удаляет первый элемент
-template <class value_type>
-void queue<value_type>::pop() {
+template <class value_type, class Allocator>
+void queue<value_type, Allocator>::pop() {
   if (first_ == nullptr) {
     throw std::invalid_argument("first_ = null pointer");
   }
@@ -132,20 +198,25 @@ void queue<value_type>::pop() {
   if (first_ == nullptr) {
     last_ = nullptr;
   }
-  delete tmp;
+  NodeTraits::destroy(alloc_, tmp);
+  NodeTraits::deallocate(alloc_, tmp, 1);
   size_--;
 }
 
-// меняет содержимое
-template <class value_type>
-void queue<value_type>::swap(queue &other) {
+// меняет содержимое; аллокаторы меняются, только если этого требует
+// propagate_on_container_swap
+template <class value_type, class Allocator>
+void queue<value_type, Allocator>::swap(queue &other) noexcept {
   swap_queue(std::move(other));
+  if constexpr (AllocTraits::propagate_on_container_swap::value) {
+    std::swap(alloc_, other.alloc_);
+  }
 }
 
 // добавляет новые элементы в конец контейнера
-template <class value_type>
+template <class value_type, class Allocator>
 template <class... Args>
-void queue<value_type>::emplace_back(Args &&...args) {
+void queue<value_type, Allocator>::emplace_back(Args &&...args) {
   std::vector<value_type> arguments = {args...};
   for (auto &a : arguments) {
     push(a);
@@ -154,8 +225,8 @@ void queue<value_type>::emplace_back(Args &&...args) {
 
 /**********************************************************************/
 
-template <class value_type>
-value_type &queue<value_type>::operator[](const int index) {
+template <class value_type, class Allocator>
+value_type &queue<value_type, Allocator>::operator[](const int index) {
   int counter = 0;
   Node *tmp = this->first_;
   while (tmp != nullptr) {
@@ -169,8 +240,8 @@ value_type &queue<value_type>::operator[](const int index) {
   return tmp->data_;
 }
 
-template <class value_type>
-void queue<value_type>::swap_queue(queue &&q) {
+template <class value_type, class Allocator>
+void queue<value_type, Allocator>::swap_queue(queue &&q) noexcept {
   std::swap(first_, q.first_);
   std::swap(last_, q.last_);
   std::swap(size_, q.size_);
@@ -2,11 +2,15 @@
 #define SRC_S21_QUEUE_H_
 #include <initializer_list>
 #include <iostream>
+#include <memory>
 #include <set>
 #include <vector>
 
+#include "s21_node_pool.h"
+
 namespace s21 {
-template <typename T>
+// Узлы очереди выделяет аллокатор, полученный из Allocator через rebind
+template <typename T, typename Allocator = pool_allocator<T>>
 class queue {
  public:
   //  В этой таблице перечислены внутриклассовые
@@ -17,17 +21,33 @@ class queue {
   typedef const T &const_reference;  // определяет тип постоянной ссылки
   typedef size_t size_type;  // определяет тип размера контейнера (стандартный
                              // тип — size_t)
+  typedef Allocator allocator_type;  // аллокатор элементов
+
+ private:
+  typedef std::allocator_traits<allocator_type> AllocTraits;
+
+  // перемещающее присваивание всегда забирает узлы, не копируя элементы
+  static constexpr bool kMoveAssignSteals =
+      AllocTraits::propagate_on_container_move_assignment::value ||
+      AllocTraits::is_always_equal::value;
+
+ public:
   //   В этой таблице перечислены основные публичные методы для взаимодействия с
   //   классом:
   queue();  //конструктор по умолчанию, создает пустую очередь
-  queue(std::initializer_list<value_type> const
-            &items);  //конструктор списка инициализаторов,
+  explicit queue(const Allocator &alloc);  // пустая очередь на аллокаторе
+  //конструктор списка инициализаторов,
   //создает очередь, инициализированную с помощью std::initializer_list<T>
+  queue(std::initializer_list<value_type> const &items,
+        const Allocator &alloc = Allocator());
   queue(const queue &q);  //конструктор копирования
-  queue(queue &&q);       //конструктор переноса
+  queue(const queue &q, const Allocator &alloc);  // копия на аллокаторе
+  queue(queue &&q) noexcept;  //конструктор переноса
   ~queue();               //мусоросжигающая печь
-  reference operator=(
-      queue &&q);  // Перегрузка оператора присваивания для движущегося объекта
+  queue &operator=(const queue &q);  // копирующее присваивание
+  // Перегрузка оператора присваивания для движущегося объекта
+  queue &operator=(queue &&q) noexcept(kMoveAssignSteals);
+  allocator_type get_allocator() const;  // копия аллокатора
 
   const_reference front();  // получить доступ к первому элементу
   const_reference back();  // получить доступ к последниму элементу элементу
@@ -38,13 +58,13 @@ class queue {
 
   void push(const_reference value);  //вставляет элемент в конце
   void pop();               // удаляет первый элемент
-  void swap(queue &other);  // меняет содержимое
+  void swap(queue &other) noexcept;  // меняет содержимое
   template <class... Args>
   void emplace_back(Args &&...args);  //поместить  назад
 
   /*For debug*/
   reference operator[](const int index);
-  void swap_queue(queue &&other);
+  void swap_queue(queue &&other) noexcept;
   void PrintQ();
 
  private:
@@ -58,9 +78,20 @@ class queue {
     }
   };
 
+  typedef typename AllocTraits::template rebind_alloc<Node> NodeAllocator;
+  typedef std::allocator_traits<NodeAllocator> NodeTraits;
+
+ public:
+  // аллокатор узлов, по нему s21::node_pool_stats находит статистику
+  typedef NodeAllocator node_allocator_type;
+
+ private:
   Node *first_;
   Node *last_;
   int size_;
+  NodeAllocator alloc_;
+
+  Node *CreateNode(const_reference value);
 };
 }  // namespace s21
 #include "s21_queue.cc"
@@ -4,18 +4,32 @@
 
 namespace s21 {
 
-template <class value_type>
-set<value_type>::set() : root_(nullptr), size_(0) {}
+template <class value_type, class Allocator>
+set<value_type, Allocator>::set() : set(Allocator()) {}
 
-template <class value_type>
-set<value_type>::set(std::initializer_list<value_type> const& items) : set() {
+template <class value_type, class Allocator>
+set<value_type, Allocator>::set(const Allocator& alloc)
+    : root_(nullptr), endNode_(nullptr), size_(0), alloc_(alloc) {}
+
+template <class value_type, class Allocator>
+set<value_type, Allocator>::set(std::initializer_list<value_type> const& items,
+                                const Allocator& alloc)
+    : set(alloc) {
   for (auto i = items.begin(); i != items.end(); i++) {
     insert(*i);
   }
 }
 
-template <class value_type>
-set<value_type>::set(const set& s) : set() {
+template <class value_type, class Allocator>
+set<value_type, Allocator>::set(const set& s)
+    : set(s, AllocTraits::select_on_container_copy_construction(
+                 s.get_allocator())) {}
+
+// копия s, узлы которой выделяет alloc
+template <class value_type, class Allocator>
+set<value_type, Allocator>::set(const set& s, const Allocator& alloc)
+    : set(alloc) {
+  if (s.root_ == nullptr) return;
   iterator iter;
   iter.iter_ = s.root_;
   while (iter.iter_->pLeft_ != nullptr) {
@@ -27,84 +41,156 @@ set<value_type>::set(const set& s) : set() {
   }
 }
 
-template <class value_type>
-set<value_type>::set(set&& s) {
-  if (root_ != s.root_) {
-    this->root_ = s.root_;
-    this->endNode_ = s.endNode_;
-    this->size_ = s.size_;
-    s.root_ = nullptr;
-    s.endNode_ = nullptr;
+// пустое дерево не держит узлов, поэтому перенос ничего не выделяет
+template <class value_type, class Allocator>
+set<value_type, Allocator>::set(set&& s) noexcept : set(s.get_allocator()) {
+  SwapTrees(s);
+}
+
+// копирующее присваивание через copy-and-swap; копия строится на том
+// аллокаторе, который останется у set после присваивания
+template <class value_type, class Allocator>
+set<value_type, Allocator>& set<value_type, Allocator>::operator=(
+    const set& s) {
+  if (this != &s) {
+    if constexpr (AllocTraits::propagate_on_container_copy_assignment::value) {
+      set tmp(s, s.get_allocator());
+      SwapTrees(tmp);
+      std::swap(alloc_, tmp.alloc_);
+    } else {
+      set tmp(s, get_allocator());
+      SwapTrees(tmp);
+    }
   }
+  return *this;
 }
 
-template <class value_type>
-void set<value_type>::operator=(set&& s) {
-  if (root_ != s.root_) {
-    clear();
-    this->root_ = s.root_;
-    this->endNode_ = s.endNode_;
-    this->size_ = s.size_;
-    s.root_ = nullptr;
-    s.endNode_ = nullptr;
+// перемещающее присваивание: дерево s забирается за O(1), s остаётся пустым.
+// Узлы из чужого неравного аллокатора забрать нельзя, тогда элементы
+// перемещаются по одному в новые узлы
+template <class value_type, class Allocator>
+set<value_type, Allocator>& set<value_type, Allocator>::operator=(
+    set&& s) noexcept(kMoveAssignSteals) {
+  if (this != &s) {
+    if constexpr (AllocTraits::propagate_on_container_move_assignment::value) {
+      set tmp(std::move(s));
+      SwapTrees(tmp);
+      std::swap(alloc_, tmp.alloc_);
+    } else if (kMoveAssignSteals || alloc_ == s.alloc_) {
+      set tmp(std::move(s));
+      SwapTrees(tmp);
+    } else {
+      set tmp(get_allocator());
+      if (s.root_ != nullptr) {
+        iterator iter = s.begin();
+        for (size_t i = 0; i < s.size_; i++) {
+          tmp.insert(std::move(*iter));
+          ++iter;
+        }
+      }
+      SwapTrees(tmp);
+      s.clear();
+    }
   }
+  return *this;
 }
 
-template <class value_type>
-set<value_type>::~set() {
+template <class value_type, class Allocator>
+set<value_type, Allocator>::~set() {
   if (root_ != nullptr) {
     deleteAllNodes(root_);
-    delete endNode_;
+    DestroyNode(endNode_);
     endNode_ = nullptr;
   }
 }
 
+template <class value_type, class Allocator>
+typename set<value_type, Allocator>::allocator_type
+set<value_type, Allocator>::get_allocator() const {
+  return allocator_type(alloc_);
+}
+
+// узел целиком строится аллокатором узлов
+template <class value_type, class Allocator>
+template <class... Args>
+typename set<value_type, Allocator>::Node*
+set<value_type, Allocator>::CreateNode(Args&&... args) {
+  Node* node = NodeTraits::allocate(alloc_, 1);
+  try {
+    NodeTraits::construct(alloc_, node, std::forward<Args>(args)...);
+  } catch (...) {
+    NodeTraits::deallocate(alloc_, node, 1);
+    throw;
+  }
+  return node;
+}
+
+template <class value_type, class Allocator>
+void set<value_type, Allocator>::DestroyNode(Node* node) {
+  if (node != nullptr) {
+    NodeTraits::destroy(alloc_, node);
+    NodeTraits::deallocate(alloc_, node, 1);
+  }
+}
+
+// меняет местами деревья, аллокаторы остаются на месте
+template <class value_type, class Allocator>
+void set<value_type, Allocator>::SwapTrees(set& other) noexcept {
+  std::swap(root_, other.root_);
+  std::swap(size_, other.size_);
+  std::swap(endNode_, other.endNode_);
+}
+
 //---------------------------------------------------------------------------------------------------------------------------
 
-template <class value_type>
-set<value_type>::SetIterator::SetIterator() : iter_(nullptr) {}
+template <class value_type, class Allocator>
+set<value_type, Allocator>::SetIterator::SetIterator() : iter_(nullptr) {}
 
-template <class value_type>
-set<value_type>::SetIterator::SetIterator(Node& iter) : iter_(&iter) {}
+template <class value_type, class Allocator>
+set<value_type, Allocator>::SetIterator::SetIterator(Node& iter)
+    : iter_(&iter) {}
 
-template <class value_type>
-set<value_type>::SetIterator::SetIterator(const SetIterator& iter)
+template <class value_type, class Allocator>
+set<value_type, Allocator>::SetIterator::SetIterator(const SetIterator& iter)
     : iter_(iter.iter_) {}
 
-template <class value_type>
-set<value_type>::SetIterator::~SetIterator() {
+template <class value_type, class Allocator>
+set<value_type, Allocator>::SetIterator::~SetIterator() {
   this->iter_ = nullptr;
 }
 
-template <class value_type>
-typename set<value_type>::SetIterator& set<value_type>::SetIterator::operator=(
-    const SetIterator& iter) {
+template <class value_type, class Allocator>
+typename set<value_type, Allocator>::SetIterator&
+set<value_type, Allocator>::SetIterator::operator=(const SetIterator& iter) {
   iter_ = iter.iter_;
   return *this;
 }
 
-template <class value_type>
-bool set<value_type>::SetIterator::operator==(const SetIterator& iter) const {
+template <class value_type, class Allocator>
+bool set<value_type, Allocator>::SetIterator::operator==(
+    const SetIterator& iter) const {
   if (iter_ == iter.iter_) {
     return true;
   }
   return false;
 }
 
-template <class value_type>
-bool set<value_type>::SetIterator::operator!=(const SetIterator& iter) const {
+template <class value_type, class Allocator>
+bool set<value_type, Allocator>::SetIterator::operator!=(
+    const SetIterator& iter) const {
   if (iter_ != iter.iter_) {
     return true;
   }
   return false;
 }
-template <class value_type>
-typename set<value_type>::reference set<value_type>::SetIterator::operator*() {
+template <class value_type, class Allocator>
+typename set<value_type, Allocator>::reference
+set<value_type, Allocator>::SetIterator::operator*() {
   return iter_->value_;
 }
 
-template <class value_type>
-void set<value_type>::SetIterator::operator++() {
+template <class value_type, class Allocator>
+void set<value_type, Allocator>::SetIterator::operator++() {
   if (iter_ == nullptr) {
     throw std::invalid_argument("iter_ = null pointer (operator++)");
   }
@@ -122,8 +208,8 @@ void set<value_type>::SetIterator::operator++() {
   }
 }
 
-template <class value_type>
-void set<value_type>::SetIterator::operator--() {
+template <class value_type, class Allocator>
+void set<value_type, Allocator>::SetIterator::operator--() {
   if (iter_ == nullptr) {
     throw std::invalid_argument("iter_ = null pointer (operator++)");
   }
@@ -141,8 +227,9 @@ void set<value_type>::SetIterator::operator--() {
   }
 }
 
-template <class value_type>
-typename set<value_type>::iterator set<value_type>::begin() {
+template <class value_type, class Allocator>
+typename set<value_type, Allocator>::iterator
+set<value_type, Allocator>::begin() {
   iterator first_element(*this->root_);
   if (first_element.iter_ != nullptr) {
     while (first_element.iter_->pLeft_ != nullptr) {
@@ -152,54 +239,73 @@ typename set<value_type>::iterator set<value_type>::begin() {
   return first_element;
 }
 
-template <class value_type>
-typename set<value_type>::iterator set<value_type>::end() {
+template <class value_type, class Allocator>
+typename set<value_type, Allocator>::iterator
+set<value_type, Allocator>::end() {
   iterator after_last(*this->endNode_);
   return after_last;
 }
 
-template <class value_type>
-typename set<value_type>::const_iterator set<value_type>::cbegin() const {
+template <class value_type, class Allocator>
+typename set<value_type, Allocator>::const_iterator
+set<value_type, Allocator>::cbegin() const {
   const_iterator first_element(*this->begin());
   return first_element;
 }
 
-template <class value_type>
-typename set<value_type>::const_iterator set<value_type>::cend() const {
+template <class value_type, class Allocator>
+typename set<value_type, Allocator>::const_iterator
+set<value_type, Allocator>::cend() const {
   const_iterator last_element(*this->end());
   return last_element;
 }
 
 //---------------------------------------------------------------------------------------------------------------------------
 
-template <class value_type>
-bool set<value_type>::empty() const {
+template <class value_type, class Allocator>
+bool set<value_type, Allocator>::empty() const {
   return (bool)size_;
 }
 
-template <class value_type>
-typename set<value_type>::size_type set<value_type>::size() const {
+template <class value_type, class Allocator>
+typename set<value_type, Allocator>::size_type
+set<value_type, Allocator>::size() const {
   return size_;
 }
 
-template <class value_type>
-typename set<value_type>::size_type set<value_type>::max_size() const {
-  return (SIZE_MAX / (sizeof(root_) * 3 + sizeof(this->root_->value_)));
+template <class value_type, class Allocator>
+typename set<value_type, Allocator>::size_type
+set<value_type, Allocator>::max_size() const {
+  return NodeTraits::max_size(alloc_);
 }
 
-template <class value_type>
-void set<value_type>::clear() {
+template <class value_type, class Allocator>
+void set<value_type, Allocator>::clear() {
   deleteAllNodes(root_);
-  delete endNode_;
+  DestroyNode(endNode_);
   endNode_ = nullptr;
 }
 
-template <class value_type>
-std::pair<typename set<value_type>::iterator, bool> set<value_type>::insert(
-    const_reference value) {
+template <class value_type, class Allocator>
+std::pair<typename set<value_type, Allocator>::iterator, bool>
+set<value_type, Allocator>::insert(const_reference value) {
+  return InsertValue(value);
+}
+
+template <class value_type, class Allocator>
+std::pair<typename set<value_type, Allocator>::iterator, bool>
+set<value_type, Allocator>::insert(value_type&& value) {
+  return InsertValue(std::move(value));
+}
+
+// value копируется или перемещается только в новый узел
+template <class value_type, class Allocator>
+template <typename Value>
+std::pair<typename set<value_type, Allocator>::iterator, bool>
+set<value_type, Allocator>::InsertValue(Value&& value) {
   std::pair<iterator, bool> resultPair;
   if (root_ == nullptr) {
-    root_ = new Node(value);
+    root_ = CreateNode(std::forward<Value>(value));
     size_++;
     createEndNode(root_);
     root_->pRight_ = endNode_;
@@ -207,33 +313,32 @@ std::pair<typename set<value_type>::iterator, bool> set<value_type>::insert(
     resultPair.second = true;
   } else {
     size_type size_flag = size();
-    resultPair.first.iter_ = addNode(root_, value).iter_;
+    resultPair.first.iter_ = addNode(root_, std::forward<Value>(value)).iter_;
     if (size_flag != size()) resultPair.second = true;
   }
   return resultPair;
 }
 
-template <class value_type>
-void set<value_type>::erase(iterator deleteIter) {
+template <class value_type, class Allocator>
+void set<value_type, Allocator>::erase(iterator deleteIter) {
   if (deleteIter.iter_ != nullptr) {
     iterator it = deleteOneNode(this->root_, deleteIter.iter_->value_);
-    delete it.iter_;
+    DestroyNode(it.iter_);
     it.iter_ = nullptr;
     --size_;
   }
 }
 
-template <class value_type>
-void set<value_type>::swap(set& other) {
-  if (root_ != other.root_) {
-    std::swap(root_, other.root_);
-    std::swap(size_, other.size_);
-    std::swap(endNode_, other.endNode_);
+template <class value_type, class Allocator>
+void set<value_type, Allocator>::swap(set& other) noexcept {
+  if (root_ != other.root_) SwapTrees(other);
+  if constexpr (AllocTraits::propagate_on_container_swap::value) {
+    std::swap(alloc_, other.alloc_);
   }
 }
 
-template <class value_type>
-void set<value_type>::merge(set& other) {
+template <class value_type, class Allocator>
+void set<value_type, Allocator>::merge(set& other) {
   if (root_ != other.root_) {
     iterator iter = other.begin();
     for (size_t i = 0; i < other.size_; i++) {
@@ -244,8 +349,9 @@ void set<value_type>::merge(set& other) {
   }
 }
 
-template <class value_type>
-typename set<value_type>::iterator set<value_type>::find(const_reference key) {
+template <class value_type, class Allocator>
+typename set<value_type, Allocator>::iterator
+set<value_type, Allocator>::find(const_reference key) {
   iterator iter;
   if (this->root_ != nullptr) {
     iter = this->begin();
@@ -260,8 +366,8 @@ typename set<value_type>::iterator set<value_type>::find(const_reference key) {
   return iter;
 }
 
-template <class value_type>
-bool set<value_type>::contains(const_reference key) {
+template <class value_type, class Allocator>
+bool set<value_type, Allocator>::contains(const_reference key) {
   bool result = false;
   if (find(key) != this->end()) {
     result = true;
@@ -269,11 +375,11 @@ bool set<value_type>::contains(const_reference key) {
   return result;
 }
 
-template <class value_type>
+template <class value_type, class Allocator>
 template <class... Args>
-s21::vector<std::pair<typename set<value_type>::iterator, bool>>
-set<value_type>::emplace(Args&&... args) {
-  s21::vector<std::pair<typename set<value_type>::iterator, bool>> result;
+s21::vector<std::pair<typename set<value_type, Allocator>::iterator, bool>>
+set<value_type, Allocator>::emplace(Args&&... args) {
+  s21::vector<std::pair<iterator, bool>> result;
   s21::vector<value_type> arguments = {args...};
   for (auto& a : arguments) {
     result.push_back(insert(a));
@@ -283,9 +389,10 @@ set<value_type>::emplace(Args&&... args) {
 
 //---------------------------------------------------------------------------------------------------------------------------
 
-template <class value_type>
-typename set<value_type>::iterator set<value_type>::addNode(
-    Node* node, const value_type& value) {
+template <class value_type, class Allocator>
+template <typename Value>
+typename set<value_type, Allocator>::iterator
+set<value_type, Allocator>::addNode(Node* node, Value&& value) {
   iterator result;
   if (node->value_ == value) {
     result.iter_ = node;
@@ -293,22 +400,25 @@ typename set<value_type>::iterator set<value_type>::addNode(
   }
   if (node->value_ > value) {
     if (node->pLeft_ != nullptr) {
-      result = addNode(node->pLeft_, value);
+      result = addNode(node->pLeft_, std::forward<Value>(value));
     } else {
-      node->pLeft_ = new Node(value, nullptr, nullptr, node);
+      node->pLeft_ =
+          CreateNode(std::forward<Value>(value), nullptr, nullptr, node);
       ++size_;
       result.iter_ = node->pLeft_;
     }
   } else if (node->value_ < value) {
     if (node->pRight_ != nullptr && node->pRight_ != endNode_) {
-      result = addNode(node->pRight_, value);
+      result = addNode(node->pRight_, std::forward<Value>(value));
     } else {
       if (node->pRight_ == nullptr) {
-        node->pRight_ = new Node(value, nullptr, nullptr, node);
+        node->pRight_ =
+            CreateNode(std::forward<Value>(value), nullptr, nullptr, node);
         ++size_;
         result.iter_ = node->pRight_;
       } else if (node->pRight_ == endNode_) {
-        node->pRight_ = new Node(value, nullptr, endNode_, node);
+        node->pRight_ =
+            CreateNode(std::forward<Value>(value), nullptr, endNode_, node);
         ++size_;
         endNode_->parent_ = node->pRight_;
         result.iter_ = node->pRight_;
@@ -318,8 +428,8 @@ typename set<value_type>::iterator set<value_type>::addNode(
   return result;
 }
 
-template <class value_type>
-void set<value_type>::deleteAllNodes(Node*& node) {
+template <class value_type, class Allocator>
+void set<value_type, Allocator>::deleteAllNodes(Node*& node) {
   if (node != nullptr && node != endNode_) {
     if (node->pLeft_ != nullptr) {
       deleteAllNodes(node->pLeft_);
@@ -327,13 +437,13 @@ void set<value_type>::deleteAllNodes(Node*& node) {
     if (node->pRight_ != nullptr) {
       deleteAllNodes(node->pRight_);
     }
-    delete node;
+    DestroyNode(node);
     node = nullptr;
     size_ = 0;
   }
 }
 
-// template <class value_type>
+// template <class value_type, class Allocator>
 // void set<value_type>::deleteOneNode(Node* deleteNode, const value_type& key)
 // {
 //   if (deleteNode != nullptr) {
@@ -371,7 +481,7 @@ void set<value_type>::deleteAllNodes(Node*& node) {
 //   }
 // }
 
-// template <class value_type>
+// template <class value_type, class Allocator>
 // void set<value_type>::replace(Node* deleteNode, Node* replaceNode) {
 //   Node* temp = deleteNode;
 
@@ -381,8 +491,9 @@ void set<value_type>::deleteAllNodes(Node*& node) {
 //   --size_;
 // }
 
-template <class value_type>
-typename set<value_type>::iterator set<value_type>::deleteOneNode(
+template <class value_type, class Allocator>
+typename set<value_type, Allocator>::iterator
+set<value_type, Allocator>::deleteOneNode(
     Node* deleteNode, const value_type& key) {
   iterator iter;
   if (deleteNode != nullptr) {
@@ -409,26 +520,25 @@ typename set<value_type>::iterator set<value_type>::deleteOneNode(
   return iter;
 }
 
-template <class value_type>
-void set<value_type>::replace(Node* dNode, Node* curNode) {
+template <class value_type, class Allocator>
+void set<value_type, Allocator>::replace(Node* dNode, Node* curNode) {
   dNode->value_ = curNode->value_;
   dNode->pLeft_ = curNode->pLeft_;
   dNode->pRight_ = curNode->pRight_;
 }
 
-template <class value_type>
-typename set<value_type>::value_type set<value_type>::getMinimumKey(
-    Node* curNode) {
+template <class value_type, class Allocator>
+typename set<value_type, Allocator>::value_type
+set<value_type, Allocator>::getMinimumKey(Node* curNode) {
   while (curNode->pLeft_ != nullptr) {
     curNode = curNode->pLeft_;
   }
   return curNode->value_;
 }
 
-template <class value_type>
-void set<value_type>::createEndNode(Node* node) {
-  endNode_ = new Node;
-  endNode_->value_ = 0;
+template <class value_type, class Allocator>
+void set<value_type, Allocator>::createEndNode(Node* node) {
+  endNode_ = CreateNode();
   endNode_->parent_ = node;
 }
 
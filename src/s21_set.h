@@ -2,12 +2,15 @@
 #define SRC_S21_SET_H_
 #include <initializer_list>
 #include <iostream>
+#include <memory>
 #include <set>
 
+#include "s21_node_pool.h"
 #include "s21_vector.h"
 
 namespace s21 {
-template <class Key>
+// Узлы дерева выделяет аллокатор, полученный из Allocator через rebind
+template <class Key, class Allocator = pool_allocator<Key>>
 class set {
  public:
   typedef Key key_type;
@@ -15,13 +18,29 @@ class set {
   typedef key_type& reference;
   typedef const key_type& const_reference;
   typedef size_t size_type;
+  typedef Allocator allocator_type;
 
+ protected:
+  typedef std::allocator_traits<allocator_type> AllocTraits;
+
+  // перемещающее присваивание всегда забирает узлы, не копируя элементы
+  static constexpr bool kMoveAssignSteals =
+      AllocTraits::propagate_on_container_move_assignment::value ||
+      AllocTraits::is_always_equal::value;
+
+ public:
   set();
-  set(std::initializer_list<key_type> const& items);
+  explicit set(const Allocator& alloc);
+  set(std::initializer_list<key_type> const& items,
+      const Allocator& alloc = Allocator());
   set(const set& s);
-  set(set&& s);
+  set(const set& s, const Allocator& alloc);
+  set(set&& s) noexcept;
   ~set();
-  void operator=(set&& s);
+  set& operator=(const set& s);
+  set& operator=(set&& s) noexcept(kMoveAssignSteals);
+
+  allocator_type get_allocator() const;
 
   class Node {
    public:
@@ -31,7 +50,10 @@ class set {
     Node* parent_;
     Node(value_type value = value_type(), Node* pLeft = nullptr,
          Node* pRight = nullptr, Node* parent = nullptr)
-        : value_{value}, pLeft_(pLeft), pRight_(pRight), parent_(parent) {}
+        : value_{std::move(value)},
+          pLeft_(pLeft),
+          pRight_(pRight),
+          parent_(parent) {}
   };
 
   typedef class SetIterator {
@@ -64,6 +86,7 @@ class set {
   void clear();
 
   std::pair<iterator, bool> insert(const value_type& value);
+  std::pair<iterator, bool> insert(value_type&& value);
 
   bool contains(const_reference key);
 
@@ -71,7 +94,7 @@ class set {
 
   void erase(iterator pos);
 
-  void swap(set& other);
+  void swap(set& other) noexcept;
 
   void merge(set& other);
 
@@ -80,12 +103,28 @@ class set {
   template <class... Args>
   s21::vector<std::pair<iterator, bool>> emplace(Args&&... args);
 
+ protected:
+  typedef typename AllocTraits::template rebind_alloc<Node> NodeAllocator;
+  typedef std::allocator_traits<NodeAllocator> NodeTraits;
+
+ public:
+  // аллокатор узлов, по нему s21::node_pool_stats находит статистику
+  typedef NodeAllocator node_allocator_type;
+
  protected:
   Node* root_{};
   Node* endNode_;
   size_type size_;
+  NodeAllocator alloc_;
+  template <class... Args>
+  Node* CreateNode(Args&&... args);
+  void DestroyNode(Node* node);
+  void SwapTrees(set& other) noexcept;
   void createEndNode(Node* node);
-  iterator addNode(Node* addNode, const value_type& value);
+  template <typename Value>
+  std::pair<iterator, bool> InsertValue(Value&& value);
+  template <typename Value>
+  iterator addNode(Node* addNode, Value&& value);
   void deleteAllNodes(Node*& Node);
   iterator deleteOneNode(Node* deleteNode, const value_type& key);
   value_type getMinimumKey(Node* Node);
@@ -0,0 +1,390 @@
+#ifndef SRC_S21_SIMD_CC_
+#define SRC_S21_SIMD_CC_
+
+#include "s21_simd.h"
+
+#define S21_SIMD_INLINE __attribute__((always_inline)) inline
+
+namespace s21 {
+namespace simd {
+/* Выбор набора инструкций ****************************************/
+
+inline Isa detected_isa() {
+#if defined(__x86_64__) || defined(__i386__)
+  static const Isa isa =
+      __builtin_cpu_supports("avx2") ? Isa::kAvx2 : Isa::kSse2;
+  return isa;
+#else
+  return Isa::kScalar;
+#endif
+}
+
+inline std::atomic<Isa> &IsaLimit() {
+  static std::atomic<Isa> limit(detected_isa());
+  return limit;
+}
+
+inline Isa current_isa() { return IsaLimit().load(std::memory_order_relaxed); }
+
+inline void set_isa(Isa isa) {
+  IsaLimit().store(std::min(isa, detected_isa()), std::memory_order_relaxed);
+}
+
+/* Ядра ***********************************************************/
+
+template <typename T, size_t Bytes>
+S21_SIMD_INLINE bool Kernels<T, Bytes>::Any(const Mask &mask) {
+  uint64_t words[Bytes / 8];
+  std::memcpy(words, &mask, Bytes);
+  uint64_t any = 0;
+  for (uint64_t word : words) any |= word;
+  return any != 0;
+}
+
+template <typename T, size_t Bytes>
+S21_SIMD_INLINE const T *Kernels<T, Bytes>::Find(const T *first,
+                                                 const T *last, T value) {
+  Vec needle = Vec{} + value;
+  for (; static_cast<size_t>(last - first) >= kWidth; first += kWidth) {
+    Vec x;
+    std::memcpy(&x, first, Bytes);
+    if (Any(x == needle)) break;
+  }
+  for (; first != last; ++first) {
+    if (*first == value) return first;
+  }
+  return last;
+}
+
+// Совпадения копятся в беззнаковых счётчиках по дорожкам: маска
+// сравнения равна -1, как беззнаковое — максимуму, и вычитание прибавляет
+// единицу без переполнения знакового типа. Узкие дорожки сбрасываются в
+// общий счётчик раньше, чем дойдут до максимума
+template <typename T, size_t Bytes>
+S21_SIMD_INLINE size_t Kernels<T, Bytes>::Count(const T *first,
+                                                const T *last, T value) {
+  typedef std::make_unsigned_t<typename MaskLane<sizeof(T)>::type> Counter;
+  typedef Counter Counters __attribute__((vector_size(Bytes)));
+  constexpr size_t kFlush =
+      std::min<size_t>(std::numeric_limits<Counter>::max(), 1 << 20);
+  Vec needle = Vec{} + value;
+  size_t total = 0;
+  while (static_cast<size_t>(last - first) >= kWidth) {
+    Counters lanes = Counters{};
+    for (size_t step = 0;
+         step < kFlush && static_cast<size_t>(last - first) >= kWidth;
+         ++step, first += kWidth) {
+      Vec x;
+      std::memcpy(&x, first, Bytes);
+      lanes -= reinterpret_cast<Counters>(x == needle);
+    }
+    for (size_t i = 0; i < kWidth; ++i) total += lanes[i];
+  }
+  for (; first != last; ++first) total += *first == value;
+  return total;
+}
+
+template <typename T, size_t Bytes>
+S21_SIMD_INLINE bool Kernels<T, Bytes>::Equal(const T *first1,
+                                              const T *last1,
+                                              const T *first2) {
+  for (; static_cast<size_t>(last1 - first1) >= kWidth;
+       first1 += kWidth, first2 += kWidth) {
+    Vec x, y;
+    std::memcpy(&x, first1, Bytes);
+    std::memcpy(&y, first2, Bytes);
+    if (Any(x != y)) return false;
+  }
+  for (; first1 != last1; ++first1, ++first2) {
+    if (!(*first1 == *first2)) return false;
+  }
+  return true;
+}
+
+template <typename T, size_t Bytes>
+S21_SIMD_INLINE void Kernels<T, Bytes>::Fill(T *first, T *last, T value) {
+  Vec pattern = Vec{} + value;
+  for (; static_cast<size_t>(last - first) >= kWidth; first += kWidth) {
+    std::memcpy(first, &pattern, Bytes);
+  }
+  for (; first != last; ++first) *first = value;
+}
+
+// Сначала векторно находится само значение минимума (максимума), потом
+// его первое вхождение. x < acc ? x : acc пропускает NaN в x, как и
+// std::min_element; NaN в первом элементе остаётся в acc, и тогда, как и
+// в std, ответ — первый элемент
+template <typename T, size_t Bytes>
+template <bool Max>
+S21_SIMD_INLINE const T *Kernels<T, Bytes>::Extreme(const T *first,
+                                                    const T *last) {
+  if (first == last) return last;
+  Vec acc = Vec{} + *first;
+  const T *ptr = first;
+  for (; static_cast<size_t>(last - ptr) >= kWidth; ptr += kWidth) {
+    Vec x;
+    std::memcpy(&x, ptr, Bytes);
+    if constexpr (Max) {
+      acc = acc < x ? x : acc;
+    } else {
+      acc = x < acc ? x : acc;
+    }
+  }
+  T best = acc[0];
+  for (size_t i = 1; i < kWidth; ++i) {
+    if (Max ? best < acc[i] : acc[i] < best) best = acc[i];
+  }
+  for (; ptr != last; ++ptr) {
+    if (Max ? best < *ptr : *ptr < best) best = *ptr;
+  }
+  if (!(best == best)) return first;
+  return Find(first, last, best);
+}
+
+/* Диспетчер ******************************************************/
+
+template <typename T>
+const typename Dispatch<T>::Lane *Dispatch<T>::Cast(const T *ptr) {
+  return reinterpret_cast<const Lane *>(ptr);
+}
+
+template <typename T>
+typename Dispatch<T>::Lane *Dispatch<T>::Cast(T *ptr) {
+  return reinterpret_cast<Lane *>(ptr);
+}
+
+template <typename T>
+const T *Dispatch<T>::Back(const Lane *ptr) {
+  return reinterpret_cast<const T *>(ptr);
+}
+
+#if defined(__x86_64__) || defined(__i386__)
+template <typename T>
+const typename Dispatch<T>::Lane *Dispatch<T>::FindAvx2(const Lane *first,
+                                                        const Lane *last,
+                                                        Lane value) {
+  return Kernels<Lane, 32>::Find(first, last, value);
+}
+
+template <typename T>
+size_t Dispatch<T>::CountAvx2(const Lane *first, const Lane *last,
+                              Lane value) {
+  return Kernels<Lane, 32>::Count(first, last, value);
+}
+
+template <typename T>
+bool Dispatch<T>::EqualAvx2(const Lane *first1, const Lane *last1,
+                            const Lane *first2) {
+  return Kernels<Lane, 32>::Equal(first1, last1, first2);
+}
+
+template <typename T>
+void Dispatch<T>::FillAvx2(Lane *first, Lane *last, Lane value) {
+  Kernels<Lane, 32>::Fill(first, last, value);
+}
+
+template <typename T>
+template <bool Max>
+const typename Dispatch<T>::Lane *Dispatch<T>::ExtremeAvx2(const Lane *first,
+                                                           const Lane *last) {
+  return Kernels<Lane, 32>::template Extreme<Max>(first, last);
+}
+#endif
+
+template <typename T>
+const T *Dispatch<T>::Find(const T *first, const T *last, T value) {
+  switch (current_isa()) {
+#if defined(__x86_64__) || defined(__i386__)
+    case Isa::kAvx2:
+      return Back(FindAvx2(Cast(first), Cast(last), Lane(value)));
+#endif
+    case Isa::kSse2:
+      return Back(Kernels<Lane, 16>::Find(Cast(first), Cast(last), value));
+    default:
+      return std::find(first, last, value);
+  }
+}
+
+template <typename T>
+size_t Dispatch<T>::Count(const T *first, const T *last, T value) {
+  switch (current_isa()) {
+#if defined(__x86_64__) || defined(__i386__)
+    case Isa::kAvx2:
+      return CountAvx2(Cast(first), Cast(last), Lane(value));
+#endif
+    case Isa::kSse2:
+      return Kernels<Lane, 16>::Count(Cast(first), Cast(last), value);
+    default:
+      return std::count(first, last, value);
+  }
+}
+
+template <typename T>
+bool Dispatch<T>::Equal(const T *first1, const T *last1, const T *first2) {
+  switch (current_isa()) {
+#if defined(__x86_64__) || defined(__i386__)
+    case Isa::kAvx2:
+      return EqualAvx2(Cast(first1), Cast(last1), Cast(first2));
+#endif
+    case Isa::kSse2:
+      return Kernels<Lane, 16>::Equal(Cast(first1), Cast(last1),
+                                      Cast(first2));
+    default:
+      return std::equal(first1, last1, first2);
+  }
+}
+
+template <typename T>
+void Dispatch<T>::Fill(T *first, T *last, T value) {
+  switch (current_isa()) {
+#if defined(__x86_64__) || defined(__i386__)
+    case Isa::kAvx2:
+      return FillAvx2(Cast(first), Cast(last), Lane(value));
+#endif
+    case Isa::kSse2:
+      return Kernels<Lane, 16>::Fill(Cast(first), Cast(last), value);
+    default:
+      std::fill(first, last, value);
+  }
+}
+
+template <typename T>
+template <bool Max>
+const T *Dispatch<T>::Extreme(const T *first, const T *last) {
+  switch (current_isa()) {
+#if defined(__x86_64__) || defined(__i386__)
+    case Isa::kAvx2:
+      return Back(ExtremeAvx2<Max>(Cast(first), Cast(last)));
+#endif
+    case Isa::kSse2:
+      return Back(
+          Kernels<Lane, 16>::template Extreme<Max>(Cast(first), Cast(last)));
+    default:
+      return Max ? std::max_element(first, last)
+                 : std::min_element(first, last);
+  }
+}
+
+/* Алгоритмы над диапазонами **************************************/
+
+template <typename T>
+const T *find(const T *first, const T *last,
+              const typename Identity<T>::type &value) {
+  if constexpr (kVectorizable<T>) {
+    return Dispatch<T>::Find(first, last, value);
+  } else {
+    return std::find(first, last, value);
+  }
+}
+
+template <typename T>
+T *find(T *first, T *last, const typename Identity<T>::type &value) {
+  const T *found = simd::find<T>(static_cast<const T *>(first), last, value);
+  return first + (found - first);
+}
+
+template <typename T>
+size_t count(const T *first, const T *last,
+             const typename Identity<T>::type &value) {
+  if constexpr (kVectorizable<T>) {
+    return Dispatch<T>::Count(first, last, value);
+  } else {
+    return std::count(first, last, value);
+  }
+}
+
+template <typename T>
+const T *min_element(const T *first, const T *last) {
+  if constexpr (kVectorizable<T>) {
+    return Dispatch<T>::template Extreme<false>(first, last);
+  } else {
+    return std::min_element(first, last);
+  }
+}
+
+template <typename T>
+T *min_element(T *first, T *last) {
+  const T *found = simd::min_element<T>(static_cast<const T *>(first), last);
+  return first + (found - first);
+}
+
+template <typename T>
+const T *max_element(const T *first, const T *last) {
+  if constexpr (kVectorizable<T>) {
+    return Dispatch<T>::template Extreme<true>(first, last);
+  } else {
+    return std::max_element(first, last);
+  }
+}
+
+template <typename T>
+T *max_element(T *first, T *last) {
+  const T *found = simd::max_element<T>(static_cast<const T *>(first), last);
+  return first + (found - first);
+}
+
+// целые std::equal сравнивает через memcmp, он быстрее ядра
+template <typename T>
+bool equal(const T *first1, const T *last1, const T *first2) {
+  if constexpr (kVectorizable<T> && std::is_floating_point_v<T>) {
+    return Dispatch<T>::Equal(first1, last1, first2);
+  } else {
+    return std::equal(first1, last1, first2);
+  }
+}
+
+// однобайтовые типы std::fill заполняет через memset
+template <typename T>
+void fill(T *first, T *last, const typename Identity<T>::type &value) {
+  if constexpr (kVectorizable<T> && sizeof(T) > 1) {
+    Dispatch<T>::Fill(first, last, value);
+  } else {
+    std::fill(first, last, value);
+  }
+}
+
+/* Алгоритмы над контейнерами *************************************/
+
+template <typename Container>
+auto find(Container &c, const ElementOf<Container> &value)
+    -> decltype(c.begin()) {
+  ElementOf<Container> *first = c.data();
+  return c.begin() + (simd::find(first, first + c.size(), value) - first);
+}
+
+template <typename Container>
+size_t count(Container &c, const ElementOf<Container> &value) {
+  ElementOf<Container> *first = c.data();
+  return simd::count<ElementOf<Container>>(first, first + c.size(), value);
+}
+
+template <typename Container>
+auto min_element(Container &c) -> decltype(c.begin()) {
+  ElementOf<Container> *first = c.data();
+  return c.begin() + (simd::min_element(first, first + c.size()) - first);
+}
+
+template <typename Container>
+auto max_element(Container &c) -> decltype(c.begin()) {
+  ElementOf<Container> *first = c.data();
+  return c.begin() + (simd::max_element(first, first + c.size()) - first);
+}
+
+template <typename Container>
+bool equal(Container &lhs, Container &rhs) {
+  if (lhs.size() != rhs.size()) return false;
+  ElementOf<Container> *first = lhs.data();
+  return simd::equal<ElementOf<Container>>(first, first + lhs.size(),
+                                           rhs.data());
+}
+
+template <typename Container>
+void fill(Container &c, const ElementOf<Container> &value) {
+  ElementOf<Container> *first = c.data();
+  simd::fill(first, first + c.size(), value);
+}
+}  // namespace simd
+}  // namespace s21
+
+#undef S21_SIMD_INLINE
+#endif  // SRC_S21_SIMD_CC_
@@ -0,0 +1,160 @@
+#ifndef SRC_S21_SIMD_H_
+#define SRC_S21_SIMD_H_
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+namespace s21 {
+namespace simd {
+
+// Векторные ядра линейных проходов для арифметических типов: поиск,
+// подсчёт, минимум и максимум, сравнение двух диапазонов и заполнение.
+// Ядра написаны один раз на векторных расширениях GCC/Clang и
+// собираются под 16 байт (SSE2) и 32 байта (AVX2); нужный вариант
+// выбирается при первом вызове по возможностям процессора. Остальные
+// типы и long double идут по скалярному пути, как и equal для целых и
+// fill для однобайтовых: там std уже сводится к memcmp и memset.
+// Результаты совпадают с std::find, std::count, std::min_element,
+// std::max_element, std::equal и std::fill, включая NaN и -0.0
+enum class Isa { kScalar, kSse2, kAvx2 };
+
+template <typename T>
+inline constexpr bool kVectorizable =
+    std::is_arithmetic_v<T> && !std::is_same_v<T, long double>;
+
+Isa detected_isa();
+Isa current_isa();
+// ограничивает набор инструкций сверху, для тестов и бенчмарков; выше
+// detected_isa() не поднимается
+void set_isa(Isa isa);
+
+template <typename T>
+struct Identity {
+  typedef T type;
+};
+
+template <typename T>
+const T *find(const T *first, const T *last,
+              const typename Identity<T>::type &value);
+template <typename T>
+T *find(T *first, T *last, const typename Identity<T>::type &value);
+template <typename T>
+size_t count(const T *first, const T *last,
+             const typename Identity<T>::type &value);
+template <typename T>
+const T *min_element(const T *first, const T *last);
+template <typename T>
+T *min_element(T *first, T *last);
+template <typename T>
+const T *max_element(const T *first, const T *last);
+template <typename T>
+T *max_element(T *first, T *last);
+template <typename T>
+bool equal(const T *first1, const T *last1, const T *first2);
+template <typename T>
+void fill(T *first, T *last, const typename Identity<T>::type &value);
+
+// Те же алгоритмы над непрерывным контейнером целиком: vector, array,
+// small_vector, static_vector, aligned_vector. Возвращают итераторы
+// контейнера
+template <typename Container>
+using ElementOf =
+    std::remove_pointer_t<decltype(std::declval<Container &>().data())>;
+
+template <typename Container>
+auto find(Container &c, const ElementOf<Container> &value)
+    -> decltype(c.begin());
+template <typename Container>
+size_t count(Container &c, const ElementOf<Container> &value);
+template <typename Container>
+auto min_element(Container &c) -> decltype(c.begin());
+template <typename Container>
+auto max_element(Container &c) -> decltype(c.begin());
+template <typename Container>
+bool equal(Container &lhs, Container &rhs);
+template <typename Container>
+void fill(Container &c, const ElementOf<Container> &value);
+
+// Тип дорожки маски сравнения: знаковое целое того же размера, что и T
+template <size_t Size>
+struct MaskLane;
+template <>
+struct MaskLane<1> {
+  typedef int8_t type;
+};
+template <>
+struct MaskLane<2> {
+  typedef int16_t type;
+};
+template <>
+struct MaskLane<4> {
+  typedef int32_t type;
+};
+template <>
+struct MaskLane<8> {
+  typedef int64_t type;
+};
+
+// Ядра для Bytes-байтных векторов. Всё always_inline: тело
+// компилируется в вызывающей функции, а у неё свой target
+template <typename T, size_t Bytes>
+struct Kernels {
+  typedef T Vec __attribute__((vector_size(Bytes)));
+  typedef typename MaskLane<sizeof(T)>::type Mask
+      __attribute__((vector_size(Bytes)));
+  static constexpr size_t kWidth = Bytes / sizeof(T);
+
+  static const T *Find(const T *first, const T *last, T value);
+  static size_t Count(const T *first, const T *last, T value);
+  static bool Equal(const T *first1, const T *last1, const T *first2);
+  static void Fill(T *first, T *last, T value);
+  template <bool Max>
+  static const T *Extreme(const T *first, const T *last);
+
+ private:
+  // есть ли в маске хоть одна истинная дорожка
+  static bool Any(const Mask &mask);
+};
+
+// Выбор варианта ядра. bool обрабатывается как unsigned char
+template <typename T>
+struct Dispatch {
+  typedef std::conditional_t<std::is_same_v<T, bool>, unsigned char, T> Lane;
+
+  static const T *Find(const T *first, const T *last, T value);
+  static size_t Count(const T *first, const T *last, T value);
+  static bool Equal(const T *first1, const T *last1, const T *first2);
+  static void Fill(T *first, T *last, T value);
+  template <bool Max>
+  static const T *Extreme(const T *first, const T *last);
+
+ private:
+  static const Lane *Cast(const T *ptr);
+  static Lane *Cast(T *ptr);
+  static const T *Back(const Lane *ptr);
+#if defined(__x86_64__) || defined(__i386__)
+  __attribute__((target("avx2"))) static const Lane *FindAvx2(
+      const Lane *first, const Lane *last, Lane value);
+  __attribute__((target("avx2"))) static size_t CountAvx2(const Lane *first,
+                                                          const Lane *last,
+                                                          Lane value);
+  __attribute__((target("avx2"))) static bool EqualAvx2(const Lane *first1,
+                                                        const Lane *last1,
+                                                        const Lane *first2);
+  __attribute__((target("avx2"))) static void FillAvx2(Lane *first,
+                                                       Lane *last,
+                                                       Lane value);
+  template <bool Max>
+  __attribute__((target("avx2"))) static const Lane *ExtremeAvx2(
+      const Lane *first, const Lane *last);
+#endif
+};
+}  // namespace simd
+}  // namespace s21
+#include "s21_simd.cc"
+#endif  // SRC_S21_SIMD_H_
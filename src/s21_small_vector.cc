@@ -0,0 +1,493 @@
+#ifndef SRC_S21_SMALL_VECTOR_CC_
+#define SRC_S21_SMALL_VECTOR_CC_
+
+#include "s21_small_vector.h"
+
+namespace s21 {
+/* Конструкторы, деструкторы *************************************/
+
+template <class value_type, size_t N, class Growth>
+small_vector<value_type, N, Growth>::small_vector()
+    : size_{0}, capacity_{N}, head_{Inline()} {}
+
+// остальные конструкторы делегируют пустому, поэтому при исключении
+// деструктор освободит уже выделенную кучу
+template <class value_type, size_t N, class Growth>
+small_vector<value_type, N, Growth>::small_vector(size_type n)
+    : small_vector() {
+  reserve(n);
+  std::uninitialized_value_construct_n(head_, n);
+  size_ = n;
+}
+
+template <class value_type, size_t N, class Growth>
+small_vector<value_type, N, Growth>::small_vector(size_type n, value_type x)
+    : small_vector() {
+  reserve(n);
+  std::uninitialized_fill_n(head_, n, x);
+  size_ = n;
+}
+
+template <class value_type, size_t N, class Growth>
+small_vector<value_type, N, Growth>::small_vector(
+    std::initializer_list<value_type> const &items)
+    : small_vector() {
+  reserve(items.size());
+  std::uninitialized_copy(items.begin(), items.end(), head_);
+  size_ = items.size();
+}
+
+/* Copy Constructor */
+template <class value_type, size_t N, class Growth>
+small_vector<value_type, N, Growth>::small_vector(const small_vector &v)
+    : small_vector() {
+  reserve(v.size_);
+  if constexpr (std::is_trivially_copyable_v<value_type>) {
+    if (v.size_) std::memcpy(head_, v.head_, v.size_ * sizeof(value_type));
+  } else {
+    std::uninitialized_copy_n(v.head_, v.size_, head_);
+  }
+  size_ = v.size_;
+}
+
+/* Move Constructor*/
+template <class value_type, size_t N, class Growth>
+small_vector<value_type, N, Growth>::small_vector(small_vector &&v) noexcept(
+    std::is_nothrow_move_constructible_v<value_type>)
+    : small_vector() {
+  MoveFrom(v);
+}
+
+template <class value_type, size_t N, class Growth>
+small_vector<value_type, N, Growth>::~small_vector() {
+  Reset();
+}
+
+// копирующее присваивание через copy-and-swap
+template <class value_type, size_t N, class Growth>
+small_vector<value_type, N, Growth> &
+small_vector<value_type, N, Growth>::operator=(const small_vector &v) {
+  if (this != &v) {
+    small_vector tmp(v);
+    swap(tmp);
+  }
+  return *this;
+}
+
+// Перегрузка оператора присваивания для движущегося объекта: куча v
+// забирается за O(1), встроенный буфер переносится поэлементно
+template <class value_type, size_t N, class Growth>
+small_vector<value_type, N, Growth> &
+small_vector<value_type, N, Growth>::operator=(small_vector &&v) noexcept(
+    std::is_nothrow_move_constructible_v<value_type>) {
+  if (this != &v) {
+    Reset();
+    MoveFrom(v);
+  }
+  return *this;
+}
+
+/*****************************************/
+
+template <class value_type, size_t N, class Growth>
+typename small_vector<value_type, N, Growth>::value_type *
+small_vector<value_type, N, Growth>::Inline() {
+  return reinterpret_cast<value_type *>(buffer_);
+}
+
+template <class value_type, size_t N, class Growth>
+bool small_vector<value_type, N, Growth>::IsInline() const {
+  return head_ == reinterpret_cast<const value_type *>(buffer_);
+}
+
+// уничтожает элементы, освобождает кучу и возвращается во встроенный буфер
+template <class value_type, size_t N, class Growth>
+void small_vector<value_type, N, Growth>::Reset() {
+  std::destroy_n(head_, size_);
+  if (!IsInline()) Ops::Deallocate(head_);
+  head_ = Inline();
+  capacity_ = N;
+  size_ = 0;
+}
+
+// забирает содержимое v, *this должен быть пустым и во встроенном буфере;
+// v остаётся пустым
+template <class value_type, size_t N, class Growth>
+void small_vector<value_type, N, Growth>::MoveFrom(small_vector &v) {
+  if (v.IsInline()) {
+    Ops::Relocate(v.head_, v.head_ + v.size_, head_);
+    size_ = v.size_;
+    v.clear();
+  } else {
+    head_ = v.head_;
+    capacity_ = v.capacity_;
+    size_ = v.size_;
+    v.head_ = v.Inline();
+    v.capacity_ = N;
+    v.size_ = 0;
+  }
+}
+
+// ёмкость, которую получит вектор при росте до required элементов
+template <class value_type, size_t N, class Growth>
+typename small_vector<value_type, N, Growth>::size_type
+small_vector<value_type, N, Growth>::NextCapacity(size_type required) {
+  size_type next = Growth::Next(capacity_, required);
+  if (next > max_size()) next = max_size();
+  if (required > next) throw std::length_error("capacity_ > max_size()");
+  return next;
+}
+
+// переносит элементы в буфер на new_capacity элементов; если он помещается
+// во встроенный буфер, элементы возвращаются из кучи внутрь объекта
+template <class value_type, size_t N, class Growth>
+void small_vector<value_type, N, Growth>::ReserveWithoutCheck(
+    size_type new_capacity) {
+  bool to_inline = new_capacity <= N;
+  value_type *tmp = to_inline ? Inline() : Ops::Allocate(new_capacity);
+  try {
+    Ops::Relocate(head_, head_ + size_, tmp);
+  } catch (...) {
+    if (!to_inline) Ops::Deallocate(tmp);
+    throw;
+  }
+  std::destroy_n(head_, size_);
+  if (!IsInline()) Ops::Deallocate(head_);
+  head_ = tmp;
+  capacity_ = to_inline ? N : new_capacity;
+}
+
+// освобождает место под count элементов перед pos: сдвигом на месте, если
+// хватает ёмкости, иначе одним переносом в кучу. Возвращает начало
+// неинициализированного промежутка, size_ не меняет
+template <class value_type, size_t N, class Growth>
+typename small_vector<value_type, N, Growth>::value_type *
+small_vector<value_type, N, Growth>::MakeRoom(value_type *pos,
+                                              size_type count) {
+  size_type index = pos - head_;
+  if (size_ + count <= capacity_) {
+    Ops::OpenGap(pos, head_ + size_, count);
+  } else {
+    size_type new_capacity = NextCapacity(size_ + count);
+    value_type *tmp = Ops::Allocate(new_capacity);
+    try {
+      Ops::RelocateAround(head_, pos, head_ + size_, tmp, count);
+    } catch (...) {
+      Ops::Deallocate(tmp);
+      throw;
+    }
+    std::destroy_n(head_, size_);
+    if (!IsInline()) Ops::Deallocate(head_);
+    head_ = tmp;
+    capacity_ = new_capacity;
+  }
+  return head_ + index;
+}
+
+template <class value_type, size_t N, class Growth>
+template <typename Construct>
+typename small_vector<value_type, N, Growth>::value_type *
+small_vector<value_type, N, Growth>::InsertN(value_type *pos, size_type count,
+                                             Construct construct) {
+  if (!count) return pos;
+  value_type *gap = MakeRoom(pos, count);
+  Ops::FillGap(gap, head_ + size_ + count, count, construct);
+  size_ += count;
+  return gap;
+}
+
+// позиция константного итератора в изменяемой памяти вектора
+template <class value_type, size_t N, class Growth>
+typename small_vector<value_type, N, Growth>::value_type *
+small_vector<value_type, N, Growth>::Unconst(const_iterator pos) {
+  return head_ + (pos.base() - head_);
+}
+
+/***********************************************/
+
+// доступ к указанному элементу с проверкой границ
+template <class value_type, size_t N, class Growth>
+typename small_vector<value_type, N, Growth>::reference
+small_vector<value_type, N, Growth>::at(size_type pos) {
+  if (pos < size_) return operator[](pos);
+  throw std::out_of_range("Out of range");
+}
+
+// доступ к указанному элементу
+template <class value_type, size_t N, class Growth>
+typename small_vector<value_type, N, Growth>::reference
+small_vector<value_type, N, Growth>::operator[](size_type pos) {
+  return *(head_ + pos);
+}
+
+// получить доступ к первому элементу
+template <class value_type, size_t N, class Growth>
+typename small_vector<value_type, N, Growth>::const_reference
+small_vector<value_type, N, Growth>::front() {
+  return *head_;
+}
+
+// получить доступ к последниму элементу
+template <class value_type, size_t N, class Growth>
+typename small_vector<value_type, N, Growth>::const_reference
+small_vector<value_type, N, Growth>::back() {
+  return *(head_ + size_ - 1);
+}
+
+// прямой доступ к базовому массиву: встроенному буферу или куче
+template <class value_type, size_t N, class Growth>
+typename small_vector<value_type, N, Growth>::value_type *
+small_vector<value_type, N, Growth>::data() {
+  return head_;
+}
+
+/**************************************************************/
+
+template <class value_type, size_t N, class Growth>
+typename small_vector<value_type, N, Growth>::iterator
+small_vector<value_type, N, Growth>::begin() {
+  return iterator(head_);
+}
+
+template <class value_type, size_t N, class Growth>
+typename small_vector<value_type, N, Growth>::iterator
+small_vector<value_type, N, Growth>::end() {
+  return iterator(head_ + size_);
+}
+
+template <class value_type, size_t N, class Growth>
+typename small_vector<value_type, N, Growth>::const_iterator
+small_vector<value_type, N, Growth>::begin() const {
+  return const_iterator(head_);
+}
+
+template <class value_type, size_t N, class Growth>
+typename small_vector<value_type, N, Growth>::const_iterator
+small_vector<value_type, N, Growth>::end() const {
+  return const_iterator(head_ + size_);
+}
+
+template <class value_type, size_t N, class Growth>
+typename small_vector<value_type, N, Growth>::const_iterator
+small_vector<value_type, N, Growth>::cbegin() const {
+  return const_iterator(head_);
+}
+
+template <class value_type, size_t N, class Growth>
+typename small_vector<value_type, N, Growth>::const_iterator
+small_vector<value_type, N, Growth>::cend() const {
+  return const_iterator(head_ + size_);
+}
+
+/***************************************************************/
+
+template <class value_type, size_t N, class Growth>
+bool small_vector<value_type, N, Growth>::empty() {
+  return !size_;
+}
+
+template <class value_type, size_t N, class Growth>
+typename small_vector<value_type, N, Growth>::size_type
+small_vector<value_type, N, Growth>::size() {
+  return size_;
+}
+
+template <class value_type, size_t N, class Growth>
+typename small_vector<value_type, N, Growth>::size_type
+small_vector<value_type, N, Growth>::max_size() {
+  return std::numeric_limits<int64_t>::max() / sizeof(value_type);
+}
+
+// ёмкость не опускается ниже N, поэтому reserve(n <= N) ничего не делает
+template <class value_type, size_t N, class Growth>
+void small_vector<value_type, N, Growth>::reserve(size_type size) {
+  if (size > capacity_ && size < max_size()) ReserveWithoutCheck(size);
+}
+
+template <class value_type, size_t N, class Growth>
+typename small_vector<value_type, N, Growth>::size_type
+small_vector<value_type, N, Growth>::capacity() {
+  return capacity_;
+}
+
+// освобождает лишнюю кучу; если элементы помещаются во встроенный буфер,
+// куча освобождается целиком
+template <class value_type, size_t N, class Growth>
+void small_vector<value_type, N, Growth>::shrink_to_fit() {
+  if (!IsInline() && capacity_ > size_) ReserveWithoutCheck(size_);
+}
+
+/***********************************************/
+
+// очищает содержимое, выделенная куча сохраняется
+template <class value_type, size_t N, class Growth>
+void small_vector<value_type, N, Growth>::clear() {
+  std::destroy_n(head_, size_);
+  size_ = 0;
+}
+
+template <class value_type, size_t N, class Growth>
+typename small_vector<value_type, N, Growth>::iterator
+small_vector<value_type, N, Growth>::insert(const_iterator pos,
+                                            const_reference value) {
+  // value может ссылаться на элемент, который сдвинется
+  value_type copy(value);
+  return insert(pos, std::move(copy));
+}
+
+template <class value_type, size_t N, class Growth>
+typename small_vector<value_type, N, Growth>::iterator
+small_vector<value_type, N, Growth>::insert(const_iterator pos,
+                                            value_type &&value) {
+  return iterator(InsertN(Unconst(pos), 1, [&value](value_type *ptr) {
+    new (ptr) value_type(std::move(value));
+  }));
+}
+
+template <class value_type, size_t N, class Growth>
+typename small_vector<value_type, N, Growth>::iterator
+small_vector<value_type, N, Growth>::insert(const_iterator pos,
+                                            size_type count,
+                                            const_reference value) {
+  value_type copy(value);
+  return iterator(InsertN(Unconst(pos), count, [&copy](value_type *ptr) {
+    new (ptr) value_type(copy);
+  }));
+}
+
+template <class value_type, size_t N, class Growth>
+template <typename InputIt, typename>
+typename small_vector<value_type, N, Growth>::iterator
+small_vector<value_type, N, Growth>::insert(const_iterator pos,
+                                            InputIt first, InputIt last) {
+  typedef typename std::iterator_traits<InputIt>::iterator_category Category;
+  if constexpr (std::is_base_of_v<std::forward_iterator_tag, Category>) {
+    size_type count = std::distance(first, last);
+    return iterator(InsertN(Unconst(pos), count, [&first](value_type *ptr) {
+      new (ptr) value_type(*first);
+      ++first;
+    }));
+  } else {
+    return Ops::InsertByAppend(*this, Unconst(pos) - head_, first, last);
+  }
+}
+
+template <class value_type, size_t N, class Growth>
+typename small_vector<value_type, N, Growth>::iterator
+small_vector<value_type, N, Growth>::insert(
+    const_iterator pos, std::initializer_list<value_type> items) {
+  return insert(pos, items.begin(), items.end());
+}
+
+template <class value_type, size_t N, class Growth>
+void small_vector<value_type, N, Growth>::erase(const_iterator pos) {
+  erase(pos, pos + 1);
+}
+
+template <class value_type, size_t N, class Growth>
+typename small_vector<value_type, N, Growth>::iterator
+small_vector<value_type, N, Growth>::erase(const_iterator first,
+                                           const_iterator last) {
+  value_type *from = Unconst(first);
+  size_type count = last - first;
+  if (count) {
+    std::destroy_n(from, count);
+    Ops::CloseGap(from, head_ + size_, count);
+    size_ -= count;
+  }
+  return iterator(from);
+}
+
+template <class value_type, size_t N, class Growth>
+template <typename Predicate>
+typename small_vector<value_type, N, Growth>::size_type
+small_vector<value_type, N, Growth>::erase_if(Predicate pred) {
+  value_type *last = head_ + size_;
+  value_type *out = Ops::RemoveIf(head_, last, pred);
+  size_type removed = last - out;
+  std::destroy(out, last);
+  size_ -= removed;
+  return removed;
+}
+
+template <class value_type, size_t N, class Growth>
+void small_vector<value_type, N, Growth>::push_back(const_reference value) {
+  emplace_back(value);
+}
+
+template <class value_type, size_t N, class Growth>
+void small_vector<value_type, N, Growth>::push_back(value_type &&value) {
+  emplace_back(std::move(value));
+}
+
+template <class value_type, size_t N, class Growth>
+void small_vector<value_type, N, Growth>::pop_back() {
+  if (size_ == 0)
+    throw std::invalid_argument("pointer being freed was not allocated");
+  --size_;
+  (head_ + size_)->~value_type();
+}
+
+// две кучи меняются указателями, иначе содержимое переносится через
+// временный вектор
+template <class value_type, size_t N, class Growth>
+void small_vector<value_type, N, Growth>::swap(small_vector &other) noexcept(
+    std::is_nothrow_move_constructible_v<value_type>) {
+  if (this == &other) return;
+  if (!IsInline() && !other.IsInline()) {
+    std::swap(size_, other.size_);
+    std::swap(capacity_, other.capacity_);
+    std::swap(head_, other.head_);
+  } else {
+    small_vector tmp(std::move(other));
+    other = std::move(*this);
+    *this = std::move(tmp);
+  }
+}
+
+/*************************************************************/
+
+template <class value_type, size_t N, class Growth>
+template <typename... Args>
+typename small_vector<value_type, N, Growth>::iterator
+small_vector<value_type, N, Growth>::emplace(const_iterator pos,
+                                             Args &&...args) {
+  return Ops::Emplace(*this, pos, std::forward<Args>(args)...);
+}
+
+// создаёт элемент из args прямо в конце. При переполнении элемент
+// конструируется в новой куче до переноса старых, поэтому args может
+// ссылаться на элементы этого же вектора
+template <class value_type, size_t N, class Growth>
+template <typename... Args>
+typename small_vector<value_type, N, Growth>::reference
+small_vector<value_type, N, Growth>::emplace_back(Args &&...args) {
+  if (size_ == capacity_) {
+    size_type new_capacity = NextCapacity(size_ + 1);
+    value_type *tmp = Ops::Allocate(new_capacity);
+    try {
+      new (tmp + size_) value_type(std::forward<Args>(args)...);
+    } catch (...) {
+      Ops::Deallocate(tmp);
+      throw;
+    }
+    try {
+      Ops::Relocate(head_, head_ + size_, tmp);
+    } catch (...) {
+      (tmp + size_)->~value_type();
+      Ops::Deallocate(tmp);
+      throw;
+    }
+    std::destroy_n(head_, size_);
+    if (!IsInline()) Ops::Deallocate(head_);
+    head_ = tmp;
+    capacity_ = new_capacity;
+  } else {
+    new (head_ + size_) value_type(std::forward<Args>(args)...);
+  }
+  return *(head_ + size_++);
+}
+
+}  // namespace s21
+
+#endif  // SRC_S21_SMALL_VECTOR_CC_
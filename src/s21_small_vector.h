@@ -0,0 +1,104 @@
+#ifndef SRC_S21_SMALL_VECTOR_H_
+#define SRC_S21_SMALL_VECTOR_H_
+
+#include "s21_vector.h"
+
+namespace s21 {
+
+// Вектор со встроенным буфером на N элементов: пока элементы помещаются в
+// буфер, они хранятся внутри объекта и куча не используется. При
+// переполнении элементы переносятся в кучу, дальше рост как у vector.
+// Перемещение из встроенного буфера поэлементное, из кучи — за O(1)
+template <typename T, size_t N, typename Growth = GeometricGrowth<>>
+class small_vector {
+  static_assert(N > 0, "inline capacity must be positive");
+
+ public:
+  typedef T value_type;
+  typedef T &reference;
+  typedef const T &const_reference;
+  typedef size_t size_type;
+  typedef std::ptrdiff_t difference_type;
+  typedef VectorIterator<value_type> iterator;
+  typedef VectorIterator<const value_type> const_iterator;
+
+ private:
+  typedef ElementOps<value_type> Ops;
+
+  size_type size_;
+  size_type capacity_;
+  value_type *head_;
+  alignas(value_type) unsigned char buffer_[N * sizeof(value_type)];
+
+  value_type *Inline();
+  bool IsInline() const;
+  void Reset();
+  void MoveFrom(small_vector &other);
+  size_type NextCapacity(size_type required);
+  void ReserveWithoutCheck(size_type new_capacity);
+  value_type *MakeRoom(value_type *pos, size_type count);
+  template <typename Construct>
+  value_type *InsertN(value_type *pos, size_type count, Construct construct);
+  value_type *Unconst(const_iterator pos);
+
+ public:
+  small_vector();
+  small_vector(size_type n);
+  small_vector(size_type n, value_type x);
+  small_vector(std::initializer_list<value_type> const &items);
+  small_vector(const small_vector &v);
+  small_vector(small_vector &&v) noexcept(
+      std::is_nothrow_move_constructible_v<value_type>);
+  ~small_vector();
+  small_vector &operator=(const small_vector &v);
+  small_vector &operator=(small_vector &&v) noexcept(
+      std::is_nothrow_move_constructible_v<value_type>);
+
+  reference at(size_type pos);
+  reference operator[](size_type pos);
+  const_reference front();
+  const_reference back();
+  value_type *data();
+
+  iterator begin();
+  iterator end();
+  const_iterator begin() const;
+  const_iterator end() const;
+
+  const_iterator cbegin() const;
+  const_iterator cend() const;
+
+  bool empty();
+  size_type size();
+  size_type max_size();
+  void reserve(size_type size);
+  size_type capacity();
+  void shrink_to_fit();
+
+  void clear();
+  iterator insert(const_iterator pos, const_reference value);
+  iterator insert(const_iterator pos, value_type &&value);
+  iterator insert(const_iterator pos, size_type count, const_reference value);
+  template <typename InputIt,
+            typename = std::enable_if_t<!std::is_integral_v<InputIt>>>
+  iterator insert(const_iterator pos, InputIt first, InputIt last);
+  iterator insert(const_iterator pos, std::initializer_list<value_type> items);
+  void erase(const_iterator pos);
+  iterator erase(const_iterator first, const_iterator last);
+  template <typename Predicate>
+  size_type erase_if(Predicate pred);
+  void push_back(const_reference value);
+  void push_back(value_type &&value);
+  void pop_back();
+  void swap(small_vector &other) noexcept(
+      std::is_nothrow_move_constructible_v<value_type>);
+
+  template <typename... Args>
+  iterator emplace(const_iterator pos, Args &&...args);
+
+  template <typename... Args>
+  reference emplace_back(Args &&...args);
+};
+}  // namespace s21
+#include "s21_small_vector.cc"
+#endif  // SRC_S21_SMALL_VECTOR_H_
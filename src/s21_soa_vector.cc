@@ -0,0 +1,400 @@
+#ifndef SRC_S21_SOA_VECTOR_CC_
+#define SRC_S21_SOA_VECTOR_CC_
+
+#include "s21_soa_vector.h"
+
+namespace s21 {
+/* column_span ***************************************************/
+
+template <typename T>
+column_span<T>::column_span(T *data, size_type size)
+    : data_{data}, size_{size} {}
+
+template <typename T>
+T *column_span<T>::data() const {
+  return data_;
+}
+
+template <typename T>
+typename column_span<T>::size_type column_span<T>::size() const {
+  return size_;
+}
+
+template <typename T>
+bool column_span<T>::empty() const {
+  return size_ == 0;
+}
+
+template <typename T>
+typename column_span<T>::iterator column_span<T>::begin() const {
+  return data_;
+}
+
+template <typename T>
+typename column_span<T>::iterator column_span<T>::end() const {
+  return data_ + size_;
+}
+
+template <typename T>
+T &column_span<T>::operator[](size_type pos) const {
+  return data_[pos];
+}
+
+/* ZipIterator ***************************************************/
+
+template <typename... Items>
+ZipIterator<Items...>::ZipIterator() : heads_{}, index_{0} {}
+
+template <typename... Items>
+ZipIterator<Items...>::ZipIterator(std::tuple<Items *...> heads,
+                                   difference_type index)
+    : heads_{heads}, index_{index} {}
+
+template <typename... Items>
+template <typename... Others, typename>
+ZipIterator<Items...>::ZipIterator(const ZipIterator<Others...> &other)
+    : heads_{other.heads_}, index_{other.index_} {}
+
+template <typename... Items>
+template <size_t... I>
+typename ZipIterator<Items...>::reference ZipIterator<Items...>::At(
+    difference_type pos, std::index_sequence<I...>) const {
+  return reference(std::get<I>(heads_)[pos]...);
+}
+
+template <typename... Items>
+typename ZipIterator<Items...>::reference ZipIterator<Items...>::operator*()
+    const {
+  return At(index_, std::index_sequence_for<Items...>{});
+}
+
+template <typename... Items>
+typename ZipIterator<Items...>::reference ZipIterator<Items...>::operator[](
+    difference_type n) const {
+  return At(index_ + n, std::index_sequence_for<Items...>{});
+}
+
+template <typename... Items>
+ZipIterator<Items...> &ZipIterator<Items...>::operator++() {
+  ++index_;
+  return *this;
+}
+
+template <typename... Items>
+ZipIterator<Items...> ZipIterator<Items...>::operator++(int) {
+  ZipIterator tmp(*this);
+  ++index_;
+  return tmp;
+}
+
+template <typename... Items>
+ZipIterator<Items...> &ZipIterator<Items...>::operator--() {
+  --index_;
+  return *this;
+}
+
+template <typename... Items>
+ZipIterator<Items...> ZipIterator<Items...>::operator--(int) {
+  ZipIterator tmp(*this);
+  --index_;
+  return tmp;
+}
+
+template <typename... Items>
+ZipIterator<Items...> &ZipIterator<Items...>::operator+=(difference_type n) {
+  index_ += n;
+  return *this;
+}
+
+template <typename... Items>
+ZipIterator<Items...> &ZipIterator<Items...>::operator-=(difference_type n) {
+  index_ -= n;
+  return *this;
+}
+
+template <typename... Items>
+ZipIterator<Items...> ZipIterator<Items...>::operator+(
+    difference_type n) const {
+  return ZipIterator(heads_, index_ + n);
+}
+
+template <typename... Items>
+ZipIterator<Items...> ZipIterator<Items...>::operator-(
+    difference_type n) const {
+  return ZipIterator(heads_, index_ - n);
+}
+
+template <typename... Items>
+template <typename... Others>
+typename ZipIterator<Items...>::difference_type
+ZipIterator<Items...>::operator-(const ZipIterator<Others...> &other) const {
+  return index_ - other.index_;
+}
+
+template <typename... Items>
+template <typename... Others>
+bool ZipIterator<Items...>::operator==(
+    const ZipIterator<Others...> &other) const {
+  return index_ == other.index_;
+}
+
+template <typename... Items>
+template <typename... Others>
+bool ZipIterator<Items...>::operator!=(
+    const ZipIterator<Others...> &other) const {
+  return index_ != other.index_;
+}
+
+template <typename... Items>
+template <typename... Others>
+bool ZipIterator<Items...>::operator<(
+    const ZipIterator<Others...> &other) const {
+  return index_ < other.index_;
+}
+
+template <typename... Items>
+template <typename... Others>
+bool ZipIterator<Items...>::operator>(
+    const ZipIterator<Others...> &other) const {
+  return index_ > other.index_;
+}
+
+template <typename... Items>
+template <typename... Others>
+bool ZipIterator<Items...>::operator<=(
+    const ZipIterator<Others...> &other) const {
+  return index_ <= other.index_;
+}
+
+template <typename... Items>
+template <typename... Others>
+bool ZipIterator<Items...>::operator>=(
+    const ZipIterator<Others...> &other) const {
+  return index_ >= other.index_;
+}
+
+template <typename... Items>
+typename ZipIterator<Items...>::difference_type ZipIterator<Items...>::index()
+    const {
+  return index_;
+}
+
+/* soa_vector: служебные ******************************************/
+
+template <typename... Ts>
+template <size_t... I>
+void soa_vector<Ts...>::ReserveColumns(size_type size,
+                                       std::index_sequence<I...>) {
+  (std::get<I>(columns_).reserve(size), ...);
+}
+
+template <typename... Ts>
+template <size_t... I>
+void soa_vector<Ts...>::ShrinkColumns(std::index_sequence<I...>) {
+  (std::get<I>(columns_).shrink_to_fit(), ...);
+}
+
+template <typename... Ts>
+template <size_t... I>
+void soa_vector<Ts...>::ClearColumns(std::index_sequence<I...>) {
+  (std::get<I>(columns_).clear(), ...);
+}
+
+// снимает последний элемент с первых count столбцов
+template <typename... Ts>
+template <size_t... I>
+void soa_vector<Ts...>::PopColumns(size_t count, std::index_sequence<I...>) {
+  ((I < count ? std::get<I>(columns_).pop_back() : void()), ...);
+}
+
+// ёмкости уже хватает, так что бросить может только конструктор поля;
+// тогда поля, добавленные до него, снимаются и длины столбцов равны
+template <typename... Ts>
+template <size_t... I, typename... Args>
+void soa_vector<Ts...>::EmplaceColumns(std::index_sequence<I...>,
+                                       Args &&...args) {
+  size_t done = 0;
+  try {
+    ((std::get<I>(columns_).emplace_back(std::forward<Args>(args)), ++done),
+     ...);
+  } catch (...) {
+    PopColumns(done, Fields{});
+    throw;
+  }
+}
+
+template <typename... Ts>
+template <size_t... I>
+typename soa_vector<Ts...>::reference soa_vector<Ts...>::PushTuple(
+    value_type &&value, std::index_sequence<I...>) {
+  return emplace_back(std::get<I>(std::move(value))...);
+}
+
+template <typename... Ts>
+template <size_t... I>
+typename soa_vector<Ts...>::reference soa_vector<Ts...>::Row(
+    size_type pos, std::index_sequence<I...>) {
+  return reference(std::get<I>(columns_)[pos]...);
+}
+
+template <typename... Ts>
+template <size_t... I>
+std::tuple<Ts *...> soa_vector<Ts...>::Heads(std::index_sequence<I...>) {
+  return std::tuple<Ts *...>(std::get<I>(columns_).data()...);
+}
+
+template <typename... Ts>
+template <size_t... I>
+std::tuple<const Ts *...> soa_vector<Ts...>::Heads(
+    std::index_sequence<I...>) const {
+  return std::tuple<const Ts *...>(std::get<I>(columns_).cbegin().base()...);
+}
+
+/* soa_vector *****************************************************/
+
+template <typename... Ts>
+soa_vector<Ts...>::soa_vector(std::initializer_list<value_type> const &items) {
+  reserve(items.size());
+  for (const value_type &item : items) push_back(item);
+}
+
+template <typename... Ts>
+typename soa_vector<Ts...>::reference soa_vector<Ts...>::at(size_type pos) {
+  if (pos < size()) return operator[](pos);
+  throw std::out_of_range("Out of range");
+}
+
+template <typename... Ts>
+typename soa_vector<Ts...>::reference soa_vector<Ts...>::operator[](
+    size_type pos) {
+  return Row(pos, Fields{});
+}
+
+template <typename... Ts>
+typename soa_vector<Ts...>::reference soa_vector<Ts...>::front() {
+  return Row(0, Fields{});
+}
+
+template <typename... Ts>
+typename soa_vector<Ts...>::reference soa_vector<Ts...>::back() {
+  return Row(size() - 1, Fields{});
+}
+
+template <typename... Ts>
+template <size_t I>
+column_span<typename soa_vector<Ts...>::template field_type<I>>
+soa_vector<Ts...>::column() {
+  return column_span<field_type<I>>(std::get<I>(columns_).data(), size());
+}
+
+template <typename... Ts>
+template <size_t I>
+column_span<const typename soa_vector<Ts...>::template field_type<I>>
+soa_vector<Ts...>::column() const {
+  return column_span<const field_type<I>>(
+      std::get<I>(columns_).cbegin().base(), size());
+}
+
+template <typename... Ts>
+typename soa_vector<Ts...>::iterator soa_vector<Ts...>::begin() {
+  return iterator(Heads(Fields{}), 0);
+}
+
+template <typename... Ts>
+typename soa_vector<Ts...>::iterator soa_vector<Ts...>::end() {
+  return iterator(Heads(Fields{}), size());
+}
+
+template <typename... Ts>
+typename soa_vector<Ts...>::const_iterator soa_vector<Ts...>::begin() const {
+  return const_iterator(Heads(Fields{}), 0);
+}
+
+template <typename... Ts>
+typename soa_vector<Ts...>::const_iterator soa_vector<Ts...>::end() const {
+  return const_iterator(Heads(Fields{}), size());
+}
+
+template <typename... Ts>
+typename soa_vector<Ts...>::const_iterator soa_vector<Ts...>::cbegin() const {
+  return begin();
+}
+
+template <typename... Ts>
+typename soa_vector<Ts...>::const_iterator soa_vector<Ts...>::cend() const {
+  return end();
+}
+
+template <typename... Ts>
+bool soa_vector<Ts...>::empty() const {
+  return size() == 0;
+}
+
+template <typename... Ts>
+typename soa_vector<Ts...>::size_type soa_vector<Ts...>::size() const {
+  const auto &first = std::get<0>(columns_);
+  return first.cend() - first.cbegin();
+}
+
+template <typename... Ts>
+void soa_vector<Ts...>::reserve(size_type size) {
+  ReserveColumns(size, Fields{});
+}
+
+template <typename... Ts>
+typename soa_vector<Ts...>::size_type soa_vector<Ts...>::capacity() {
+  return std::get<0>(columns_).capacity();
+}
+
+template <typename... Ts>
+void soa_vector<Ts...>::shrink_to_fit() {
+  ShrinkColumns(Fields{});
+}
+
+template <typename... Ts>
+void soa_vector<Ts...>::clear() {
+  ClearColumns(Fields{});
+}
+
+// копия снимается заранее: value может быть строкой этого же вектора
+template <typename... Ts>
+void soa_vector<Ts...>::push_back(const value_type &value) {
+  push_back(value_type(value));
+}
+
+template <typename... Ts>
+void soa_vector<Ts...>::push_back(value_type &&value) {
+  PushTuple(std::move(value), Fields{});
+}
+
+template <typename... Ts>
+void soa_vector<Ts...>::pop_back() {
+  if (empty())
+    throw std::invalid_argument("pointer being freed was not allocated");
+  PopColumns(sizeof...(Ts), Fields{});
+}
+
+template <typename... Ts>
+void soa_vector<Ts...>::swap(soa_vector &other) noexcept {
+  columns_.swap(other.columns_);
+}
+
+// все столбцы растут до одной ёмкости до вставки первого поля. При росте
+// строка сначала собирается отдельно: args может ссылаться на столбцы
+template <typename... Ts>
+template <typename... Args>
+typename soa_vector<Ts...>::reference soa_vector<Ts...>::emplace_back(
+    Args &&...args) {
+  static_assert(sizeof...(Args) == sizeof...(Ts),
+                "emplace_back takes one argument per field");
+  size_type old_size = size();
+  if (old_size == capacity()) {
+    value_type value(std::forward<Args>(args)...);
+    ReserveColumns(Growth::Next(capacity(), old_size + 1), Fields{});
+    return PushTuple(std::move(value), Fields{});
+  }
+  EmplaceColumns(Fields{}, std::forward<Args>(args)...);
+  return Row(old_size, Fields{});
+}
+}  // namespace s21
+#endif  // SRC_S21_SOA_VECTOR_CC_
@@ -0,0 +1,182 @@
+#ifndef SRC_S21_SOA_VECTOR_H_
+#define SRC_S21_SOA_VECTOR_H_
+
+#include <tuple>
+#include <utility>
+
+#include "s21_vector.h"
+
+namespace s21 {
+
+// Непрерывный участок памяти без владения: указатель и длина. Подходит
+// контейнерным перегрузкам s21::simd (data(), size(), begin())
+template <typename T>
+class column_span {
+ public:
+  typedef T value_type;
+  typedef T *iterator;
+  typedef size_t size_type;
+
+  column_span(T *data, size_type size);
+
+  T *data() const;
+  size_type size() const;
+  bool empty() const;
+  iterator begin() const;
+  iterator end() const;
+  T &operator[](size_type pos) const;
+
+ private:
+  T *data_;
+  size_type size_;
+};
+
+// Итератор по строкам soa_vector: держит начала столбцов и номер строки,
+// разыменование даёт кортеж ссылок std::tuple<Items &...> (прокси, как у
+// vector<bool>), так что работает for (auto [a, b] : v). Items — типы
+// столбцов для iterator и их const-версии для const_iterator
+template <typename... Items>
+class ZipIterator {
+ public:
+  typedef std::random_access_iterator_tag iterator_category;
+  typedef std::tuple<std::remove_const_t<Items>...> value_type;
+  typedef std::ptrdiff_t difference_type;
+  typedef std::tuple<Items &...> reference;
+  typedef void pointer;
+
+  ZipIterator();
+  ZipIterator(std::tuple<Items *...> heads, difference_type index);
+  template <typename... Others,
+            typename = std::enable_if_t<
+                (std::is_convertible_v<Others *, Items *> && ...)>>
+  ZipIterator(const ZipIterator<Others...> &other);
+
+  reference operator*() const;
+  reference operator[](difference_type n) const;
+  ZipIterator &operator++();
+  ZipIterator operator++(int);
+  ZipIterator &operator--();
+  ZipIterator operator--(int);
+  ZipIterator &operator+=(difference_type n);
+  ZipIterator &operator-=(difference_type n);
+  ZipIterator operator+(difference_type n) const;
+  ZipIterator operator-(difference_type n) const;
+  template <typename... Others>
+  difference_type operator-(const ZipIterator<Others...> &other) const;
+  template <typename... Others>
+  bool operator==(const ZipIterator<Others...> &other) const;
+  template <typename... Others>
+  bool operator!=(const ZipIterator<Others...> &other) const;
+  template <typename... Others>
+  bool operator<(const ZipIterator<Others...> &other) const;
+  template <typename... Others>
+  bool operator>(const ZipIterator<Others...> &other) const;
+  template <typename... Others>
+  bool operator<=(const ZipIterator<Others...> &other) const;
+  template <typename... Others>
+  bool operator>=(const ZipIterator<Others...> &other) const;
+  difference_type index() const;
+
+  friend ZipIterator operator+(difference_type n, const ZipIterator &it) {
+    return it + n;
+  }
+
+ private:
+  template <typename... Others>
+  friend class ZipIterator;
+
+  template <size_t... I>
+  reference At(difference_type pos, std::index_sequence<I...>) const;
+
+  std::tuple<Items *...> heads_;
+  difference_type index_;
+};
+
+// «Структура массивов»: каждое поле Ts хранится в своём s21::vector, все
+// столбцы одной длины и растут вместе по GeometricGrowth. Скан одного
+// поля читает только его столбец, а column<I>() отдаёт столбец как
+// непрерывный участок для s21::simd и своих векторных ядер. Строка
+// добавляется кортежем или набором полей; если конструктор поля бросит,
+// уже добавленные поля этой строки снимаются
+template <typename... Ts>
+class soa_vector {
+  static_assert(sizeof...(Ts) > 0, "soa_vector needs at least one field");
+
+ public:
+  typedef std::tuple<Ts...> value_type;
+  typedef std::tuple<Ts &...> reference;
+  typedef std::tuple<const Ts &...> const_reference;
+  typedef size_t size_type;
+  typedef std::ptrdiff_t difference_type;
+  typedef ZipIterator<Ts...> iterator;
+  typedef ZipIterator<const Ts...> const_iterator;
+  template <size_t I>
+  using field_type = std::tuple_element_t<I, value_type>;
+
+ private:
+  typedef std::index_sequence_for<Ts...> Fields;
+  typedef GeometricGrowth<> Growth;
+
+  std::tuple<vector<Ts>...> columns_;
+
+  template <size_t... I>
+  void ReserveColumns(size_type size, std::index_sequence<I...>);
+  template <size_t... I>
+  void ShrinkColumns(std::index_sequence<I...>);
+  template <size_t... I>
+  void ClearColumns(std::index_sequence<I...>);
+  template <size_t... I>
+  void PopColumns(size_t count, std::index_sequence<I...>);
+  template <size_t... I, typename... Args>
+  void EmplaceColumns(std::index_sequence<I...>, Args &&...args);
+  template <size_t... I>
+  reference PushTuple(value_type &&value, std::index_sequence<I...>);
+  template <size_t... I>
+  reference Row(size_type pos, std::index_sequence<I...>);
+  template <size_t... I>
+  std::tuple<Ts *...> Heads(std::index_sequence<I...>);
+  template <size_t... I>
+  std::tuple<const Ts *...> Heads(std::index_sequence<I...>) const;
+
+ public:
+  soa_vector() = default;
+  soa_vector(std::initializer_list<value_type> const &items);
+
+  reference at(size_type pos);
+  reference operator[](size_type pos);
+  reference front();
+  reference back();
+
+  // столбец поля I целиком
+  template <size_t I>
+  column_span<field_type<I>> column();
+  template <size_t I>
+  column_span<const field_type<I>> column() const;
+
+  iterator begin();
+  iterator end();
+  const_iterator begin() const;
+  const_iterator end() const;
+
+  const_iterator cbegin() const;
+  const_iterator cend() const;
+
+  bool empty() const;
+  size_type size() const;
+  void reserve(size_type size);
+  size_type capacity();
+  void shrink_to_fit();
+
+  void clear();
+  void push_back(const value_type &value);
+  void push_back(value_type &&value);
+  void pop_back();
+  void swap(soa_vector &other) noexcept;
+
+  // по одному аргументу на поле
+  template <typename... Args>
+  reference emplace_back(Args &&...args);
+};
+}  // namespace s21
+#include "s21_soa_vector.cc"
+#endif  // SRC_S21_SOA_VECTOR_H_
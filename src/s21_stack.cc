@@ -4,22 +4,34 @@
 
 namespace s21 {
 
-template <class value_type>
-stack<value_type>::stack() : head_(nullptr), size_(0) {}
+template <class value_type, class Allocator>
+stack<value_type, Allocator>::stack() : stack(Allocator()) {}
 
-template <class value_type>
-stack<value_type>::stack(std::initializer_list<value_type> const &items)
-    : stack() {
+template <class value_type, class Allocator>
+stack<value_type, Allocator>::stack(const Allocator &alloc)
+    : head_(nullptr), size_(0), alloc_(alloc) {}
+
+template <class value_type, class Allocator>
+stack<value_type, Allocator>::stack(
+    std::initializer_list<value_type> const &items, const Allocator &alloc)
+    : stack(alloc) {
   for (auto i = items.begin(); i != items.end(); i++) {
     push(*i);
   }
 }
 
 // конструктор копирования
-template <class value_type>
-stack<value_type>::stack(const stack &s) : stack() {
+template <class value_type, class Allocator>
+stack<value_type, Allocator>::stack(const stack &s)
+    : stack(s, AllocTraits::select_on_container_copy_construction(
+                   s.get_allocator())) {}
+
+// копия s, узлы которой выделяет alloc
+template <class value_type, class Allocator>
+stack<value_type, Allocator>::stack(const stack &s, const Allocator &alloc)
+    : stack(alloc) {
   if (s.head_ != nullptr && this != &s) {
-    stack<value_type> buf;
+    stack buf(alloc);
     Node *tmp = s.head_;
     while (tmp != nullptr) {
       buf.push(tmp->data_);
@@ -33,54 +45,100 @@ stack<value_type>::stack(const stack &s) : stack() {
 }
 
 // конструктор переноса
-template <class value_type>
-stack<value_type>::stack(stack &&s) : stack() {
+template <class value_type, class Allocator>
+stack<value_type, Allocator>::stack(stack &&s) noexcept
+    : stack(s.get_allocator()) {
   swap_stack(std::move(s));
 }
 
 // мусоросжигающая печь
-template <class value_type>
-stack<value_type>::~stack() {
+template <class value_type, class Allocator>
+stack<value_type, Allocator>::~stack() {
   while (size_) {
     pop();
   }
 }
 
-// Перегрузка оператора присваивания для движущегося объекта
-template <class value_type>
-typename stack<value_type>::reference stack<value_type>::operator=(stack &&s) {
-  this->size_ = s.size_;
-  this->head_ = s.head_;
-  s.head_ = nullptr;
-  s.size = 0;
+// копирующее присваивание через copy-and-swap; копия строится на том
+// аллокаторе, который останется у стека после присваивания
+template <class value_type, class Allocator>
+stack<value_type, Allocator> &stack<value_type, Allocator>::operator=(
+    const stack &s) {
+  if (this != &s) {
+    if constexpr (AllocTraits::propagate_on_container_copy_assignment::value) {
+      stack tmp(s, s.get_allocator());
+      swap_stack(std::move(tmp));
+      std::swap(alloc_, tmp.alloc_);
+    } else {
+      stack tmp(s, get_allocator());
+      swap_stack(std::move(tmp));
+    }
+  }
+  return *this;
+}
+
+// Перегрузка оператора присваивания для движущегося объекта: узлы s
+// забираются за O(1), s остаётся пустым, старые узлы освобождаются. Узлы
+// из чужого неравного аллокатора забрать нельзя, тогда они копируются
+template <class value_type, class Allocator>
+stack<value_type, Allocator> &stack<value_type, Allocator>::operator=(
+    stack &&s) noexcept(kMoveAssignSteals) {
+  if (this != &s) {
+    if constexpr (AllocTraits::propagate_on_container_move_assignment::value) {
+      stack tmp(std::move(s));
+      swap_stack(std::move(tmp));
+      std::swap(alloc_, tmp.alloc_);
+    } else if (kMoveAssignSteals || alloc_ == s.alloc_) {
+      stack tmp(std::move(s));
+      swap_stack(std::move(tmp));
+    } else {
+      stack tmp(s, get_allocator());
+      swap_stack(std::move(tmp));
+      while (s.size_) s.pop();
+    }
+  }
   return *this;
 }
 
+template <class value_type, class Allocator>
+typename stack<value_type, Allocator>::allocator_type
+stack<value_type, Allocator>::get_allocator() const {
+  return allocator_type(alloc_);
+}
+
 /*************************************************************/
 
 //обращается к верхнему элементу
-template <class value_type>
-typename s21::stack<value_type>::const_reference stack<value_type>::top() {
+template <class value_type, class Allocator>
+typename s21::stack<value_type, Allocator>::const_reference
+stack<value_type, Allocator>::top() {
   return head_->data_;
 }
 
 /****************************************************************/
 
 // проверяет, пуст ли контейнер
-template <class value_type>
-bool stack<value_type>::empty() const {
+template <class value_type, class Allocator>
+bool stack<value_type, Allocator>::empty() const {
   return bool(size_);
 }
 
 // возрощает кол-во элементов
-template <class value_type>
-typename stack<value_type>::size_type stack<value_type>::size() const {
+template <class value_type, class Allocator>
+typename stack<value_type, Allocator>::size_type
+stack<value_type, Allocator>::size() const {
   return size_;
 }
 
-template <class value_type>
-void stack<value_type>::push(const_reference value) {
-  Node *temp = new Node(value);
+template <class value_type, class Allocator>
+void stack<value_type, Allocator>::push(const_reference value) {
+  Node *temp = NodeTraits::allocate(alloc_, 1);
+  try {
+    NodeTraits::construct(alloc_, temp, value);
+  } catch (...) {
+    NodeTraits::deallocate(alloc_, temp, 1);
+    throw;
+  }
   if (size_ == 0) {
     head_ = temp;
   } else {
@@ -90,12 +148,13 @@ void stack<value_type>::push(const_reference value) {
   size_++;
 }
 
-template <class value_type>
-void stack<value_type>::pop() {
+template <class value_type, class Allocator>
+void stack<value_type, Allocator>::pop() {
   if (!head_)
     throw std::invalid_argument("pointer being freed was not allocated");
   Node *temp = head_->pNext_;
-  delete head_;
+  NodeTraits::destroy(alloc_, head_);
+  NodeTraits::deallocate(alloc_, head_, 1);
   if (size_ > 1) {
     head_ = temp;
   } else {
@@ -104,31 +163,35 @@ void stack<value_type>::pop() {
   size_--;
 }
 
-// меняет содержимое
-template <class value_type>
-void stack<value_type>::swap(stack &other) {
+// меняет содержимое; аллокаторы меняются, только если этого требует
+// propagate_on_container_swap
+template <class value_type, class Allocator>
+void stack<value_type, Allocator>::swap(stack &other) noexcept {
   swap_stack(std::move(other));
+  if constexpr (AllocTraits::propagate_on_container_swap::value) {
+    std::swap(alloc_, other.alloc_);
+  }
 }
 /******************************************************************/
 
-template <class value_type>
-void stack<value_type>::swap_stack(stack &&other) {
+template <class value_type, class Allocator>
+void stack<value_type, Allocator>::swap_stack(stack &&other) noexcept {
   std::swap(size_, other.size_);
   std::swap(head_, other.head_);
 }
 
 // добавляет новые элементы в верхнюю часть контейнера
-template <class value_type>
+template <class value_type, class Allocator>
 template <class... Args>
-void stack<value_type>::emplace_back(Args &&...args) {
+void stack<value_type, Allocator>::emplace_back(Args &&...args) {
   std::vector<value_type> arguments = {args...};
   for (auto &a : arguments) {
     push(a);
   }
 }
 
-template <class value_type>
-void stack<value_type>::printStack() {  // распечатывает и удаляет
+template <class value_type, class Allocator>
+void stack<value_type, Allocator>::printStack() {  // распечатывает и удаляет
   while (size_ != 0) {
     std::cout << this->top() << " ";
     this->pop();
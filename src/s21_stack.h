@@ -2,11 +2,15 @@
 #define SRC_S21_STACK_H_
 #include <initializer_list>
 #include <iostream>
+#include <memory>
 #include <set>
 #include <vector>
 
+#include "s21_node_pool.h"
+
 namespace s21 {
-template <typename T>
+// Узлы стека выделяет аллокатор, полученный из Allocator через rebind
+template <typename T, typename Allocator = pool_allocator<T>>
 class stack {
  public:
   /*В этой таблице перечислены внутриклассовые переопределения типов (типичные
@@ -17,17 +21,33 @@ class stack {
   typedef const T &const_reference;  //определяет тип постоянной ссылки
   typedef size_t size_type;  // определяет тип размера контейнера (стандартный
                              // тип — size_t)
+  typedef Allocator allocator_type;  // аллокатор элементов
+
+ private:
+  typedef std::allocator_traits<allocator_type> AllocTraits;
+
+  // перемещающее присваивание всегда забирает узлы, не копируя элементы
+  static constexpr bool kMoveAssignSteals =
+      AllocTraits::propagate_on_container_move_assignment::value ||
+      AllocTraits::is_always_equal::value;
+
+ public:
 
   /*конструкторы и деструкторы*/
   stack();  // конструктор по умолчанию, создает пустой стек
+  explicit stack(const Allocator &alloc);  // пустой стек на аллокаторе alloc
   ~stack();  // мусоросжигающая печь
-  stack(std::initializer_list<value_type> const
-            &s); /*конструктор списка инициализаторов, создает стек,
-инициализированный с помощью std::initializer_list<T>*/
+  /*конструктор списка инициализаторов, создает стек, инициализированный с
+   * помощью std::initializer_list<T>*/
+  stack(std::initializer_list<value_type> const &s,
+        const Allocator &alloc = Allocator());
   stack(const stack &s);  // конструктор копирования
-  stack(stack &&s);       // конструктор переноса
-  reference operator=(
-      stack &&s);  // Перегрузка оператора присваивания для движущегося объекта
+  stack(const stack &s, const Allocator &alloc);  // копия на аллокаторе alloc
+  stack(stack &&s) noexcept;  // конструктор переноса
+  stack &operator=(const stack &s);  // копирующее присваивание
+  // Перегрузка оператора присваивания для движущегося объекта
+  stack &operator=(stack &&s) noexcept(kMoveAssignSteals);
+  allocator_type get_allocator() const;  // копия аллокатора
 
   /*В этой таблице перечислены публичные методы для доступа к элементам
    * класса:*/
@@ -41,11 +61,11 @@ class stack {
   /*В этой таблице перечислены публичные методы для изменения контейнера:*/
   void push(const_reference value);  //вставляет элемент вверху
   void pop();               // удаляет верхний элемент
-  void swap(stack &other);  // меняет содержимое
+  void swap(stack &other) noexcept;  // меняет содержимое
 
   /*Для отладки*/
   void printStack();
-  void swap_stack(stack &&other);
+  void swap_stack(stack &&other) noexcept;
   // добавляет новые элементы в верхнюю часть контейнера
   template <class... Args>
   void emplace_back(Args &&...args);
@@ -60,8 +80,17 @@ class stack {
       this->pNext_ = pNext_;
     }
   };
+  typedef typename AllocTraits::template rebind_alloc<Node> NodeAllocator;
+  typedef std::allocator_traits<NodeAllocator> NodeTraits;
+
+ public:
+  // аллокатор узлов, по нему s21::node_pool_stats находит статистику
+  typedef NodeAllocator node_allocator_type;
+
+ private:
   Node *head_;
   int size_;
+  NodeAllocator alloc_;
 };
 }  // namespace s21
 #include "s21_stack.cc"
@@ -0,0 +1,503 @@
+#ifndef SRC_S21_STATIC_VECTOR_CC_
+#define SRC_S21_STATIC_VECTOR_CC_
+
+#include "s21_static_vector.h"
+
+namespace s21 {
+/* Политики переполнения *****************************************/
+
+constexpr void ThrowOnOverflow::Check(bool fits) {
+  if (!fits) throw std::length_error("static_vector capacity exceeded");
+}
+
+constexpr void AssertOnOverflow::Check(bool fits) {
+  assert(fits && "static_vector capacity exceeded");
+  (void)fits;
+}
+
+/* Хранилище тривиальных элементов ********************************/
+
+template <typename T, size_t N, bool Trivial>
+constexpr T *StaticVectorStorage<T, N, Trivial>::Data() {
+  return data_;
+}
+
+template <typename T, size_t N, bool Trivial>
+constexpr const T *StaticVectorStorage<T, N, Trivial>::Data() const {
+  return data_;
+}
+
+// ячейки массива всегда живы, поэтому создание — это присваивание
+template <typename T, size_t N, bool Trivial>
+template <typename... Args>
+constexpr void StaticVectorStorage<T, N, Trivial>::ConstructAt(
+    T *ptr, Args &&...args) {
+  *ptr = T(std::forward<Args>(args)...);
+}
+
+template <typename T, size_t N, bool Trivial>
+constexpr void StaticVectorStorage<T, N, Trivial>::Destroy(T *, T *) {}
+
+// циклы вместо memmove, чтобы оставаться constexpr; компилятор сам
+// сворачивает их в memmove
+template <typename T, size_t N, bool Trivial>
+constexpr void StaticVectorStorage<T, N, Trivial>::OpenGap(T *pos, T *last,
+                                                           size_t count) {
+  for (T *src = last; src != pos;) {
+    --src;
+    *(src + count) = *src;
+  }
+}
+
+template <typename T, size_t N, bool Trivial>
+constexpr void StaticVectorStorage<T, N, Trivial>::CloseGap(T *pos, T *last,
+                                                            size_t count) {
+  for (T *src = pos + count; src != last; ++src) *(src - count) = *src;
+}
+
+template <typename T, size_t N, bool Trivial>
+template <typename Predicate>
+constexpr T *StaticVectorStorage<T, N, Trivial>::RemoveIf(T *first, T *last,
+                                                          Predicate pred) {
+  T *out = first;
+  for (; first != last; ++first) {
+    if (!pred(*first)) *out++ = *first;
+  }
+  return out;
+}
+
+// конструирование тривиального типа не бросает, откат не нужен
+template <typename T, size_t N, bool Trivial>
+template <typename Construct>
+constexpr T *StaticVectorStorage<T, N, Trivial>::InsertN(T *pos, size_t count,
+                                                         Construct construct) {
+  OpenGap(pos, Data() + size_, count);
+  for (size_t i = 0; i < count; ++i) construct(pos + i);
+  size_ += count;
+  return pos;
+}
+
+/* Хранилище в сырой памяти ***************************************/
+
+template <typename T, size_t N>
+StaticVectorStorage<T, N, false>::StaticVectorStorage() : size_{0} {}
+
+template <typename T, size_t N>
+StaticVectorStorage<T, N, false>::StaticVectorStorage(
+    const StaticVectorStorage &other)
+    : size_{0} {
+  std::uninitialized_copy_n(other.Data(), other.size_, Data());
+  size_ = other.size_;
+}
+
+// other остаётся пустым, как у vector
+template <typename T, size_t N>
+StaticVectorStorage<T, N, false>::StaticVectorStorage(
+    StaticVectorStorage &&other) noexcept(
+    std::is_nothrow_move_constructible_v<T>)
+    : size_{0} {
+  std::uninitialized_move_n(other.Data(), other.size_, Data());
+  size_ = other.size_;
+  std::destroy_n(other.Data(), other.size_);
+  other.size_ = 0;
+}
+
+template <typename T, size_t N>
+StaticVectorStorage<T, N, false>::~StaticVectorStorage() {
+  std::destroy_n(Data(), size_);
+}
+
+// общая часть присваивается, лишние элементы создаются или уничтожаются
+template <typename T, size_t N>
+StaticVectorStorage<T, N, false> &StaticVectorStorage<T, N, false>::operator=(
+    const StaticVectorStorage &other) {
+  if (this != &other) {
+    size_t common = std::min(size_, other.size_);
+    std::copy_n(other.Data(), common, Data());
+    if (other.size_ > size_) {
+      std::uninitialized_copy(other.Data() + size_, other.Data() + other.size_,
+                              Data() + size_);
+    } else {
+      std::destroy(Data() + other.size_, Data() + size_);
+    }
+    size_ = other.size_;
+  }
+  return *this;
+}
+
+template <typename T, size_t N>
+StaticVectorStorage<T, N, false> &StaticVectorStorage<T, N, false>::operator=(
+    StaticVectorStorage &&other) noexcept(
+    std::is_nothrow_move_constructible_v<T> &&
+    std::is_nothrow_move_assignable_v<T>) {
+  if (this != &other) {
+    size_t common = std::min(size_, other.size_);
+    std::move(other.Data(), other.Data() + common, Data());
+    if (other.size_ > size_) {
+      std::uninitialized_move(other.Data() + size_, other.Data() + other.size_,
+                              Data() + size_);
+    } else {
+      std::destroy(Data() + other.size_, Data() + size_);
+    }
+    size_ = other.size_;
+    std::destroy_n(other.Data(), other.size_);
+    other.size_ = 0;
+  }
+  return *this;
+}
+
+template <typename T, size_t N>
+T *StaticVectorStorage<T, N, false>::Data() {
+  return reinterpret_cast<T *>(buffer_);
+}
+
+template <typename T, size_t N>
+const T *StaticVectorStorage<T, N, false>::Data() const {
+  return reinterpret_cast<const T *>(buffer_);
+}
+
+template <typename T, size_t N>
+template <typename... Args>
+void StaticVectorStorage<T, N, false>::ConstructAt(T *ptr, Args &&...args) {
+  new (ptr) T(std::forward<Args>(args)...);
+}
+
+template <typename T, size_t N>
+void StaticVectorStorage<T, N, false>::Destroy(T *first, T *last) {
+  std::destroy(first, last);
+}
+
+template <typename T, size_t N>
+void StaticVectorStorage<T, N, false>::OpenGap(T *pos, T *last, size_t count) {
+  ElementOps<T>::OpenGap(pos, last, count);
+}
+
+template <typename T, size_t N>
+void StaticVectorStorage<T, N, false>::CloseGap(T *pos, T *last,
+                                                size_t count) {
+  ElementOps<T>::CloseGap(pos, last, count);
+}
+
+template <typename T, size_t N>
+template <typename Predicate>
+T *StaticVectorStorage<T, N, false>::RemoveIf(T *first, T *last,
+                                              Predicate pred) {
+  return ElementOps<T>::RemoveIf(first, last, pred);
+}
+
+// вставляет count элементов перед pos, ёмкости должно хватать; откат
+// при исключении из construct делает ElementOps::FillGap
+template <typename T, size_t N>
+template <typename Construct>
+T *StaticVectorStorage<T, N, false>::InsertN(T *pos, size_t count,
+                                             Construct construct) {
+  OpenGap(pos, Data() + size_, count);
+  ElementOps<T>::FillGap(pos, Data() + size_ + count, count, construct);
+  size_ += count;
+  return pos;
+}
+
+/* Конструкторы **************************************************/
+
+// элементы создаются по одному с ростом size_, поэтому при исключении
+// деструктор хранилища уничтожит ровно созданные
+template <class value_type, size_t N, class Overflow>
+constexpr static_vector<value_type, N, Overflow>::static_vector(size_type n) {
+  Overflow::Check(n <= N);
+  for (; size_ < n; ++size_) ConstructAt(Data() + size_);
+}
+
+template <class value_type, size_t N, class Overflow>
+constexpr static_vector<value_type, N, Overflow>::static_vector(
+    size_type n, const_reference x) {
+  Overflow::Check(n <= N);
+  for (; size_ < n; ++size_) ConstructAt(Data() + size_, x);
+}
+
+template <class value_type, size_t N, class Overflow>
+constexpr static_vector<value_type, N, Overflow>::static_vector(
+    std::initializer_list<value_type> const &items) {
+  Overflow::Check(items.size() <= N);
+  for (const value_type &item : items) {
+    ConstructAt(Data() + size_, item);
+    ++size_;
+  }
+}
+
+/*****************************************/
+
+// позиция константного итератора в изменяемой памяти вектора
+template <class value_type, size_t N, class Overflow>
+constexpr typename static_vector<value_type, N, Overflow>::value_type *
+static_vector<value_type, N, Overflow>::Unconst(const_iterator pos) {
+  return Data() + (pos.base() - Data());
+}
+
+// доступ к указанному элементу с проверкой границ
+template <class value_type, size_t N, class Overflow>
+constexpr typename static_vector<value_type, N, Overflow>::reference
+static_vector<value_type, N, Overflow>::at(size_type pos) {
+  if (pos < size_) return operator[](pos);
+  throw std::out_of_range("Out of range");
+}
+
+template <class value_type, size_t N, class Overflow>
+constexpr typename static_vector<value_type, N, Overflow>::reference
+static_vector<value_type, N, Overflow>::operator[](size_type pos) {
+  return *(Data() + pos);
+}
+
+template <class value_type, size_t N, class Overflow>
+constexpr typename static_vector<value_type, N, Overflow>::const_reference
+static_vector<value_type, N, Overflow>::front() {
+  return *Data();
+}
+
+template <class value_type, size_t N, class Overflow>
+constexpr typename static_vector<value_type, N, Overflow>::const_reference
+static_vector<value_type, N, Overflow>::back() {
+  return *(Data() + size_ - 1);
+}
+
+template <class value_type, size_t N, class Overflow>
+constexpr typename static_vector<value_type, N, Overflow>::value_type *
+static_vector<value_type, N, Overflow>::data() {
+  return Data();
+}
+
+/**************************************************************/
+
+template <class value_type, size_t N, class Overflow>
+constexpr typename static_vector<value_type, N, Overflow>::iterator
+static_vector<value_type, N, Overflow>::begin() {
+  return iterator(Data());
+}
+
+template <class value_type, size_t N, class Overflow>
+constexpr typename static_vector<value_type, N, Overflow>::iterator
+static_vector<value_type, N, Overflow>::end() {
+  return iterator(Data() + size_);
+}
+
+template <class value_type, size_t N, class Overflow>
+constexpr typename static_vector<value_type, N, Overflow>::const_iterator
+static_vector<value_type, N, Overflow>::begin() const {
+  return const_iterator(Data());
+}
+
+template <class value_type, size_t N, class Overflow>
+constexpr typename static_vector<value_type, N, Overflow>::const_iterator
+static_vector<value_type, N, Overflow>::end() const {
+  return const_iterator(Data() + size_);
+}
+
+template <class value_type, size_t N, class Overflow>
+constexpr typename static_vector<value_type, N, Overflow>::const_iterator
+static_vector<value_type, N, Overflow>::cbegin() const {
+  return const_iterator(Data());
+}
+
+template <class value_type, size_t N, class Overflow>
+constexpr typename static_vector<value_type, N, Overflow>::const_iterator
+static_vector<value_type, N, Overflow>::cend() const {
+  return const_iterator(Data() + size_);
+}
+
+/***************************************************************/
+
+template <class value_type, size_t N, class Overflow>
+constexpr bool static_vector<value_type, N, Overflow>::empty() {
+  return !size_;
+}
+
+template <class value_type, size_t N, class Overflow>
+constexpr typename static_vector<value_type, N, Overflow>::size_type
+static_vector<value_type, N, Overflow>::size() {
+  return size_;
+}
+
+template <class value_type, size_t N, class Overflow>
+constexpr typename static_vector<value_type, N, Overflow>::size_type
+static_vector<value_type, N, Overflow>::max_size() {
+  return N;
+}
+
+// ёмкость фиксирована: запрос больше N — переполнение, остальное ничего не
+// делает
+template <class value_type, size_t N, class Overflow>
+constexpr void static_vector<value_type, N, Overflow>::reserve(size_type size) {
+  Overflow::Check(size <= N);
+}
+
+template <class value_type, size_t N, class Overflow>
+constexpr typename static_vector<value_type, N, Overflow>::size_type
+static_vector<value_type, N, Overflow>::capacity() {
+  return N;
+}
+
+template <class value_type, size_t N, class Overflow>
+constexpr void static_vector<value_type, N, Overflow>::shrink_to_fit() {}
+
+/***********************************************/
+
+template <class value_type, size_t N, class Overflow>
+constexpr void static_vector<value_type, N, Overflow>::clear() {
+  Destroy(Data(), Data() + size_);
+  size_ = 0;
+}
+
+template <class value_type, size_t N, class Overflow>
+constexpr typename static_vector<value_type, N, Overflow>::iterator
+static_vector<value_type, N, Overflow>::insert(const_iterator pos,
+                                               const_reference value) {
+  // value может ссылаться на элемент, который сдвинется
+  value_type copy(value);
+  return insert(pos, std::move(copy));
+}
+
+template <class value_type, size_t N, class Overflow>
+constexpr typename static_vector<value_type, N, Overflow>::iterator
+static_vector<value_type, N, Overflow>::insert(const_iterator pos,
+                                               value_type &&value) {
+  Overflow::Check(size_ < N);
+  return iterator(InsertN(Unconst(pos), 1, [&value](value_type *ptr) {
+    ConstructAt(ptr, std::move(value));
+  }));
+}
+
+template <class value_type, size_t N, class Overflow>
+constexpr typename static_vector<value_type, N, Overflow>::iterator
+static_vector<value_type, N, Overflow>::insert(const_iterator pos,
+                                               size_type count,
+                                               const_reference value) {
+  Overflow::Check(count <= N - size_);
+  value_type copy(value);
+  return iterator(InsertN(Unconst(pos), count, [&copy](value_type *ptr) {
+    ConstructAt(ptr, copy);
+  }));
+}
+
+template <class value_type, size_t N, class Overflow>
+template <typename InputIt, typename>
+constexpr typename static_vector<value_type, N, Overflow>::iterator
+static_vector<value_type, N, Overflow>::insert(const_iterator pos,
+                                               InputIt first, InputIt last) {
+  typedef typename std::iterator_traits<InputIt>::iterator_category Category;
+  if constexpr (std::is_base_of_v<std::forward_iterator_tag, Category>) {
+    size_type count = std::distance(first, last);
+    Overflow::Check(count <= N - size_);
+    return iterator(InsertN(Unconst(pos), count, [&first](value_type *ptr) {
+      ConstructAt(ptr, *first);
+      ++first;
+    }));
+  } else {
+    // переполнение ловит emplace_back политикой Overflow, как у push_back
+    return Ops::InsertByAppend(*this, Unconst(pos) - Data(), first, last);
+  }
+}
+
+template <class value_type, size_t N, class Overflow>
+constexpr typename static_vector<value_type, N, Overflow>::iterator
+static_vector<value_type, N, Overflow>::insert(
+    const_iterator pos, std::initializer_list<value_type> items) {
+  return insert(pos, items.begin(), items.end());
+}
+
+template <class value_type, size_t N, class Overflow>
+constexpr void static_vector<value_type, N, Overflow>::erase(
+    const_iterator pos) {
+  erase(pos, pos + 1);
+}
+
+template <class value_type, size_t N, class Overflow>
+constexpr typename static_vector<value_type, N, Overflow>::iterator
+static_vector<value_type, N, Overflow>::erase(const_iterator first,
+                                              const_iterator last) {
+  value_type *from = Unconst(first);
+  size_type count = last - first;
+  if (count) {
+    Destroy(from, from + count);
+    CloseGap(from, Data() + size_, count);
+    size_ -= count;
+  }
+  return iterator(from);
+}
+
+template <class value_type, size_t N, class Overflow>
+template <typename Predicate>
+constexpr typename static_vector<value_type, N, Overflow>::size_type
+static_vector<value_type, N, Overflow>::erase_if(Predicate pred) {
+  value_type *last = Data() + size_;
+  value_type *out = RemoveIf(Data(), last, pred);
+  size_type removed = last - out;
+  Destroy(out, last);
+  size_ -= removed;
+  return removed;
+}
+
+template <class value_type, size_t N, class Overflow>
+constexpr void static_vector<value_type, N, Overflow>::push_back(
+    const_reference value) {
+  emplace_back(value);
+}
+
+template <class value_type, size_t N, class Overflow>
+constexpr void static_vector<value_type, N, Overflow>::push_back(
+    value_type &&value) {
+  emplace_back(std::move(value));
+}
+
+template <class value_type, size_t N, class Overflow>
+constexpr void static_vector<value_type, N, Overflow>::pop_back() {
+  if (size_ == 0)
+    throw std::invalid_argument("pointer being freed was not allocated");
+  --size_;
+  Destroy(Data() + size_, Data() + size_ + 1);
+}
+
+// общая часть меняется поэлементно, хвост длинного вектора переносится в
+// короткий
+template <class value_type, size_t N, class Overflow>
+constexpr void static_vector<value_type, N, Overflow>::swap(
+    static_vector &other) noexcept(
+    std::is_nothrow_move_constructible_v<value_type> &&
+    std::is_nothrow_move_assignable_v<value_type>) {
+  if (this == &other) return;
+  static_vector &shorter = size_ < other.size_ ? *this : other;
+  static_vector &longer = size_ < other.size_ ? other : *this;
+  size_type common = shorter.size_;
+  for (size_type i = 0; i < common; ++i) {
+    value_type tmp(std::move(shorter[i]));
+    shorter[i] = std::move(longer[i]);
+    longer[i] = std::move(tmp);
+  }
+  for (; shorter.size_ < longer.size_; ++shorter.size_) {
+    ConstructAt(shorter.Data() + shorter.size_,
+                std::move(longer[shorter.size_]));
+  }
+  Destroy(longer.Data() + common, longer.Data() + longer.size_);
+  longer.size_ = common;
+}
+
+/*************************************************************/
+
+template <class value_type, size_t N, class Overflow>
+template <typename... Args>
+constexpr typename static_vector<value_type, N, Overflow>::iterator
+static_vector<value_type, N, Overflow>::emplace(const_iterator pos,
+                                                Args &&...args) {
+  return Ops::Emplace(*this, pos, std::forward<Args>(args)...);
+}
+
+template <class value_type, size_t N, class Overflow>
+template <typename... Args>
+constexpr typename static_vector<value_type, N, Overflow>::reference
+static_vector<value_type, N, Overflow>::emplace_back(Args &&...args) {
+  Overflow::Check(size_ < N);
+  ConstructAt(Data() + size_, std::forward<Args>(args)...);
+  return *(Data() + size_++);
+}
+
+}  // namespace s21
+
+#endif  // SRC_S21_STATIC_VECTOR_CC_
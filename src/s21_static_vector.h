@@ -0,0 +1,163 @@
+#ifndef SRC_S21_STATIC_VECTOR_H_
+#define SRC_S21_STATIC_VECTOR_H_
+
+#include <cassert>
+
+#include "s21_vector.h"
+
+namespace s21 {
+
+// Политики static_vector при попытке превысить ёмкость N: исключение
+// std::length_error или assert, который в сборке с NDEBUG исчезает вместе
+// с проверкой
+struct ThrowOnOverflow {
+  static constexpr void Check(bool fits);
+};
+
+struct AssertOnOverflow {
+  static constexpr void Check(bool fits);
+};
+
+// Хранилище static_vector для тривиальных T — обычный массив: все операции
+// constexpr, а сам вектор тривиально копируем. Плата за это — обнуление
+// массива при создании, C++17 требует инициализировать все поля в
+// constexpr-конструкторе
+template <typename T, size_t N, bool Trivial = std::is_trivial_v<T>>
+class StaticVectorStorage {
+ protected:
+  constexpr T *Data();
+  constexpr const T *Data() const;
+  template <typename... Args>
+  static constexpr void ConstructAt(T *ptr, Args &&...args);
+  static constexpr void Destroy(T *first, T *last);
+  static constexpr void OpenGap(T *pos, T *last, size_t count);
+  static constexpr void CloseGap(T *pos, T *last, size_t count);
+  template <typename Predicate>
+  static constexpr T *RemoveIf(T *first, T *last, Predicate pred);
+  template <typename Construct>
+  constexpr T *InsertN(T *pos, size_t count, Construct construct);
+
+  size_t size_ = 0;
+  T data_[N] = {};
+};
+
+// Для остальных T — сырая память внутри объекта, элементы создаются и
+// уничтожаются вручную через ElementOps
+template <typename T, size_t N>
+class StaticVectorStorage<T, N, false> {
+ protected:
+  StaticVectorStorage();
+  StaticVectorStorage(const StaticVectorStorage &other);
+  StaticVectorStorage(StaticVectorStorage &&other) noexcept(
+      std::is_nothrow_move_constructible_v<T>);
+  ~StaticVectorStorage();
+  StaticVectorStorage &operator=(const StaticVectorStorage &other);
+  StaticVectorStorage &operator=(StaticVectorStorage &&other) noexcept(
+      std::is_nothrow_move_constructible_v<T> &&
+      std::is_nothrow_move_assignable_v<T>);
+
+  T *Data();
+  const T *Data() const;
+  template <typename... Args>
+  static void ConstructAt(T *ptr, Args &&...args);
+  static void Destroy(T *first, T *last);
+  static void OpenGap(T *pos, T *last, size_t count);
+  static void CloseGap(T *pos, T *last, size_t count);
+  template <typename Predicate>
+  static T *RemoveIf(T *first, T *last, Predicate pred);
+  template <typename Construct>
+  T *InsertN(T *pos, size_t count, Construct construct);
+
+  size_t size_;
+  alignas(T) unsigned char buffer_[N * sizeof(T)];
+};
+
+// Вектор с фиксированной ёмкостью N внутри объекта, куча не используется
+// никогда. Занимает место между array (фиксированный размер) и vector
+// (куча): размер меняется, ёмкость — нет. Превышение ёмкости обрабатывает
+// политика Overflow
+template <typename T, size_t N, typename Overflow = ThrowOnOverflow>
+class static_vector : private StaticVectorStorage<T, N> {
+  static_assert(N > 0, "capacity must be positive");
+
+ public:
+  typedef T value_type;
+  typedef T &reference;
+  typedef const T &const_reference;
+  typedef size_t size_type;
+  typedef std::ptrdiff_t difference_type;
+  typedef VectorIterator<value_type> iterator;
+  typedef VectorIterator<const value_type> const_iterator;
+
+ private:
+  typedef StaticVectorStorage<T, N> Storage;
+  typedef ElementOps<value_type> Ops;
+  using Storage::CloseGap;
+  using Storage::ConstructAt;
+  using Storage::Data;
+  using Storage::Destroy;
+  using Storage::InsertN;
+  using Storage::OpenGap;
+  using Storage::RemoveIf;
+  using Storage::size_;
+
+  constexpr value_type *Unconst(const_iterator pos);
+
+ public:
+  // копирование, перемещение и уничтожение берутся из хранилища
+  static_vector() = default;
+  constexpr static_vector(size_type n);
+  constexpr static_vector(size_type n, const_reference x);
+  constexpr static_vector(std::initializer_list<value_type> const &items);
+
+  constexpr reference at(size_type pos);
+  constexpr reference operator[](size_type pos);
+  constexpr const_reference front();
+  constexpr const_reference back();
+  constexpr value_type *data();
+
+  constexpr iterator begin();
+  constexpr iterator end();
+  constexpr const_iterator begin() const;
+  constexpr const_iterator end() const;
+
+  constexpr const_iterator cbegin() const;
+  constexpr const_iterator cend() const;
+
+  constexpr bool empty();
+  constexpr size_type size();
+  constexpr size_type max_size();
+  constexpr void reserve(size_type size);
+  constexpr size_type capacity();
+  constexpr void shrink_to_fit();
+
+  constexpr void clear();
+  constexpr iterator insert(const_iterator pos, const_reference value);
+  constexpr iterator insert(const_iterator pos, value_type &&value);
+  constexpr iterator insert(const_iterator pos, size_type count,
+                            const_reference value);
+  template <typename InputIt,
+            typename = std::enable_if_t<!std::is_integral_v<InputIt>>>
+  constexpr iterator insert(const_iterator pos, InputIt first, InputIt last);
+  constexpr iterator insert(const_iterator pos,
+                            std::initializer_list<value_type> items);
+  constexpr void erase(const_iterator pos);
+  constexpr iterator erase(const_iterator first, const_iterator last);
+  template <typename Predicate>
+  constexpr size_type erase_if(Predicate pred);
+  constexpr void push_back(const_reference value);
+  constexpr void push_back(value_type &&value);
+  constexpr void pop_back();
+  constexpr void swap(static_vector &other) noexcept(
+      std::is_nothrow_move_constructible_v<value_type> &&
+      std::is_nothrow_move_assignable_v<value_type>);
+
+  template <typename... Args>
+  constexpr iterator emplace(const_iterator pos, Args &&...args);
+
+  template <typename... Args>
+  constexpr reference emplace_back(Args &&...args);
+};
+}  // namespace s21
+#include "s21_static_vector.cc"
+#endif  // SRC_S21_STATIC_VECTOR_H_
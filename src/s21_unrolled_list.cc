@@ -0,0 +1,763 @@
+#ifndef SRC_S21_UNROLLED_LIST_CC_
+#define SRC_S21_UNROLLED_LIST_CC_
+
+#include "s21_unrolled_list.h"
+
+namespace s21 {
+/* UnrolledChunk *************************************************/
+
+template <typename T, size_t Capacity>
+T *UnrolledChunk<T, Capacity>::Items(UnrolledChunkBase *chunk) {
+  return reinterpret_cast<T *>(static_cast<UnrolledChunk *>(chunk)->items_);
+}
+
+/* ChunkIterator *************************************************/
+
+template <typename Chunk, typename Item>
+ChunkIterator<Chunk, Item>::ChunkIterator() : chunk_{nullptr}, index_{0} {}
+
+template <typename Chunk, typename Item>
+ChunkIterator<Chunk, Item>::ChunkIterator(UnrolledChunkBase *chunk,
+                                          size_t index)
+    : chunk_{chunk}, index_{index} {}
+
+// iterator -> const_iterator
+template <typename Chunk, typename Item>
+template <typename Other, typename>
+ChunkIterator<Chunk, Item>::ChunkIterator(
+    const ChunkIterator<Chunk, Other> &other)
+    : chunk_{other.chunk()}, index_{other.index()} {}
+
+template <typename Chunk, typename Item>
+typename ChunkIterator<Chunk, Item>::reference
+ChunkIterator<Chunk, Item>::operator*() const {
+  return Chunk::Items(chunk_)[index_];
+}
+
+template <typename Chunk, typename Item>
+typename ChunkIterator<Chunk, Item>::pointer
+ChunkIterator<Chunk, Item>::operator->() const {
+  return Chunk::Items(chunk_) + index_;
+}
+
+// с последнего места блока — на первое место следующего
+template <typename Chunk, typename Item>
+ChunkIterator<Chunk, Item> &ChunkIterator<Chunk, Item>::operator++() {
+  if (++index_ == chunk_->count_) {
+    chunk_ = chunk_->pNext_;
+    index_ = 0;
+  }
+  return *this;
+}
+
+template <typename Chunk, typename Item>
+ChunkIterator<Chunk, Item> ChunkIterator<Chunk, Item>::operator++(int) {
+  ChunkIterator tmp(*this);
+  ++*this;
+  return tmp;
+}
+
+template <typename Chunk, typename Item>
+ChunkIterator<Chunk, Item> &ChunkIterator<Chunk, Item>::operator--() {
+  if (index_ == 0) {
+    chunk_ = chunk_->pPrev_;
+    index_ = chunk_->count_;
+  }
+  --index_;
+  return *this;
+}
+
+template <typename Chunk, typename Item>
+ChunkIterator<Chunk, Item> ChunkIterator<Chunk, Item>::operator--(int) {
+  ChunkIterator tmp(*this);
+  --*this;
+  return tmp;
+}
+
+template <typename Chunk, typename Item>
+template <typename Other>
+bool ChunkIterator<Chunk, Item>::operator==(
+    const ChunkIterator<Chunk, Other> &other) const {
+  return chunk_ == other.chunk() && index_ == other.index();
+}
+
+template <typename Chunk, typename Item>
+template <typename Other>
+bool ChunkIterator<Chunk, Item>::operator!=(
+    const ChunkIterator<Chunk, Other> &other) const {
+  return !(*this == other);
+}
+
+template <typename Chunk, typename Item>
+UnrolledChunkBase *ChunkIterator<Chunk, Item>::chunk() const {
+  return chunk_;
+}
+
+template <typename Chunk, typename Item>
+size_t ChunkIterator<Chunk, Item>::index() const {
+  return index_;
+}
+
+/* unrolled_list: служебные ***************************************/
+
+template <typename T, size_t ChunkBytes, typename Allocator>
+typename unrolled_list<T, ChunkBytes, Allocator>::value_type *
+unrolled_list<T, ChunkBytes, Allocator>::Items(ChunkBase *chunk) {
+  return Chunk::Items(chunk);
+}
+
+// пустой фиктивный блок замкнут сам на себя
+template <typename T, size_t ChunkBytes, typename Allocator>
+void unrolled_list<T, ChunkBytes, Allocator>::ResetFake() noexcept {
+  fake_.pNext_ = fake_.pPrev_ = &fake_;
+  fake_.count_ = 0;
+}
+
+// вернуть крайние блоки на фиктивный после копирования его связей
+template <typename T, size_t ChunkBytes, typename Allocator>
+void unrolled_list<T, ChunkBytes, Allocator>::ReferenceToFake() noexcept {
+  if (size_) {
+    fake_.pNext_->pPrev_ = &fake_;
+    fake_.pPrev_->pNext_ = &fake_;
+  } else {
+    ResetFake();
+  }
+}
+
+// пустой блок, вставленный в цепочку перед pos
+template <typename T, size_t ChunkBytes, typename Allocator>
+typename unrolled_list<T, ChunkBytes, Allocator>::ChunkBase *
+unrolled_list<T, ChunkBytes, Allocator>::CreateChunk(ChunkBase *pos) {
+  ChunkBase *chunk = ChunkTraits::allocate(alloc_, 1);
+  chunk->count_ = 0;
+  chunk->pNext_ = pos;
+  chunk->pPrev_ = pos->pPrev_;
+  pos->pPrev_->pNext_ = chunk;
+  pos->pPrev_ = chunk;
+  return chunk;
+}
+
+// уничтожить элементы блока, вынуть его из цепочки и вернуть память
+template <typename T, size_t ChunkBytes, typename Allocator>
+void unrolled_list<T, ChunkBytes, Allocator>::DestroyChunk(ChunkBase *chunk) {
+  std::destroy(Items(chunk), Items(chunk) + chunk->count_);
+  chunk->pPrev_->pNext_ = chunk->pNext_;
+  chunk->pNext_->pPrev_ = chunk->pPrev_;
+  ChunkTraits::deallocate(alloc_, static_cast<Chunk *>(chunk), 1);
+}
+
+// поменять местами цепочки, аллокаторы остаются на месте
+template <typename T, size_t ChunkBytes, typename Allocator>
+void unrolled_list<T, ChunkBytes, Allocator>::SwapChunks(
+    unrolled_list &other) noexcept {
+  std::swap(fake_, other.fake_);
+  std::swap(size_, other.size_);
+  ReferenceToFake();
+  other.ReferenceToFake();
+}
+
+// перенести места [index, count_) в новый блок сразу за chunk
+template <typename T, size_t ChunkBytes, typename Allocator>
+typename unrolled_list<T, ChunkBytes, Allocator>::ChunkBase *
+unrolled_list<T, ChunkBytes, Allocator>::Split(ChunkBase *chunk,
+                                               size_type index) {
+  ChunkBase *upper = CreateChunk(chunk->pNext_);
+  value_type *items = Items(chunk);
+  try {
+    Ops::Relocate(items + index, items + chunk->count_, Items(upper));
+  } catch (...) {
+    DestroyChunk(upper);
+    throw;
+  }
+  std::destroy(items + index, items + chunk->count_);
+  upper->count_ = chunk->count_ - index;
+  chunk->count_ = index;
+  return upper;
+}
+
+// освобождает место под элемент перед (chunk, index) и переводит их на
+// это место; count_ блока уже учитывает его. На стыке блоков элемент
+// дописывается в хвост предыдущего, полный блок делится пополам
+template <typename T, size_t ChunkBytes, typename Allocator>
+void unrolled_list<T, ChunkBytes, Allocator>::MakeRoom(ChunkBase *&chunk,
+                                                       size_type &index) {
+  if (index == 0) {
+    ChunkBase *prev = chunk->pPrev_;
+    if (prev != &fake_ && prev->count_ < kChunkCapacity) {
+      chunk = prev;
+      index = prev->count_;
+    } else if (chunk == &fake_ || chunk->count_ == kChunkCapacity) {
+      chunk = CreateChunk(chunk);
+    }
+  } else if (chunk->count_ == kChunkCapacity) {
+    size_type half = kChunkCapacity / 2;
+    ChunkBase *upper = Split(chunk, half);
+    if (index > half) {
+      chunk = upper;
+      index -= half;
+    }
+  }
+  value_type *items = Items(chunk);
+  Ops::OpenGap(items + index, items + chunk->count_, 1);
+  chunk->count_++;
+}
+
+// переносит value на новое место перед pos; если перенос бросит, место
+// закрывается обратно
+template <typename T, size_t ChunkBytes, typename Allocator>
+typename unrolled_list<T, ChunkBytes, Allocator>::iterator
+unrolled_list<T, ChunkBytes, Allocator>::Place(const_iterator pos,
+                                               value_type &&value) {
+  ChunkBase *chunk = pos.chunk();
+  size_type index = pos.index();
+  MakeRoom(chunk, index);
+  value_type *slot = Items(chunk) + index;
+  try {
+    new (slot) value_type(std::move(value));
+  } catch (...) {
+    Ops::CloseGap(slot, Items(chunk) + chunk->count_, 1);
+    if (!--chunk->count_) DestroyChunk(chunk);
+    throw;
+  }
+  size_++;
+  return iterator(chunk, index);
+}
+
+// удаляет элемент (chunk, index). Опустевший блок уходит из цепочки,
+// блок меньше половины забирает следующий, если тот помещается целиком
+template <typename T, size_t ChunkBytes, typename Allocator>
+typename unrolled_list<T, ChunkBytes, Allocator>::iterator
+unrolled_list<T, ChunkBytes, Allocator>::EraseAt(ChunkBase *chunk,
+                                                 size_type index) {
+  value_type *items = Items(chunk);
+  std::destroy_at(items + index);
+  Ops::CloseGap(items + index, items + chunk->count_, 1);
+  chunk->count_--;
+  size_--;
+  ChunkBase *next = chunk->pNext_;
+  if (!chunk->count_) {
+    DestroyChunk(chunk);
+    return iterator(next, 0);
+  }
+  // перенос не должен бросать, иначе erase оставил бы список полуслитым
+  if constexpr (std::is_nothrow_move_constructible_v<value_type>) {
+    if (next != &fake_ && chunk->count_ < kChunkCapacity / 2 &&
+        chunk->count_ + next->count_ <= kChunkCapacity) {
+      value_type *next_items = Items(next);
+      Ops::Relocate(next_items, next_items + next->count_,
+                    items + chunk->count_);
+      std::destroy(next_items, next_items + next->count_);
+      chunk->count_ += next->count_;
+      next->count_ = 0;
+      DestroyChunk(next);
+    }
+  }
+  if (index == chunk->count_) return iterator(chunk->pNext_, 0);
+  return iterator(chunk, index);
+}
+
+// удаляет всё от first до конца
+template <typename T, size_t ChunkBytes, typename Allocator>
+void unrolled_list<T, ChunkBytes, Allocator>::EraseTail(iterator first) {
+  ChunkBase *chunk = first.chunk();
+  if (chunk == &fake_) return;
+  value_type *items = Items(chunk);
+  std::destroy(items + first.index(), items + chunk->count_);
+  size_ -= chunk->count_ - first.index();
+  chunk->count_ = first.index();
+  if (!chunk->count_) chunk = chunk->pPrev_;
+  while (chunk->pNext_ != &fake_) {
+    size_ -= chunk->pNext_->count_;
+    DestroyChunk(chunk->pNext_);
+  }
+}
+
+// переносит последний элемент в конец блока chunk списка to; опустевший
+// блок освобождается
+template <typename T, size_t ChunkBytes, typename Allocator>
+void unrolled_list<T, ChunkBytes, Allocator>::MoveBackTo(unrolled_list &to,
+                                                         ChunkBase *chunk) {
+  ChunkBase *last = fake_.pPrev_;
+  value_type *item = Items(last) + last->count_ - 1;
+  Ops::Relocate(item, item + 1, Items(chunk) + chunk->count_);
+  chunk->count_++;
+  to.size_++;
+  EraseAt(last, last->count_ - 1);
+}
+
+// устойчивая сортировка вставками внутри блока: место ищется
+// upper_bound, элемент встаёт на него rotate, так что comp бросает
+// только до перестановки
+template <typename T, size_t ChunkBytes, typename Allocator>
+template <class Compare>
+void unrolled_list<T, ChunkBytes, Allocator>::SortChunk(ChunkBase *chunk,
+                                                        Compare &comp) {
+  value_type *items = Items(chunk);
+  for (size_type i = 1; i < chunk->count_; ++i) {
+    value_type *pos = std::upper_bound(items, items + i, items[i], comp);
+    std::rotate(pos, items + i, items + i + 1);
+  }
+}
+
+// Сортировка слиянием сверху вниз: первая половина блоков перевешивается
+// в half, обе половины сортируются и сливаются merge, единственный блок
+// сортируется на месте. Если comp бросит, half возвращается в список, и
+// ни один элемент не теряется
+template <typename T, size_t ChunkBytes, typename Allocator>
+template <class Compare>
+void unrolled_list<T, ChunkBytes, Allocator>::SortRun(Compare &comp) {
+  size_type chunks = 0;
+  for (ChunkBase *c = fake_.pNext_; c != &fake_; c = c->pNext_) chunks++;
+  if (chunks == 1) {
+    SortChunk(fake_.pNext_, comp);
+    return;
+  }
+  ChunkBase *middle = fake_.pNext_;
+  for (size_type i = 0; i < chunks / 2; ++i) middle = middle->pNext_;
+  unrolled_list half(get_allocator());
+  half.splice(half.cend(), *this, cbegin(), const_iterator(middle, 0));
+  try {
+    half.SortRun(comp);
+    SortRun(comp);
+    half.merge(*this, comp);
+  } catch (...) {
+    splice(cbegin(), half);
+    throw;
+  }
+  SwapChunks(half);
+}
+
+/* unrolled_list **************************************************/
+
+template <typename T, size_t ChunkBytes, typename Allocator>
+unrolled_list<T, ChunkBytes, Allocator>::unrolled_list()
+    : unrolled_list(Allocator()) {}
+
+template <typename T, size_t ChunkBytes, typename Allocator>
+unrolled_list<T, ChunkBytes, Allocator>::unrolled_list(const Allocator &alloc)
+    : size_{0}, alloc_{alloc} {
+  ResetFake();
+}
+
+template <typename T, size_t ChunkBytes, typename Allocator>
+unrolled_list<T, ChunkBytes, Allocator>::unrolled_list(size_type n,
+                                                       const Allocator &alloc)
+    : unrolled_list(alloc) {
+  for (size_type i = 0; i < n; i++) emplace_back();
+}
+
+template <typename T, size_t ChunkBytes, typename Allocator>
+unrolled_list<T, ChunkBytes, Allocator>::unrolled_list(size_type n,
+                                                       const_reference x,
+                                                       const Allocator &alloc)
+    : unrolled_list(alloc) {
+  for (size_type i = 0; i < n; i++) push_back(x);
+}
+
+template <typename T, size_t ChunkBytes, typename Allocator>
+unrolled_list<T, ChunkBytes, Allocator>::unrolled_list(
+    std::initializer_list<value_type> const &items, const Allocator &alloc)
+    : unrolled_list(alloc) {
+  for (const_reference item : items) push_back(item);
+}
+
+template <typename T, size_t ChunkBytes, typename Allocator>
+unrolled_list<T, ChunkBytes, Allocator>::unrolled_list(const unrolled_list &l)
+    : unrolled_list(l, AllocTraits::select_on_container_copy_construction(
+                           l.get_allocator())) {}
+
+// копия l, блоки которой выделяет alloc
+template <typename T, size_t ChunkBytes, typename Allocator>
+unrolled_list<T, ChunkBytes, Allocator>::unrolled_list(const unrolled_list &l,
+                                                       const Allocator &alloc)
+    : unrolled_list(alloc) {
+  for (const_reference item : l) push_back(item);
+}
+
+// блоки l забираются за O(1) без выделений
+template <typename T, size_t ChunkBytes, typename Allocator>
+unrolled_list<T, ChunkBytes, Allocator>::unrolled_list(
+    unrolled_list &&l) noexcept
+    : unrolled_list(l.get_allocator()) {
+  SwapChunks(l);
+}
+
+template <typename T, size_t ChunkBytes, typename Allocator>
+unrolled_list<T, ChunkBytes, Allocator>::~unrolled_list() {
+  clear();
+}
+
+// copy-and-swap, копия строится на аллокаторе, который останется у списка
+template <typename T, size_t ChunkBytes, typename Allocator>
+unrolled_list<T, ChunkBytes, Allocator> &
+unrolled_list<T, ChunkBytes, Allocator>::operator=(const unrolled_list &l) {
+  if (this != &l) {
+    if constexpr (AllocTraits::propagate_on_container_copy_assignment::value) {
+      unrolled_list tmp(l, l.get_allocator());
+      SwapChunks(tmp);
+      std::swap(alloc_, tmp.alloc_);
+    } else {
+      unrolled_list tmp(l, get_allocator());
+      SwapChunks(tmp);
+    }
+  }
+  return *this;
+}
+
+// блоки l забираются за O(1); из неравного аллокатора элементы
+// перемещаются по одному
+template <typename T, size_t ChunkBytes, typename Allocator>
+unrolled_list<T, ChunkBytes, Allocator> &
+unrolled_list<T, ChunkBytes, Allocator>::operator=(
+    unrolled_list &&l) noexcept(kMoveAssignSteals) {
+  if (this != &l) {
+    if constexpr (AllocTraits::propagate_on_container_move_assignment::value) {
+      unrolled_list tmp(std::move(l));
+      SwapChunks(tmp);
+      std::swap(alloc_, tmp.alloc_);
+    } else if (kMoveAssignSteals || alloc_ == l.alloc_) {
+      unrolled_list tmp(std::move(l));
+      SwapChunks(tmp);
+    } else {
+      unrolled_list tmp(get_allocator());
+      for (reference item : l) tmp.push_back(std::move(item));
+      SwapChunks(tmp);
+      l.clear();
+    }
+  }
+  return *this;
+}
+
+template <typename T, size_t ChunkBytes, typename Allocator>
+typename unrolled_list<T, ChunkBytes, Allocator>::allocator_type
+unrolled_list<T, ChunkBytes, Allocator>::get_allocator() const {
+  return allocator_type(alloc_);
+}
+
+template <typename T, size_t ChunkBytes, typename Allocator>
+typename unrolled_list<T, ChunkBytes, Allocator>::iterator
+unrolled_list<T, ChunkBytes, Allocator>::begin() {
+  return iterator(fake_.pNext_, 0);
+}
+
+template <typename T, size_t ChunkBytes, typename Allocator>
+typename unrolled_list<T, ChunkBytes, Allocator>::iterator
+unrolled_list<T, ChunkBytes, Allocator>::end() {
+  return iterator(&fake_, 0);
+}
+
+template <typename T, size_t ChunkBytes, typename Allocator>
+typename unrolled_list<T, ChunkBytes, Allocator>::const_iterator
+unrolled_list<T, ChunkBytes, Allocator>::begin() const {
+  return const_iterator(fake_.pNext_, 0);
+}
+
+template <typename T, size_t ChunkBytes, typename Allocator>
+typename unrolled_list<T, ChunkBytes, Allocator>::const_iterator
+unrolled_list<T, ChunkBytes, Allocator>::end() const {
+  return const_iterator(const_cast<ChunkBase *>(&fake_), 0);
+}
+
+template <typename T, size_t ChunkBytes, typename Allocator>
+typename unrolled_list<T, ChunkBytes, Allocator>::const_iterator
+unrolled_list<T, ChunkBytes, Allocator>::cbegin() const {
+  return begin();
+}
+
+template <typename T, size_t ChunkBytes, typename Allocator>
+typename unrolled_list<T, ChunkBytes, Allocator>::const_iterator
+unrolled_list<T, ChunkBytes, Allocator>::cend() const {
+  return end();
+}
+
+template <typename T, size_t ChunkBytes, typename Allocator>
+void unrolled_list<T, ChunkBytes, Allocator>::pop_front() {
+  if (!size_)
+    throw std::invalid_argument("pointer being freed was not allocated");
+  EraseAt(fake_.pNext_, 0);
+}
+
+template <typename T, size_t ChunkBytes, typename Allocator>
+void unrolled_list<T, ChunkBytes, Allocator>::pop_back() {
+  if (!size_)
+    throw std::invalid_argument("pointer being freed was not allocated");
+  EraseAt(fake_.pPrev_, fake_.pPrev_->count_ - 1);
+}
+
+template <typename T, size_t ChunkBytes, typename Allocator>
+void unrolled_list<T, ChunkBytes, Allocator>::push_back(
+    const_reference value) {
+  emplace_back(value);
+}
+
+template <typename T, size_t ChunkBytes, typename Allocator>
+void unrolled_list<T, ChunkBytes, Allocator>::push_back(value_type &&value) {
+  emplace_back(std::move(value));
+}
+
+template <typename T, size_t ChunkBytes, typename Allocator>
+void unrolled_list<T, ChunkBytes, Allocator>::push_front(
+    const_reference value) {
+  emplace_front(value);
+}
+
+template <typename T, size_t ChunkBytes, typename Allocator>
+void unrolled_list<T, ChunkBytes, Allocator>::push_front(value_type &&value) {
+  emplace_front(std::move(value));
+}
+
+template <typename T, size_t ChunkBytes, typename Allocator>
+void unrolled_list<T, ChunkBytes, Allocator>::clear() {
+  while (fake_.pNext_ != &fake_) DestroyChunk(fake_.pNext_);
+  size_ = 0;
+}
+
+template <typename T, size_t ChunkBytes, typename Allocator>
+bool unrolled_list<T, ChunkBytes, Allocator>::empty() const {
+  return size_ == 0;
+}
+
+// обратный порядок блоков и элементов внутри каждого
+template <typename T, size_t ChunkBytes, typename Allocator>
+void unrolled_list<T, ChunkBytes, Allocator>::reverse() {
+  ChunkBase *chunk = &fake_;
+  do {
+    std::swap(chunk->pNext_, chunk->pPrev_);
+    if (chunk != &fake_) {
+      std::reverse(Items(chunk), Items(chunk) + chunk->count_);
+    }
+    chunk = chunk->pPrev_;
+  } while (chunk != &fake_);
+}
+
+template <typename T, size_t ChunkBytes, typename Allocator>
+typename unrolled_list<T, ChunkBytes, Allocator>::size_type
+unrolled_list<T, ChunkBytes, Allocator>::size() const {
+  return size_;
+}
+
+template <typename T, size_t ChunkBytes, typename Allocator>
+typename unrolled_list<T, ChunkBytes, Allocator>::size_type
+unrolled_list<T, ChunkBytes, Allocator>::max_size() const {
+  return std::min(ChunkTraits::max_size(alloc_),
+                  std::numeric_limits<size_type>::max() / kChunkCapacity) *
+         kChunkCapacity;
+}
+
+template <typename T, size_t ChunkBytes, typename Allocator>
+typename unrolled_list<T, ChunkBytes, Allocator>::reference
+unrolled_list<T, ChunkBytes, Allocator>::front() {
+  return Items(fake_.pNext_)[0];
+}
+
+template <typename T, size_t ChunkBytes, typename Allocator>
+typename unrolled_list<T, ChunkBytes, Allocator>::reference
+unrolled_list<T, ChunkBytes, Allocator>::back() {
+  return Items(fake_.pPrev_)[fake_.pPrev_->count_ - 1];
+}
+
+template <typename T, size_t ChunkBytes, typename Allocator>
+typename unrolled_list<T, ChunkBytes, Allocator>::iterator
+unrolled_list<T, ChunkBytes, Allocator>::insert(const_iterator pos,
+                                                const_reference value) {
+  return emplace(pos, value);
+}
+
+template <typename T, size_t ChunkBytes, typename Allocator>
+typename unrolled_list<T, ChunkBytes, Allocator>::iterator
+unrolled_list<T, ChunkBytes, Allocator>::insert(const_iterator pos,
+                                                value_type &&value) {
+  return emplace(pos, std::move(value));
+}
+
+template <typename T, size_t ChunkBytes, typename Allocator>
+typename unrolled_list<T, ChunkBytes, Allocator>::iterator
+unrolled_list<T, ChunkBytes, Allocator>::erase(const_iterator pos) {
+  if (pos.chunk() == &fake_)
+    throw std::invalid_argument("double free or corruption (out)");
+  return EraseAt(pos.chunk(), pos.index());
+}
+
+template <typename T, size_t ChunkBytes, typename Allocator>
+void unrolled_list<T, ChunkBytes, Allocator>::merge(unrolled_list &other) {
+  merge(other, std::less<value_type>());
+}
+
+// Устойчивое слияние с конца: больший из последних элементов переносится
+// в блок результата, опустевший блок источника сразу освобождается, так
+// что лишней памяти нужно не больше блока. Блок результата заполняется по
+// убыванию и разворачивается, когда полон; остаток одного из списков —
+// меньшие элементы — перевешивается в начало целыми блоками. Если бросит
+// comp, перенос элемента или выделение блока, все элементы собираются в
+// этом списке в произвольном порядке
+template <typename T, size_t ChunkBytes, typename Allocator>
+template <class Compare>
+void unrolled_list<T, ChunkBytes, Allocator>::merge(unrolled_list &other,
+                                                    Compare comp) {
+  if (this == &other || !other.size_) return;
+  if (!size_ || !comp(other.front(), back())) {
+    splice(cend(), other);
+    return;
+  }
+  if (comp(other.back(), front())) {
+    splice(cbegin(), other);
+    return;
+  }
+  unrolled_list result(get_allocator());
+  ChunkBase *out = &result.fake_;
+  try {
+    while (size_ && other.size_) {
+      unrolled_list &from = comp(other.back(), back()) ? *this : other;
+      if (out->count_ == kChunkCapacity) {
+        std::reverse(Items(out), Items(out) + out->count_);
+        out = &result.fake_;
+      }
+      if (out == &result.fake_) out = result.CreateChunk(result.fake_.pNext_);
+      from.MoveBackTo(result, out);
+    }
+    std::reverse(Items(out), Items(out) + out->count_);
+  } catch (...) {
+    if (out != &result.fake_ && !out->count_) result.DestroyChunk(out);
+    splice(cend(), result);
+    splice(cend(), other);
+    throw;
+  }
+  result.splice(result.cbegin(), size_ ? *this : other);
+  SwapChunks(result);
+}
+
+// блоки other перевешиваются перед pos; если pos в середине блока, блок
+// сначала делится. Блоки выделены аллокатором other, он должен быть равен
+// своему
+template <typename T, size_t ChunkBytes, typename Allocator>
+void unrolled_list<T, ChunkBytes, Allocator>::splice(const_iterator pos,
+                                                     unrolled_list &other) {
+  if (this != &other && other.size_) {
+    ChunkBase *chunk = pos.chunk();
+    if (pos.index()) chunk = Split(chunk, pos.index());
+    ChunkBase *first = other.fake_.pNext_;
+    ChunkBase *last = other.fake_.pPrev_;
+    first->pPrev_ = chunk->pPrev_;
+    last->pNext_ = chunk;
+    chunk->pPrev_->pNext_ = first;
+    chunk->pPrev_ = last;
+    size_ += other.size_;
+    other.size_ = 0;
+    other.ResetFake();
+  }
+}
+
+// при равных аллокаторах элемент, отрезанный в свой блок, перевешивается
+// как диапазон из одного элемента; из списка с неравным аллокатором он
+// переносится перемещением на заранее готовое место
+template <typename T, size_t ChunkBytes, typename Allocator>
+void unrolled_list<T, ChunkBytes, Allocator>::splice(const_iterator pos,
+                                                     unrolled_list &other,
+                                                     const_iterator it) {
+  if (this == &other || alloc_ == other.alloc_) {
+    splice(pos, other, it, std::next(it));
+  } else {
+    Place(pos, std::move(const_cast<reference>(*it)));
+    other.EraseAt(it.chunk(), it.index());
+  }
+}
+
+// Блоки other режутся по last и first, затем блок у pos, и блоки
+// [first, last) перевешиваются за O(1) на блок. Резка только делит блоки,
+// поэтому исключение оставляет оба списка целыми. Внутри одного списка
+// элементы переставляет std::rotate, сторону pos находит обход от last
+template <typename T, size_t ChunkBytes, typename Allocator>
+void unrolled_list<T, ChunkBytes, Allocator>::splice(const_iterator pos,
+                                                     unrolled_list &other,
+                                                     const_iterator first,
+                                                     const_iterator last) {
+  if (first == last) return;
+  if (this == &other) {
+    iterator from(first.chunk(), first.index());
+    iterator to(last.chunk(), last.index());
+    iterator where(pos.chunk(), pos.index());
+    iterator it = to;
+    while (it != end() && it != where) ++it;
+    if (it == where) {
+      std::rotate(from, to, where);
+    } else {
+      std::rotate(where, from, to);
+    }
+    return;
+  }
+  ChunkBase *end_chunk = last.chunk();
+  if (last.index()) end_chunk = other.Split(end_chunk, last.index());
+  ChunkBase *begin_chunk = first.chunk();
+  if (first.index()) begin_chunk = other.Split(begin_chunk, first.index());
+  ChunkBase *chunk = pos.chunk();
+  if (pos.index()) chunk = Split(chunk, pos.index());
+  size_type count = 0;
+  ChunkBase *tail = end_chunk->pPrev_;
+  for (ChunkBase *c = begin_chunk; c != end_chunk; c = c->pNext_) {
+    count += c->count_;
+  }
+  begin_chunk->pPrev_->pNext_ = end_chunk;
+  end_chunk->pPrev_ = begin_chunk->pPrev_;
+  begin_chunk->pPrev_ = chunk->pPrev_;
+  tail->pNext_ = chunk;
+  chunk->pPrev_->pNext_ = begin_chunk;
+  chunk->pPrev_ = tail;
+  size_ += count;
+  other.size_ -= count;
+}
+
+// аллокаторы меняются, только если этого требует
+// propagate_on_container_swap
+template <typename T, size_t ChunkBytes, typename Allocator>
+void unrolled_list<T, ChunkBytes, Allocator>::swap(
+    unrolled_list &other) noexcept {
+  SwapChunks(other);
+  if constexpr (AllocTraits::propagate_on_container_swap::value) {
+    std::swap(alloc_, other.alloc_);
+  }
+}
+
+template <typename T, size_t ChunkBytes, typename Allocator>
+void unrolled_list<T, ChunkBytes, Allocator>::unique() {
+  if (size_ > 1) EraseTail(std::unique(begin(), end()));
+}
+
+template <typename T, size_t ChunkBytes, typename Allocator>
+void unrolled_list<T, ChunkBytes, Allocator>::sort() {
+  sort(std::less<value_type>());
+}
+
+// сортировка слиянием по блокам, элементы не покидают своих блоков,
+// кроме как при слиянии; см. SortRun
+template <typename T, size_t ChunkBytes, typename Allocator>
+template <class Compare>
+void unrolled_list<T, ChunkBytes, Allocator>::sort(Compare comp) {
+  if (size_ > 1) SortRun(comp);
+}
+
+// элемент строится до сдвига: args может ссылаться на элемент этого же
+// блока
+template <typename T, size_t ChunkBytes, typename Allocator>
+template <class... Args>
+typename unrolled_list<T, ChunkBytes, Allocator>::iterator
+unrolled_list<T, ChunkBytes, Allocator>::emplace(const_iterator pos,
+                                                 Args &&...args) {
+  value_type value(std::forward<Args>(args)...);
+  return Place(pos, std::move(value));
+}
+
+template <typename T, size_t ChunkBytes, typename Allocator>
+template <class... Args>
+typename unrolled_list<T, ChunkBytes, Allocator>::reference
+unrolled_list<T, ChunkBytes, Allocator>::emplace_back(Args &&...args) {
+  return *emplace(cend(), std::forward<Args>(args)...);
+}
+
+template <typename T, size_t ChunkBytes, typename Allocator>
+template <class... Args>
+typename unrolled_list<T, ChunkBytes, Allocator>::reference
+unrolled_list<T, ChunkBytes, Allocator>::emplace_front(Args &&...args) {
+  return *emplace(cbegin(), std::forward<Args>(args)...);
+}
+}  // namespace s21
+#endif  // SRC_S21_UNROLLED_LIST_CC_
@@ -0,0 +1,211 @@
+#ifndef SRC_S21_UNROLLED_LIST_H_
+#define SRC_S21_UNROLLED_LIST_H_
+
+#include <algorithm>
+#include <functional>
+#include <initializer_list>
+#include <limits>
+#include <memory>
+
+#include "s21_node_pool.h"
+#include "s21_vector.h"
+
+namespace s21 {
+
+// Заголовок блока unrolled_list: связи и число занятых мест. Фиктивный
+// блок списка — один заголовок с count_ == 0
+struct UnrolledChunkBase {
+  UnrolledChunkBase *pPrev_;
+  UnrolledChunkBase *pNext_;
+  size_t count_;
+};
+
+// Блок на Capacity элементов T сразу за заголовком; занятые места —
+// [0, count_), остальные — сырая память
+template <typename T, size_t Capacity>
+struct UnrolledChunk : UnrolledChunkBase {
+  alignas(T) unsigned char items_[Capacity * sizeof(T)];
+
+  static T *Items(UnrolledChunkBase *chunk);
+};
+
+// Двунаправленный итератор по unrolled_list: блок и место в нём. Item —
+// тип элемента для iterator и const-тип для const_iterator
+template <typename Chunk, typename Item>
+class ChunkIterator {
+ public:
+  typedef std::bidirectional_iterator_tag iterator_category;
+  typedef std::remove_const_t<Item> value_type;
+  typedef std::ptrdiff_t difference_type;
+  typedef Item *pointer;
+  typedef Item &reference;
+
+  ChunkIterator();
+  ChunkIterator(UnrolledChunkBase *chunk, size_t index);
+  template <typename Other, typename = std::enable_if_t<
+                                std::is_convertible_v<Other *, Item *>>>
+  ChunkIterator(const ChunkIterator<Chunk, Other> &other);
+
+  reference operator*() const;
+  pointer operator->() const;
+  ChunkIterator &operator++();
+  ChunkIterator operator++(int);
+  ChunkIterator &operator--();
+  ChunkIterator operator--(int);
+  template <typename Other>
+  bool operator==(const ChunkIterator<Chunk, Other> &other) const;
+  template <typename Other>
+  bool operator!=(const ChunkIterator<Chunk, Other> &other) const;
+  UnrolledChunkBase *chunk() const;
+  size_t index() const;
+
+ private:
+  UnrolledChunkBase *chunk_;
+  size_t index_;
+};
+
+// Развёрнутый список: двусвязный список блоков по ChunkBytes байт, в
+// каждом массив элементов и число занятых мест. Обход идёт подряд по
+// массивам, как у vector, а вставка и удаление у итератора сдвигают
+// не больше одного блока, как у list. Полный блок при вставке делится
+// пополам, блок, опустевший наполовину, при удалении забирает элементы
+// соседа, если они помещаются. Пустых блоков в цепочке нет.
+//
+// insert и erase делают недействительными итераторы на элементы своего
+// блока и соседнего, если он делился или сливался; splice перевешивает
+// блоки другого списка за O(1), деля не больше одного блока у pos и по
+// одному у концов диапазона. Внутри одного списка элементы переставляет
+// std::rotate. merge и sort переносят элементы между блоками, а целые
+// блоки перевешивают: если бросит comp, перемещение или выделение блока,
+// все элементы остаются в списке в произвольном порядке, как у
+// s21::list
+template <typename T, size_t ChunkBytes = 256,
+          typename Allocator = pool_allocator<T>>
+class unrolled_list {
+  static_assert(ChunkBytes > sizeof(UnrolledChunkBase),
+                "chunk must be larger than its header");
+
+ public:
+  typedef T value_type;
+  typedef T &reference;
+  typedef const T &const_reference;
+  typedef size_t size_type;
+  typedef std::ptrdiff_t difference_type;
+  typedef Allocator allocator_type;
+
+  // мест в блоке: сколько помещается в ChunkBytes за заголовком, не меньше 2
+  static constexpr size_type kChunkCapacity = std::max<size_type>(
+      2, (ChunkBytes - sizeof(UnrolledChunkBase)) / sizeof(T));
+
+ private:
+  typedef UnrolledChunkBase ChunkBase;
+  typedef UnrolledChunk<value_type, kChunkCapacity> Chunk;
+  typedef std::allocator_traits<allocator_type> AllocTraits;
+  typedef typename AllocTraits::template rebind_alloc<Chunk> ChunkAllocator;
+  typedef std::allocator_traits<ChunkAllocator> ChunkTraits;
+  typedef ElementOps<value_type> Ops;
+
+ public:
+  typedef ChunkIterator<Chunk, value_type> iterator;
+  typedef ChunkIterator<Chunk, const value_type> const_iterator;
+  // аллокатор блоков, по нему s21::node_pool_stats находит статистику
+  typedef ChunkAllocator node_allocator_type;
+
+ private:
+  // перемещающее присваивание всегда забирает блоки, не копируя элементы
+  static constexpr bool kMoveAssignSteals =
+      AllocTraits::propagate_on_container_move_assignment::value ||
+      AllocTraits::is_always_equal::value;
+
+  size_type size_;
+  ChunkBase fake_;
+  ChunkAllocator alloc_;
+
+  static value_type *Items(ChunkBase *chunk);
+  void ResetFake() noexcept;
+  void ReferenceToFake() noexcept;
+  ChunkBase *CreateChunk(ChunkBase *pos);
+  void DestroyChunk(ChunkBase *chunk);
+  void SwapChunks(unrolled_list &other) noexcept;
+  ChunkBase *Split(ChunkBase *chunk, size_type index);
+  void MakeRoom(ChunkBase *&chunk, size_type &index);
+  iterator Place(const_iterator pos, value_type &&value);
+  iterator EraseAt(ChunkBase *chunk, size_type index);
+  void EraseTail(iterator first);
+  void MoveBackTo(unrolled_list &to, ChunkBase *chunk);
+  template <class Compare>
+  static void SortChunk(ChunkBase *chunk, Compare &comp);
+  template <class Compare>
+  void SortRun(Compare &comp);
+
+ public:
+  unrolled_list();
+  explicit unrolled_list(const Allocator &alloc);
+  unrolled_list(size_type n, const Allocator &alloc = Allocator());
+  unrolled_list(size_type n, const_reference x,
+                const Allocator &alloc = Allocator());
+  unrolled_list(std::initializer_list<value_type> const &items,
+                const Allocator &alloc = Allocator());
+  unrolled_list(const unrolled_list &l);
+  unrolled_list(const unrolled_list &l, const Allocator &alloc);
+  unrolled_list(unrolled_list &&l) noexcept;
+  ~unrolled_list();
+  unrolled_list &operator=(const unrolled_list &l);
+  unrolled_list &operator=(unrolled_list &&l) noexcept(kMoveAssignSteals);
+
+  allocator_type get_allocator() const;
+
+  iterator begin();
+  iterator end();
+  const_iterator begin() const;
+  const_iterator end() const;
+
+  const_iterator cbegin() const;
+  const_iterator cend() const;
+
+  void pop_front();
+  void pop_back();
+  void push_back(const_reference value);
+  void push_back(value_type &&value);
+  void push_front(const_reference value);
+  void push_front(value_type &&value);
+  void clear();
+  bool empty() const;
+  void reverse();
+  size_type size() const;
+  size_type max_size() const;
+  reference front();
+  reference back();
+  iterator insert(const_iterator pos, const_reference value);
+  iterator insert(const_iterator pos, value_type &&value);
+  // возвращает итератор на элемент, следовавший за удалённым
+  iterator erase(const_iterator pos);
+  void merge(unrolled_list &other);
+  template <class Compare>
+  void merge(unrolled_list &other, Compare comp);
+  // В отличие от std::list, splice перемещает элементы поделённых блоков
+  // и делает недействительными указатели на них. Один элемент можно взять
+  // и из списка с неравным аллокатором: он перемещается и удаляется из
+  // other, так что T должен перемещаться
+  void splice(const_iterator pos, unrolled_list &other);
+  void splice(const_iterator pos, unrolled_list &other, const_iterator it);
+  void splice(const_iterator pos, unrolled_list &other, const_iterator first,
+              const_iterator last);
+  void swap(unrolled_list &other) noexcept;
+  void unique();
+  void sort();
+  template <class Compare>
+  void sort(Compare comp);
+
+  template <class... Args>
+  iterator emplace(const_iterator pos, Args &&...args);
+
+  template <class... Args>
+  reference emplace_back(Args &&...args);
+
+  template <class... Args>
+  reference emplace_front(Args &&...args);
+};
+}  // namespace s21
+#include "s21_unrolled_list.cc"
+#endif  // SRC_S21_UNROLLED_LIST_H_
@@ -8,333 +8,918 @@
 namespace s21 {
 /* Конструкторы, деструкторы *************************************/
 
-template <class value_type>
-vector<value_type>::vector() : vector(0, value_type()) {}
-
-template <class value_type>
-vector<value_type>::vector(size_type n) : vector(n, value_type()) {}
-
-template <class value_type>
-vector<value_type>::vector(size_type n, value_type x) : size_{n}, capacity_{n} {
-  InitMemory();
-  for (size_type i = 0; i < size_; ++i) *(head_ + i) = x;
+template <class value_type, class Allocator, class Growth>
+vector<value_type, Allocator, Growth>::vector() : vector(Allocator()) {}
+
+template <class value_type, class Allocator, class Growth>
+vector<value_type, Allocator, Growth>::vector(const Allocator &alloc)
+    : size_{0}, capacity_{0}, head_{nullptr}, alloc_{alloc} {}
+
+template <class value_type, class Allocator, class Growth>
+vector<value_type, Allocator, Growth>::vector(size_type n,
+                                              const Allocator &alloc)
+    : vector(alloc) {
+  InitMemory(n);
+  ConstructAtEnd(n, [this](value_type *ptr) { ConstructAt(ptr); });
+}
+
+template <class value_type, class Allocator, class Growth>
+vector<value_type, Allocator, Growth>::vector(size_type n, value_type x,
+                                              const Allocator &alloc)
+    : vector(alloc) {
+  InitMemory(n);
+  if constexpr (simd::kVectorizable<value_type>) {
+    simd::fill(head_, head_ + n, x);
+    size_ = n;
+  } else {
+    ConstructAtEnd(n, [this, &x](value_type *ptr) { ConstructAt(ptr, x); });
+  }
 }
 
 // конструктор списка инициализаторов, создает вектор,
 // инициализированный с помощью std::initializer_list<T>
-template <class value_type>
-vector<value_type>::vector(std::initializer_list<value_type> const &items) {
-  size_ = capacity_ = items.size();
-  InitMemory();
-  size_type i = 0;
-  for (const_reference val : items) {
-    *(head_ + i) = val;
-    ++i;
-  }
+template <class value_type, class Allocator, class Growth>
+vector<value_type, Allocator, Growth>::vector(
+    std::initializer_list<value_type> const &items, const Allocator &alloc)
+    : vector(alloc) {
+  InitMemory(items.size());
+  auto it = items.begin();
+  ConstructAtEnd(items.size(), [this, &it](value_type *ptr) {
+    ConstructAt(ptr, *it);
+    ++it;
+  });
 }
 
 /* Copy Constructor */
-template <class value_type>
-vector<value_type>::vector(const vector &v) {
-  if (this != &v) {
+template <class value_type, class Allocator, class Growth>
+vector<value_type, Allocator, Growth>::vector(const vector &v)
+    : vector(v, AllocTraits::select_on_container_copy_construction(v.alloc_)) {}
+
+// копия v, память которой выделяет alloc
+template <class value_type, class Allocator, class Growth>
+vector<value_type, Allocator, Growth>::vector(const vector &v,
+                                              const Allocator &alloc)
+    : vector(alloc) {
+  InitMemory(v.capacity_);
+  if constexpr (std::is_trivially_copyable_v<value_type>) {
+    if (v.size_) std::memcpy(head_, v.head_, v.size_ * sizeof(value_type));
     size_ = v.size_;
-    capacity_ = v.capacity_;
-    InitMemory();
-    CopyVector(head_, v.head_);
+  } else {
+    const value_type *src = v.head_;
+    ConstructAtEnd(v.size_, [this, &src](value_type *ptr) {
+      ConstructAt(ptr, *src++);
+    });
   }
 }
 
-/* Move Constructor*/
-template <class value_type>
-vector<value_type>::vector(vector &&v) {
+/* Move Constructor: аллокатор переезжает вместе с буфером */
+template <class value_type, class Allocator, class Growth>
+vector<value_type, Allocator, Growth>::vector(vector &&v) noexcept
+    : size_{v.size_},
+      capacity_{v.capacity_},
+      head_{v.head_},
+      alloc_{std::move(v.alloc_)} {
+  v.size_ = v.capacity_ = 0;
+  v.head_ = nullptr;
+}
+
+template <class value_type, class Allocator, class Growth>
+vector<value_type, Allocator, Growth>::~vector() {
+  Destroy(head_, head_ + size_);
+  DeallocateBuffer(head_, capacity_);
+}
+
+// копирующее присваивание через copy-and-swap. Копия строится на том
+// аллокаторе, который останется у вектора после присваивания
+template <class value_type, class Allocator, class Growth>
+vector<value_type, Allocator, Growth> &
+vector<value_type, Allocator, Growth>::operator=(const vector &v) {
   if (this != &v) {
-    size_ = capacity_ = 0;
-    head_ = nullptr;
-    std::swap(size_, v.size_);
-    std::swap(capacity_, v.capacity_);
-    std::swap(head_, v.head_);
+    if constexpr (AllocTraits::propagate_on_container_copy_assignment::value) {
+      vector tmp(v, v.alloc_);
+      SwapBuffers(tmp);
+      std::swap(alloc_, tmp.alloc_);
+    } else {
+      vector tmp(v, alloc_);
+      SwapBuffers(tmp);
+    }
   }
+  return *this;
 }
 
-template <class value_type>
-vector<value_type>::~vector() {
-  delete[] head_;
+// Перегрузка оператора присваивания для движущегося объекта: забирает буфер
+// v за O(1), v остаётся пустым, старое содержимое уничтожается. Если
+// аллокатор не переезжает и не равен аллокатору v, чужой буфер забрать
+// нельзя — элементы перемещаются по одному в свою память
+template <class value_type, class Allocator, class Growth>
+vector<value_type, Allocator, Growth> &
+vector<value_type, Allocator, Growth>::operator=(vector &&v) noexcept(
+    kMoveAssignSteals) {
+  if (this != &v) {
+    if constexpr (AllocTraits::propagate_on_container_move_assignment::value) {
+      vector tmp(std::move(v));
+      SwapBuffers(tmp);
+      std::swap(alloc_, tmp.alloc_);
+    } else if (kMoveAssignSteals || alloc_ == v.alloc_) {
+      vector tmp(std::move(v));
+      SwapBuffers(tmp);
+    } else {
+      vector tmp(alloc_);
+      tmp.InitMemory(v.size_);
+      value_type *src = v.head_;
+      tmp.ConstructAtEnd(v.size_, [&tmp, &src](value_type *ptr) {
+        tmp.ConstructAt(ptr, std::move(*src++));
+      });
+      SwapBuffers(tmp);
+      v.clear();
+    }
+  }
+  return *this;
 }
 
-// Перегрузка оператора присваивания для движущегося объекта
-template <class value_type>
-void vector<value_type>::operator=(vector &&v) {
-  vector(std::move(v));
+template <class value_type, class Allocator, class Growth>
+typename vector<value_type, Allocator, Growth>::allocator_type
+vector<value_type, Allocator, Growth>::get_allocator() const {
+  return alloc_;
 }
 
 /*****************************************/
 
-/* Инициализировать память*/
-template <class value_type>
-void vector<value_type>::InitMemory() {
-  if (size_)
-    head_ = new value_type[size_];
-  else
-    head_ = nullptr;
+/* Инициализировать память: capacity сырых ячеек, элементы не создаются*/
+template <class value_type, class Allocator, class Growth>
+void vector<value_type, Allocator, Growth>::InitMemory(size_type capacity) {
+  head_ = AllocateBuffer(capacity);
+  capacity_ = capacity;
+}
+
+// сырая память под n элементов от аллокатора вектора
+template <class value_type, class Allocator, class Growth>
+typename vector<value_type, Allocator, Growth>::value_type *
+vector<value_type, Allocator, Growth>::AllocateBuffer(size_type n) {
+  return n ? AllocTraits::allocate(alloc_, n) : nullptr;
+}
+
+// аллокатору возвращается тот же размер n, что был запрошен
+template <class value_type, class Allocator, class Growth>
+void vector<value_type, Allocator, Growth>::DeallocateBuffer(value_type *ptr,
+                                                             size_type n) {
+  if (ptr) AllocTraits::deallocate(alloc_, ptr, n);
 }
 
-template <class value_type>
-void vector<value_type>::CopyVector(value_type *dst, value_type *src) {
-  for (size_type i = 0; i < size_; ++i) {
-    *(dst + i) = *(src + i);
+// создаёт элемент в сырой ячейке ptr через аллокатор
+template <class value_type, class Allocator, class Growth>
+template <typename... Args>
+void vector<value_type, Allocator, Growth>::ConstructAt(value_type *ptr,
+                                                        Args &&...args) {
+  AllocTraits::construct(alloc_, ptr, std::forward<Args>(args)...);
+}
+
+template <class value_type, class Allocator, class Growth>
+void vector<value_type, Allocator, Growth>::Destroy(value_type *first,
+                                                    value_type *last) {
+  if constexpr (!std::is_trivially_destructible_v<value_type>) {
+    for (; first != last; ++first) AllocTraits::destroy(alloc_, first);
   }
 }
 
-template <class value_type>
-void vector<value_type>::IncreaseCapacity() {
-  if (size_ == capacity_) {
-    if (capacity_)
-      capacity_ *= 2;
-    else
-      capacity_ = 1;
-    if (capacity_ > max_size()) throw("capacity_ > max_size()");
+// создаёт count элементов после последнего, ёмкости должно хватать.
+// size_ растёт вместе с каждым созданным элементом, так что при исключении
+// деструктор вектора уничтожит ровно созданные
+template <class value_type, class Allocator, class Growth>
+template <typename Construct>
+void vector<value_type, Allocator, Growth>::ConstructAtEnd(
+    size_type count, Construct construct) {
+  for (size_type i = 0; i < count; ++i, ++size_) construct(head_ + size_);
+}
+
+// меняет местами буферы, аллокаторы остаются на месте
+template <class value_type, class Allocator, class Growth>
+void vector<value_type, Allocator, Growth>::SwapBuffers(
+    vector &other) noexcept {
+  std::swap(size_, other.size_);
+  std::swap(capacity_, other.capacity_);
+  std::swap(head_, other.head_);
+}
+
+template <size_t Num, size_t Den>
+size_t GeometricGrowth<Num, Den>::Next(size_t capacity, size_t required) {
+  size_t next = capacity / Den * Num + capacity % Den * Num / Den;
+  if (next <= capacity) next = capacity + 1;
+  return next < required ? required : next;
+}
+
+// ёмкость, которую получит вектор при росте до required элементов
+template <class value_type, class Allocator, class Growth>
+typename vector<value_type, Allocator, Growth>::size_type
+vector<value_type, Allocator, Growth>::NextCapacity(size_type required) {
+  size_type next = Growth::Next(capacity_, required);
+  if (next > max_size()) next = max_size();
+  if (required > next) throw std::length_error("capacity_ > max_size()");
+  return next;
+}
+
+// перевыделяет память, только если required не помещается в текущую ёмкость
+template <class value_type, class Allocator, class Growth>
+void vector<value_type, Allocator, Growth>::GrowFor(size_type required) {
+  if (required > capacity_) ReserveWithoutCheck(NextCapacity(required));
+}
+
+// освобождает место под count элементов перед pos: сдвигом на месте, если
+// хватает ёмкости, иначе одним перевыделением. Возвращает начало
+// неинициализированного промежутка, size_ не меняет
+template <class value_type, class Allocator, class Growth>
+typename vector<value_type, Allocator, Growth>::value_type *
+vector<value_type, Allocator, Growth>::MakeRoom(value_type *pos,
+                                                size_type count) {
+  size_type index = pos - head_;
+  if (size_ + count <= capacity_) {
+    Ops::OpenGap(pos, head_ + size_, count);
+  } else if constexpr (kReallocates) {
+    ReserveWithoutCheck(NextCapacity(size_ + count));
+    Ops::OpenGap(head_ + index, head_ + size_, count);
+  } else {
+    size_type new_capacity = NextCapacity(size_ + count);
+    value_type *tmp = AllocateBuffer(new_capacity);
+    try {
+      Ops::RelocateAround(head_, pos, head_ + size_, tmp, count);
+    } catch (...) {
+      DeallocateBuffer(tmp, new_capacity);
+      throw;
+    }
+    Destroy(head_, head_ + size_);
+    DeallocateBuffer(head_, capacity_);
+    head_ = tmp;
+    capacity_ = new_capacity;
   }
+  return head_ + index;
+}
+
+// вставляет count элементов перед pos, construct(ptr) создаёт очередной
+// элемент в неинициализированной ячейке ptr
+template <class value_type, class Allocator, class Growth>
+template <typename Construct>
+typename vector<value_type, Allocator, Growth>::value_type *
+vector<value_type, Allocator, Growth>::InsertN(value_type *pos,
+                                               size_type count,
+                                               Construct construct) {
+  if (!count) return pos;
+  value_type *gap = MakeRoom(pos, count);
+  Ops::FillGap(gap, head_ + size_ + count, count, construct);
+  size_ += count;
+  return gap;
 }
 
 /***********************************************/
 
 // доступ к указанному элементу с проверкой границ
-template <class value_type>
-typename vector<value_type>::reference vector<value_type>::at(size_type pos) {
+template <class value_type, class Allocator, class Growth>
+typename vector<value_type, Allocator, Growth>::reference
+vector<value_type, Allocator, Growth>::at(size_type pos) {
   if (pos < size_) return operator[](pos);
   throw std::out_of_range("Out of range");
 }
 
 // доступ к указанному элементу
-template <class value_type>
-typename vector<value_type>::reference vector<value_type>::operator[](
-    size_type pos) {
+template <class value_type, class Allocator, class Growth>
+typename vector<value_type, Allocator, Growth>::reference
+vector<value_type, Allocator, Growth>::operator[](size_type pos) {
   return *(head_ + pos);
 }
 
 // получить доступ к первому элементу
-template <class value_type>
-typename vector<value_type>::const_reference vector<value_type>::front() {
+template <class value_type, class Allocator, class Growth>
+typename vector<value_type, Allocator, Growth>::const_reference
+vector<value_type, Allocator, Growth>::front() {
   return *head_;
 }
 
 // получить доступ к последниму элементу
-template <class value_type>
-typename vector<value_type>::const_reference vector<value_type>::back() {
+template <class value_type, class Allocator, class Growth>
+typename vector<value_type, Allocator, Growth>::const_reference
+vector<value_type, Allocator, Growth>::back() {
   return *(head_ + size_ - 1);
 }
 
 // прямой доступ к базовому массиву
-template <class value_type>
-typename vector<value_type>::value_type *vector<value_type>::data() {
+template <class value_type, class Allocator, class Growth>
+typename vector<value_type, Allocator, Growth>::value_type *
+vector<value_type, Allocator, Growth>::data() {
   return head_;
 }
 
 /***************************************************************/
 
-// base
-template <class value_type>
-typename vector<value_type>::value_type *vector<value_type>::iterator::base() {
-  return iter_;
-}
-
 /**************************************************************/
 
 // возвращает итератор в начало
-template <class value_type>
-typename vector<value_type>::iterator vector<value_type>::begin() {
+template <class value_type, class Allocator, class Growth>
+typename vector<value_type, Allocator, Growth>::iterator
+vector<value_type, Allocator, Growth>::begin() {
   return iterator(this->head_);
 }
 
 // возвращает итератор конец
-template <class value_type>
-typename vector<value_type>::iterator vector<value_type>::end() {
+template <class value_type, class Allocator, class Growth>
+typename vector<value_type, Allocator, Growth>::iterator
+vector<value_type, Allocator, Growth>::end() {
   return iterator(this->head_ + size_);
 }
 
+template <class value_type, class Allocator, class Growth>
+typename vector<value_type, Allocator, Growth>::const_iterator
+vector<value_type, Allocator, Growth>::begin() const {
+  return const_iterator(this->head_);
+}
+
+template <class value_type, class Allocator, class Growth>
+typename vector<value_type, Allocator, Growth>::const_iterator
+vector<value_type, Allocator, Growth>::end() const {
+  return const_iterator(this->head_ + size_);
+}
+
+template <class value_type, class Allocator, class Growth>
+typename vector<value_type, Allocator, Growth>::const_iterator
+vector<value_type, Allocator, Growth>::cbegin() const {
+  return const_iterator(this->head_);
+}
+
+template <class value_type, class Allocator, class Growth>
+typename vector<value_type, Allocator, Growth>::const_iterator
+vector<value_type, Allocator, Growth>::cend() const {
+  return const_iterator(this->head_ + size_);
+}
+
+// позиция константного итератора в изменяемой памяти вектора
+template <class value_type, class Allocator, class Growth>
+typename vector<value_type, Allocator, Growth>::value_type *
+vector<value_type, Allocator, Growth>::Unconst(const_iterator pos) {
+  return head_ + (pos.base() - head_);
+}
+
 /***************************************************************/
 
 // проверяет, пуст ли контейнер
-template <class value_type>
-bool vector<value_type>::empty() {
+template <class value_type, class Allocator, class Growth>
+bool vector<value_type, Allocator, Growth>::empty() {
   return !size_;
 }
 
 // возращает кол-во элементов
-template <class value_type>
-typename vector<value_type>::size_type vector<value_type>::size() {
+template <class value_type, class Allocator, class Growth>
+typename vector<value_type, Allocator, Growth>::size_type
+vector<value_type, Allocator, Growth>::size() {
   return size_;
 }
 
 // возвращает максимально возможное количество элементов
-template <class value_type>
-typename vector<value_type>::size_type vector<value_type>::max_size() {
-  return std::numeric_limits<int64_t>::max() / sizeof(value_type);
+template <class value_type, class Allocator, class Growth>
+typename vector<value_type, Allocator, Growth>::size_type
+vector<value_type, Allocator, Growth>::max_size() {
+  return std::min<size_type>(
+      std::numeric_limits<int64_t>::max() / sizeof(value_type),
+      AllocTraits::max_size(alloc_));
 }
 
 // выделяет хранилище элементов размера и копирует текущие элементы массива в
 // новый выделенный массив
-template <class value_type>
-void vector<value_type>::reserve(size_type size) {
-  if (size > capacity_ && size < max_size()) {
-    capacity_ = size;
-    ReserveWithoutCheck();
+template <class value_type, class Allocator, class Growth>
+void vector<value_type, Allocator, Growth>::reserve(size_type size) {
+  if (size > capacity_ && size < max_size()) ReserveWithoutCheck(size);
+}
+
+// аллокатор с reallocate меняет размер буфера сам, например через mremap
+template <class value_type, class Allocator, class Growth>
+void vector<value_type, Allocator, Growth>::ReserveWithoutCheck(
+    size_type new_capacity) {
+  if constexpr (kReallocates) {
+    head_ = alloc_.reallocate(head_, capacity_, new_capacity);
+    capacity_ = new_capacity;
+    return;
   }
-}
-
-template <class value_type>
-void vector<value_type>::ReserveWithoutCheck() {
-  value_type *tmp = new value_type[capacity_];
-  CopyVector(tmp, head_);
-  delete[] head_;
+  value_type *tmp = AllocateBuffer(new_capacity);
+  try {
+    Ops::Relocate(head_, head_ + size_, tmp);
+  } catch (...) {
+    DeallocateBuffer(tmp, new_capacity);
+    throw;
+  }
+  Destroy(head_, head_ + size_);
+  DeallocateBuffer(head_, capacity_);
   head_ = tmp;
+  capacity_ = new_capacity;
 }
 
 // возвращает количество элементов, которые могут храниться в выделенном в
 // данный момент
-template <class value_type>
-typename vector<value_type>::size_type vector<value_type>::capacity() {
+template <class value_type, class Allocator, class Growth>
+typename vector<value_type, Allocator, Growth>::size_type
+vector<value_type, Allocator, Growth>::capacity() {
   return capacity_;
 }
 
 // уменьшает использование памяти, освобождая неиспользуемую
-template <class value_type>
-void vector<value_type>::shrink_to_fit() {
-  if (capacity_ > size_) {
-    capacity_ = size_;
-    ReserveWithoutCheck();
-  }
+template <class value_type, class Allocator, class Growth>
+void vector<value_type, Allocator, Growth>::shrink_to_fit() {
+  if (capacity_ > size_) ReserveWithoutCheck(size_);
 }
 /***********************************************/
 
 // //очищает содержимое
-template <class value_type>
-void vector<value_type>::clear() {
+template <class value_type, class Allocator, class Growth>
+void vector<value_type, Allocator, Growth>::clear() {
+  Destroy(head_, head_ + size_);
   size_ = 0;
 }
 
 // вставляет элементы в конкретную позицию и возвращает итератор,
 // указывающий на новый элемент
-template <class value_type>
-typename vector<value_type>::iterator vector<value_type>::insert(
-    iterator pos, const_reference value) {
-  value_type *ptr_end = end().base();
-  IncreaseCapacity();
-  ++size_;
-  value_type *tmp = new value_type[size_];
-  value_type *ptr_pos = pos.base();
-  size_type i = 0;
-  for (; head_ != ptr_pos; ++head_, ++i) {
-    tmp[i] = *head_;
-  }
-  value_type *result = head_;
-  tmp[i++] = value;
-  for (; head_ != ptr_end; ++head_, ++i) {
-    tmp[i] = *head_;
+template <class value_type, class Allocator, class Growth>
+typename vector<value_type, Allocator, Growth>::iterator
+vector<value_type, Allocator, Growth>::insert(const_iterator pos,
+                                              const_reference value) {
+  // value может ссылаться на элемент, который сдвинется
+  value_type copy(value);
+  return insert(pos, std::move(copy));
+}
+
+template <class value_type, class Allocator, class Growth>
+typename vector<value_type, Allocator, Growth>::iterator
+vector<value_type, Allocator, Growth>::insert(const_iterator pos,
+                                              value_type &&value) {
+  return iterator(InsertN(Unconst(pos), 1, [this, &value](value_type *ptr) {
+    ConstructAt(ptr, std::move(value));
+  }));
+}
+
+// вставляет count копий value перед pos
+template <class value_type, class Allocator, class Growth>
+typename vector<value_type, Allocator, Growth>::iterator
+vector<value_type, Allocator, Growth>::insert(const_iterator pos,
+                                              size_type count,
+                                              const_reference value) {
+  value_type copy(value);
+  return iterator(InsertN(Unconst(pos), count, [this, &copy](value_type *ptr) {
+    ConstructAt(ptr, copy);
+  }));
+}
+
+// вставляет [first, last) перед pos; итераторы не должны указывать в этот
+// же вектор. Прямые итераторы проходятся дважды: длина, затем один сдвиг,
+// однопроходные вставляет ElementOps::InsertByAppend
+template <class value_type, class Allocator, class Growth>
+template <typename InputIt, typename>
+typename vector<value_type, Allocator, Growth>::iterator
+vector<value_type, Allocator, Growth>::insert(const_iterator pos,
+                                              InputIt first, InputIt last) {
+  typedef typename std::iterator_traits<InputIt>::iterator_category Category;
+  if constexpr (std::is_base_of_v<std::forward_iterator_tag, Category>) {
+    size_type count = std::distance(first, last);
+    return iterator(
+        InsertN(Unconst(pos), count, [this, &first](value_type *ptr) {
+          ConstructAt(ptr, *first);
+          ++first;
+        }));
+  } else {
+    return Ops::InsertByAppend(*this, Unconst(pos) - head_, first, last);
   }
-  head_ = tmp;
-  return iterator(result);
+}
+
+template <class value_type, class Allocator, class Growth>
+typename vector<value_type, Allocator, Growth>::iterator
+vector<value_type, Allocator, Growth>::insert(
+    const_iterator pos, std::initializer_list<value_type> items) {
+  return insert(pos, items.begin(), items.end());
 }
 
 // стирает элемент в позиции
-template <class value_type>
-void vector<value_type>::erase(iterator pos) {
-  value_type *ptr_pos = pos.base();
+template <class value_type, class Allocator, class Growth>
+void vector<value_type, Allocator, Growth>::erase(const_iterator pos) {
+  value_type *ptr_pos = Unconst(pos);
   value_type *ptr_end = end().base();
-  while (ptr_pos != ptr_end) {
-    value_type *tmp = ptr_pos;
-    if (++ptr_pos != ptr_end) *tmp = *ptr_pos;
+  if constexpr (std::is_trivially_copyable_v<value_type>) {
+    std::memmove(ptr_pos, ptr_pos + 1,
+                 (ptr_end - ptr_pos - 1) * sizeof(value_type));
+  } else {
+    std::move(ptr_pos + 1, ptr_end, ptr_pos);
   }
   --size_;
+  Destroy(head_ + size_, head_ + size_ + 1);
+}
+
+// стирает [first, last) одним сдвигом хвоста
+template <class value_type, class Allocator, class Growth>
+typename vector<value_type, Allocator, Growth>::iterator
+vector<value_type, Allocator, Growth>::erase(const_iterator first,
+                                             const_iterator last) {
+  value_type *from = Unconst(first);
+  size_type count = last - first;
+  if (count) {
+    Destroy(from, from + count);
+    Ops::CloseGap(from, head_ + size_, count);
+    size_ -= count;
+  }
+  return iterator(from);
+}
+
+// стирает все элементы, для которых pred истинен, за один проход.
+// Возвращает количество удалённых элементов
+template <class value_type, class Allocator, class Growth>
+template <typename Predicate>
+typename vector<value_type, Allocator, Growth>::size_type
+vector<value_type, Allocator, Growth>::erase_if(Predicate pred) {
+  value_type *last = head_ + size_;
+  value_type *out = Ops::RemoveIf(head_, last, pred);
+  size_type removed = last - out;
+  Destroy(out, last);
+  size_ -= removed;
+  return removed;
 }
 
 // добавляет элемент в конец
-template <class value_type>
-void vector<value_type>::push_back(const_reference value) {
-  IncreaseCapacity();
-  ReserveWithoutCheck();
-  *(head_ + size_) = value;
-  ++size_;
+template <class value_type, class Allocator, class Growth>
+void vector<value_type, Allocator, Growth>::push_back(const_reference value) {
+  emplace_back(value);
+}
+
+template <class value_type, class Allocator, class Growth>
+void vector<value_type, Allocator, Growth>::push_back(value_type &&value) {
+  emplace_back(std::move(value));
 }
 
 // удаляет последний элемент
-template <class value_type>
-void vector<value_type>::pop_back() {
+template <class value_type, class Allocator, class Growth>
+void vector<value_type, Allocator, Growth>::pop_back() {
   if (size_ == 0)
     throw std::invalid_argument("pointer being freed was not allocated");
   --size_;
+  Destroy(head_ + size_, head_ + size_ + 1);
 }
 
-// меняет местами сожержимое
-template <class value_type>
-void vector<value_type>::swap(vector &other) {
-  std::swap(size_, other.size_);
-  std::swap(capacity_, other.capacity_);
-  std::swap(head_, other.head_);
+// меняет местами сожержимое; аллокаторы меняются, только если этого
+// требует propagate_on_container_swap
+template <class value_type, class Allocator, class Growth>
+void vector<value_type, Allocator, Growth>::swap(vector &other) noexcept {
+  SwapBuffers(other);
+  if constexpr (AllocTraits::propagate_on_container_swap::value) {
+    std::swap(alloc_, other.alloc_);
+  }
 }
 
 /*************************************************************/
 
-// вставляет новые элементы в контейнер непосредственно перед pos
-template <class value_type>
+// создаёт элемент из args непосредственно перед pos, см.
+// ElementOps::Emplace
+template <class value_type, class Allocator, class Growth>
 template <typename... Args>
-typename vector<value_type>::iterator vector<value_type>::emplace(
-    const_iterator pos, Args &&...args) {
-  iterator result(pos);
-  result = insert(result, value_type(std::forward<Args>(args)...));
-  return result;
+typename vector<value_type, Allocator, Growth>::iterator
+vector<value_type, Allocator, Growth>::emplace(const_iterator pos,
+                                               Args &&...args) {
+  return Ops::Emplace(*this, pos, std::forward<Args>(args)...);
 }
 
-// добавляет новые элементы в конец контейнера
-template <class value_type>
+// создаёт элемент из args прямо в конце вектора. При росте элемент
+// конструируется в новом буфере до переноса старых, поэтому args может
+// ссылаться на элементы этого же вектора
+template <class value_type, class Allocator, class Growth>
 template <typename... Args>
-void vector<value_type>::emplace_back(Args &&...args) {
-  this->push_back(value_type(std::forward<Args>(args)...));
+typename vector<value_type, Allocator, Growth>::reference
+vector<value_type, Allocator, Growth>::emplace_back(Args &&...args) {
+  if constexpr (kReallocates) {
+    if (size_ == capacity_) {
+      // reallocate может сдвинуть буфер, поэтому элемент создаётся заранее
+      value_type value(std::forward<Args>(args)...);
+      ReserveWithoutCheck(NextCapacity(size_ + 1));
+      ConstructAt(head_ + size_, value);
+      return *(head_ + size_++);
+    }
+  }
+  if (size_ == capacity_) {
+    size_type new_capacity = NextCapacity(size_ + 1);
+    value_type *tmp = AllocateBuffer(new_capacity);
+    try {
+      ConstructAt(tmp + size_, std::forward<Args>(args)...);
+    } catch (...) {
+      DeallocateBuffer(tmp, new_capacity);
+      throw;
+    }
+    try {
+      Ops::Relocate(head_, head_ + size_, tmp);
+    } catch (...) {
+      Destroy(tmp + size_, tmp + size_ + 1);
+      DeallocateBuffer(tmp, new_capacity);
+      throw;
+    }
+    Destroy(head_, head_ + size_);
+    DeallocateBuffer(head_, capacity_);
+    head_ = tmp;
+    capacity_ = new_capacity;
+  } else {
+    ConstructAt(head_ + size_, std::forward<Args>(args)...);
+  }
+  return *(head_ + size_++);
+}
+
+/* ElementOps ****************************************************/
+
+// выделяет сырую память под n элементов без их конструирования
+template <typename T>
+T *ElementOps<T>::Allocate(size_t n) {
+  if (!n) return nullptr;
+  return static_cast<T *>(
+      ::operator new(n * sizeof(T), std::align_val_t{alignof(T)}));
+}
+
+template <typename T>
+void ElementOps<T>::Deallocate(T *ptr) {
+  if (ptr) ::operator delete(ptr, std::align_val_t{alignof(T)});
+}
+
+// переносит [first, last) в неинициализированную память dst, исходные
+// объекты остаются живыми и уничтожаются вызывающим
+template <typename T>
+void ElementOps<T>::Relocate(T *first, T *last, T *dst) {
+  if constexpr (std::is_trivially_copyable_v<T>) {
+    if (first != last) std::memcpy(dst, first, (last - first) * sizeof(T));
+  } else if constexpr (std::is_nothrow_move_constructible_v<T> ||
+                       !std::is_copy_constructible_v<T>) {
+    // как std::move_if_noexcept: перемещаем, если перемещение не бросает
+    // (вложенные контейнеры отдают буферы за O(1)) или копировать нельзя;
+    // иначе копируем, чтобы при исключении старый буфер остался целым
+    std::uninitialized_move(first, last, dst);
+  } else {
+    std::uninitialized_copy(first, last, dst);
+  }
 }
 
-template <class value_type>
-vector<value_type>::VectorIterator::VectorIterator() : iter_{nullptr} {}
+// переносит [first, last) в dst, оставляя перед pos промежуток из count
+// сырых ячеек. Если перенос бросит, уже перенесённое в dst уничтожается,
+// исходные элементы целы
+template <typename T>
+void ElementOps<T>::RelocateAround(T *first, T *pos, T *last, T *dst,
+                                   size_t count) {
+  Relocate(first, pos, dst);
+  try {
+    Relocate(pos, last, dst + (pos - first) + count);
+  } catch (...) {
+    std::destroy(dst, dst + (pos - first));
+    throw;
+  }
+}
 
-template <class value_type>
-vector<value_type>::VectorIterator::VectorIterator(value_type *iter)
-    : iter_{iter} {}
+// сдвигает [pos, last) вправо на count на месте, ёмкости должно хватать;
+// [pos, pos + count) после вызова — неинициализированная память
+template <typename T>
+void ElementOps<T>::OpenGap(T *pos, T *last, size_t count) {
+  if constexpr (std::is_trivially_copyable_v<T>) {
+    std::memmove(pos + count, pos, (last - pos) * sizeof(T));
+  } else {
+    for (T *src = last; src != pos;) {
+      --src;
+      if (src + count >= last)
+        new (src + count) T(std::move(*src));
+      else
+        *(src + count) = std::move(*src);
+    }
+    std::destroy(pos, pos + std::min<size_t>(count, last - pos));
+  }
+}
 
-template <class value_type>
-typename vector<value_type>::reference
-vector<value_type>::iterator::operator*() {
+// обратная к OpenGap: [pos, pos + count) — неинициализированная память,
+// хвост [pos + count, last) сдвигается на её место, конец становится сырым
+template <typename T>
+void ElementOps<T>::CloseGap(T *pos, T *last, size_t count) {
+  if constexpr (std::is_trivially_copyable_v<T>) {
+    std::memmove(pos, pos + count, (last - pos - count) * sizeof(T));
+  } else {
+    T *gap_end = pos + count;
+    for (T *src = gap_end; src != last; ++src) {
+      if (src - count < gap_end)
+        new (src - count) T(std::move(*src));
+      else
+        *(src - count) = std::move(*src);
+    }
+    std::destroy(std::max(gap_end, last - count), last);
+  }
+}
+
+// создаёт count элементов в промежутке gap, открытом перед хвостом
+// [gap + count, last); construct(ptr) создаёт очередной. Если он бросит,
+// созданные уничтожаются, а хвост сдвигается обратно на место промежутка
+template <typename T>
+template <typename Construct>
+void ElementOps<T>::FillGap(T *gap, T *last, size_t count,
+                            Construct construct) {
+  size_t done = 0;
+  try {
+    for (; done < count; ++done) construct(gap + done);
+  } catch (...) {
+    std::destroy(gap, gap + done);
+    CloseGap(gap, last, count);
+    throw;
+  }
+}
+
+// сдвигает к началу элементы, для которых pred ложен, за один проход;
+// тривиально копируемые выжившие переносятся блоками через memmove.
+// Возвращает новый конец, [новый конец, last) остаются живыми
+template <typename T>
+template <typename Predicate>
+T *ElementOps<T>::RemoveIf(T *first, T *last, Predicate pred) {
+  T *out = std::find_if(first, last, pred);
+  if (out == last) return last;
+  if constexpr (std::is_trivially_copyable_v<T>) {
+    T *run = out + 1;
+    while (run != last) {
+      while (run != last && pred(*run)) ++run;
+      if (run == last) break;
+      T *run_end = run + 1;
+      while (run_end != last && !pred(*run_end)) ++run_end;
+      std::memmove(out, run, (run_end - run) * sizeof(T));
+      out += run_end - run;
+      run = run_end == last ? last : run_end + 1;
+    }
+  } else {
+    for (T *it = out + 1; it != last; ++it) {
+      if (!pred(*it)) *out++ = std::move(*it);
+    }
+  }
+  return out;
+}
+
+// Однопроходный диапазон (istream_iterator) нельзя ни измерить, ни
+// пройти дважды: элементы дописываются в конец v по одному и
+// поворачиваются на место offset. Если дописывание бросит, дописанное
+// стирается и v прежний
+template <typename T>
+template <typename Vector, typename InputIt>
+typename Vector::iterator ElementOps<T>::InsertByAppend(Vector &v,
+                                                        size_t offset,
+                                                        InputIt first,
+                                                        InputIt last) {
+  size_t old_size = v.size();
+  try {
+    for (; first != last; ++first) v.emplace_back(*first);
+  } catch (...) {
+    v.erase(v.begin() + old_size, v.end());
+    throw;
+  }
+  std::rotate(v.begin() + offset, v.begin() + old_size, v.end());
+  return v.begin() + offset;
+}
+
+// В конце v элемент конструируется прямо в ячейке; в середине — во
+// временном объекте, который затем перемещается, так как args может
+// ссылаться на сдвигаемый элемент
+template <typename T>
+template <typename Vector, typename... Args>
+constexpr typename Vector::iterator ElementOps<T>::Emplace(
+    Vector &v, typename Vector::const_iterator pos, Args &&...args) {
+  if (pos == v.cend()) {
+    v.emplace_back(std::forward<Args>(args)...);
+    return v.end() - 1;
+  }
+  T tmp(std::forward<Args>(args)...);
+  return v.insert(pos, std::move(tmp));
+}
+
+/* VectorIterator ************************************************/
+
+template <typename Item>
+constexpr VectorIterator<Item>::VectorIterator() : iter_{nullptr} {}
+
+template <typename Item>
+constexpr VectorIterator<Item>::VectorIterator(Item *iter) : iter_{iter} {}
+
+// iterator -> const_iterator
+template <typename Item>
+template <typename Other, typename>
+constexpr VectorIterator<Item>::VectorIterator(
+    const VectorIterator<Other> &other)
+    : iter_{other.base()} {}
+
+template <typename Item>
+constexpr typename VectorIterator<Item>::reference
+VectorIterator<Item>::operator*() const {
   return *iter_;
 }
 
-template <class value_type>
-void vector<value_type>::iterator::operator++() {
+template <typename Item>
+constexpr typename VectorIterator<Item>::pointer
+VectorIterator<Item>::operator->() const {
+  return iter_;
+}
+
+template <typename Item>
+constexpr typename VectorIterator<Item>::reference
+VectorIterator<Item>::operator[](difference_type n) const {
+  return iter_[n];
+}
+
+template <typename Item>
+constexpr VectorIterator<Item> &VectorIterator<Item>::operator++() {
   ++iter_;
+  return *this;
 }
 
-template <class value_type>
-void vector<value_type>::iterator::operator--() {
+template <typename Item>
+constexpr VectorIterator<Item> VectorIterator<Item>::operator++(int) {
+  VectorIterator tmp(*this);
+  ++iter_;
+  return tmp;
+}
+
+template <typename Item>
+constexpr VectorIterator<Item> &VectorIterator<Item>::operator--() {
   --iter_;
+  return *this;
 }
 
-template <class value_type>
-bool vector<value_type>::iterator::operator==(
-    const VectorIterator &other) const {
-  return iter_ == other.iter_;
+template <typename Item>
+constexpr VectorIterator<Item> VectorIterator<Item>::operator--(int) {
+  VectorIterator tmp(*this);
+  --iter_;
+  return tmp;
 }
 
-template <class value_type>
-bool vector<value_type>::iterator::operator!=(
-    const VectorIterator &other) const {
-  return iter_ != other.iter_;
+template <typename Item>
+constexpr VectorIterator<Item> &VectorIterator<Item>::operator+=(
+    difference_type n) {
+  iter_ += n;
+  return *this;
 }
 
-template <class value_type>
-typename vector<value_type>::const_iterator vector<value_type>::cbegin() {
-  return const_iterator(this->head_);
+template <typename Item>
+constexpr VectorIterator<Item> &VectorIterator<Item>::operator-=(
+    difference_type n) {
+  iter_ -= n;
+  return *this;
 }
 
-template <class value_type>
-typename vector<value_type>::const_iterator vector<value_type>::cend() {
-  return const_iterator(this->head_ + size_);
+template <typename Item>
+constexpr VectorIterator<Item> VectorIterator<Item>::operator+(
+    difference_type n) const {
+  return VectorIterator(iter_ + n);
+}
+
+template <typename Item>
+constexpr VectorIterator<Item> VectorIterator<Item>::operator-(
+    difference_type n) const {
+  return VectorIterator(iter_ - n);
+}
+
+template <typename Item>
+template <typename Other>
+constexpr typename VectorIterator<Item>::difference_type
+VectorIterator<Item>::operator-(const VectorIterator<Other> &other) const {
+  return iter_ - other.base();
+}
+
+template <typename Item>
+template <typename Other>
+constexpr bool VectorIterator<Item>::operator==(
+    const VectorIterator<Other> &other) const {
+  return iter_ == other.base();
+}
+
+template <typename Item>
+template <typename Other>
+constexpr bool VectorIterator<Item>::operator!=(
+    const VectorIterator<Other> &other) const {
+  return iter_ != other.base();
+}
+
+template <typename Item>
+template <typename Other>
+constexpr bool VectorIterator<Item>::operator<(
+    const VectorIterator<Other> &other) const {
+  return iter_ < other.base();
+}
+
+template <typename Item>
+template <typename Other>
+constexpr bool VectorIterator<Item>::operator>(
+    const VectorIterator<Other> &other) const {
+  return iter_ > other.base();
+}
+
+template <typename Item>
+template <typename Other>
+constexpr bool VectorIterator<Item>::operator<=(
+    const VectorIterator<Other> &other) const {
+  return iter_ <= other.base();
+}
+
+template <typename Item>
+template <typename Other>
+constexpr bool VectorIterator<Item>::operator>=(
+    const VectorIterator<Other> &other) const {
+  return iter_ >= other.base();
+}
+
+template <typename Item>
+constexpr typename VectorIterator<Item>::pointer VectorIterator<Item>::base()
+    const {
+  return iter_;
 }
 
 }  // namespace s21
@@ -1,53 +1,189 @@
 #ifndef SRC_S21_VECTOR_H_
 #define SRC_S21_VECTOR_H_
+#include <algorithm>
+#include <cstring>
 #include <initializer_list>
+#include <iterator>
 #include <limits>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+
+#include "s21_simd.h"
 
 namespace s21 {
 
+// Политика геометрического роста ёмкости: новая ёмкость равна
+// capacity * Num / Den, но не меньше требуемой и строго больше текущей.
+// Даёт амортизированное O(1) на push_back.
+template <size_t Num = 2, size_t Den = 1>
+struct GeometricGrowth {
+  static_assert(Den > 0 && Num > Den, "growth factor must be greater than 1");
+  static size_t Next(size_t capacity, size_t required);
+};
+
+// Операции над элементами в сырой памяти, общие для vector и вариантов с
+// другим хранилищем: выделение, перенос в новый буфер, сдвиги на месте,
+// вставка с откатом. Тривиально копируемые типы обрабатываются через
+// memcpy/memmove. Контейнеры дают только память: свой буфер или кучу,
+// встроенный массив, отображённый файл
 template <typename T>
+struct ElementOps {
+  static T *Allocate(size_t n);
+  static void Deallocate(T *ptr);
+  static void Relocate(T *first, T *last, T *dst);
+  static void RelocateAround(T *first, T *pos, T *last, T *dst, size_t count);
+  static void OpenGap(T *pos, T *last, size_t count);
+  static void CloseGap(T *pos, T *last, size_t count);
+  template <typename Construct>
+  static void FillGap(T *gap, T *last, size_t count, Construct construct);
+  template <typename Predicate>
+  static T *RemoveIf(T *first, T *last, Predicate pred);
+  // вставки через открытый интерфейс вектора Vector
+  template <typename Vector, typename InputIt>
+  static typename Vector::iterator InsertByAppend(Vector &v, size_t offset,
+                                                  InputIt first, InputIt last);
+  template <typename Vector, typename... Args>
+  static constexpr typename Vector::iterator Emplace(
+      Vector &v, typename Vector::const_iterator pos, Args &&...args);
+};
+
+// Аллокатор с методом T *reallocate(T *ptr, size_t old_n, size_t new_n),
+// который меняет размер буфера с сохранением содержимого, как realloc.
+// Для тривиально копируемых элементов vector растёт и сжимается через
+// него, не копируя элементы сам
+template <typename Allocator, typename = void>
+struct HasReallocate : std::false_type {};
+template <typename Allocator>
+struct HasReallocate<Allocator, std::void_t<decltype(
+                                    std::declval<Allocator &>().reallocate(
+                                        nullptr, 0, 0))>> : std::true_type {};
+
+// Итератор произвольного доступа по непрерывной памяти. Item — тип элемента
+// для iterator и const-тип элемента для const_iterator; iterator неявно
+// приводится к const_iterator, сравнивать и вычитать их можно между собой.
+template <typename Item>
+class VectorIterator {
+ public:
+  typedef std::random_access_iterator_tag iterator_category;
+  typedef std::remove_const_t<Item> value_type;
+  typedef std::ptrdiff_t difference_type;
+  typedef Item *pointer;
+  typedef Item &reference;
+
+  constexpr VectorIterator();
+  constexpr VectorIterator(Item *iter);
+  template <typename Other, typename = std::enable_if_t<
+                                std::is_convertible_v<Other *, Item *>>>
+  constexpr VectorIterator(const VectorIterator<Other> &other);
+
+  constexpr reference operator*() const;
+  constexpr pointer operator->() const;
+  constexpr reference operator[](difference_type n) const;
+  constexpr VectorIterator &operator++();
+  constexpr VectorIterator operator++(int);
+  constexpr VectorIterator &operator--();
+  constexpr VectorIterator operator--(int);
+  constexpr VectorIterator &operator+=(difference_type n);
+  constexpr VectorIterator &operator-=(difference_type n);
+  constexpr VectorIterator operator+(difference_type n) const;
+  constexpr VectorIterator operator-(difference_type n) const;
+  template <typename Other>
+  constexpr difference_type operator-(
+      const VectorIterator<Other> &other) const;
+  template <typename Other>
+  constexpr bool operator==(const VectorIterator<Other> &other) const;
+  template <typename Other>
+  constexpr bool operator!=(const VectorIterator<Other> &other) const;
+  template <typename Other>
+  constexpr bool operator<(const VectorIterator<Other> &other) const;
+  template <typename Other>
+  constexpr bool operator>(const VectorIterator<Other> &other) const;
+  template <typename Other>
+  constexpr bool operator<=(const VectorIterator<Other> &other) const;
+  template <typename Other>
+  constexpr bool operator>=(const VectorIterator<Other> &other) const;
+  constexpr pointer base() const;
+
+  friend constexpr VectorIterator operator+(difference_type n,
+                                           const VectorIterator &it) {
+    return it + n;
+  }
+
+ protected:
+  Item *iter_;
+};
+
+// Память под элементы выделяет Allocator через std::allocator_traits, так
+// что вектор работает с любым стандартным аллокатором, в том числе с
+// аллокаторами арены и пула. Порядок параметров как у std::vector, политика
+// роста идёт третьей
+template <typename T, typename Allocator = std::allocator<T>,
+          typename Growth = GeometricGrowth<>>
 class vector {
- private:
+ public:
   typedef T value_type;
+  typedef Allocator allocator_type;
   typedef T &reference;
   typedef const T &const_reference;
   typedef size_t size_type;
+  typedef std::ptrdiff_t difference_type;
+  typedef VectorIterator<value_type> iterator;
+  typedef VectorIterator<const value_type> const_iterator;
+
+ private:
+  typedef ElementOps<value_type> Ops;
+  typedef std::allocator_traits<allocator_type> AllocTraits;
+  static_assert(std::is_same_v<typename AllocTraits::value_type, value_type>,
+                "Allocator::value_type must be T");
+
+  // перемещающее присваивание всегда забирает буфер, не копируя элементы
+  static constexpr bool kMoveAssignSteals =
+      AllocTraits::propagate_on_container_move_assignment::value ||
+      AllocTraits::is_always_equal::value;
+  // буфер переразмечается аллокатором, содержимое не переносится вручную
+  static constexpr bool kReallocates =
+      HasReallocate<allocator_type>::value &&
+      std::is_trivially_copyable_v<value_type>;
 
   size_type size_;
   size_type capacity_;
   value_type *head_;
+  allocator_type alloc_;
 
-  void InitMemory();
-  void IncreaseCapacity();
-  void CopyVector(value_type *dst, value_type *src);
-  void ReserveWithoutCheck();
+  void InitMemory(size_type capacity);
+  value_type *AllocateBuffer(size_type n);
+  void DeallocateBuffer(value_type *ptr, size_type n);
+  template <typename... Args>
+  void ConstructAt(value_type *ptr, Args &&...args);
+  void Destroy(value_type *first, value_type *last);
+  template <typename Construct>
+  void ConstructAtEnd(size_type count, Construct construct);
+  void SwapBuffers(vector &other) noexcept;
+  size_type NextCapacity(size_type required);
+  void GrowFor(size_type required);
+  void ReserveWithoutCheck(size_type new_capacity);
+  value_type *MakeRoom(value_type *pos, size_type count);
+  template <typename Construct>
+  value_type *InsertN(value_type *pos, size_type count, Construct construct);
+  value_type *Unconst(const_iterator pos);
 
  public:
   vector();
-  vector(size_type n);
-  vector(size_type n, value_type x);
-  vector(std::initializer_list<value_type> const &items);
+  explicit vector(const Allocator &alloc);
+  vector(size_type n, const Allocator &alloc = Allocator());
+  vector(size_type n, value_type x, const Allocator &alloc = Allocator());
+  vector(std::initializer_list<value_type> const &items,
+         const Allocator &alloc = Allocator());
   vector(const vector &v);
-  vector(vector &&v);
+  vector(const vector &v, const Allocator &alloc);
+  vector(vector &&v) noexcept;
   ~vector();
-  void operator=(vector &&v);
-
-  typedef class VectorIterator {
-   protected:
-    value_type *iter_;
-
-   public:
-    VectorIterator();
-    VectorIterator(value_type *iter);
-    reference operator*();
-    void operator++();
-    void operator--();
-    bool operator==(const VectorIterator &other) const;
-    bool operator!=(const VectorIterator &other) const;
-    value_type *base();
-  } iterator;
+  vector &operator=(const vector &v);
+  vector &operator=(vector &&v) noexcept(kMoveAssignSteals);
 
-  typedef const VectorIterator const_iterator;
+  allocator_type get_allocator() const;
 
   reference at(size_type pos);
   reference operator[](size_type pos);
@@ -57,9 +193,11 @@ class vector {
 
   iterator begin();
   iterator end();
+  const_iterator begin() const;
+  const_iterator end() const;
 
-  const_iterator cbegin();
-  const_iterator cend();
+  const_iterator cbegin() const;
+  const_iterator cend() const;
 
   bool empty();
   size_type size();
@@ -69,17 +207,27 @@ class vector {
   void shrink_to_fit();
 
   void clear();
-  iterator insert(iterator pos, const_reference value);
-  void erase(iterator pos);
+  iterator insert(const_iterator pos, const_reference value);
+  iterator insert(const_iterator pos, value_type &&value);
+  iterator insert(const_iterator pos, size_type count, const_reference value);
+  template <typename InputIt,
+            typename = std::enable_if_t<!std::is_integral_v<InputIt>>>
+  iterator insert(const_iterator pos, InputIt first, InputIt last);
+  iterator insert(const_iterator pos, std::initializer_list<value_type> items);
+  void erase(const_iterator pos);
+  iterator erase(const_iterator first, const_iterator last);
+  template <typename Predicate>
+  size_type erase_if(Predicate pred);
   void push_back(const_reference value);
+  void push_back(value_type &&value);
   void pop_back();
-  void swap(vector &other);
+  void swap(vector &other) noexcept;
 
   template <typename... Args>
   iterator emplace(const_iterator pos, Args &&...args);
 
   template <typename... Args>
-  void emplace_back(Args &&...args);
+  reference emplace_back(Args &&...args);
 };
 }  // namespace s21
 #include "s21_vector.cc"
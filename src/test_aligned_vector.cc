@@ -0,0 +1,66 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <string>
+
+#include "s21_aligned_vector.h"
+
+namespace {
+template <size_t Align, typename T>
+bool IsAligned(const T *ptr) {
+  return reinterpret_cast<uintptr_t>(ptr) % Align == 0;
+}
+}  // namespace
+
+TEST(AlignedVector, Growth_1) {
+  s21::aligned_vector<float, 64> my_vec;
+  for (int i = 0; i < 1000; ++i) {
+    my_vec.push_back(static_cast<float>(i));
+    ASSERT_TRUE(IsAligned<64>(my_vec.data()));
+  }
+  my_vec.insert(my_vec.begin() + 3, 500, 1.5f);
+  EXPECT_TRUE(IsAligned<64>(my_vec.data()));
+  my_vec.erase(my_vec.begin(), my_vec.begin() + 1001);
+  my_vec.shrink_to_fit();
+  EXPECT_EQ(my_vec.capacity(), 499);
+  EXPECT_TRUE(IsAligned<64>(my_vec.data()));
+  EXPECT_EQ(my_vec[0], 501.0f);
+  my_vec.reserve(10000);
+  EXPECT_TRUE(IsAligned<64>(my_vec.data()));
+}
+
+TEST(AlignedVector, Copy_1) {
+  s21::aligned_vector<double, 32> my_vec{1.0, 2.0, 3.0};
+  EXPECT_TRUE(IsAligned<32>(my_vec.data()));
+  s21::aligned_vector<double, 32> copy(my_vec);
+  EXPECT_TRUE(IsAligned<32>(copy.data()));
+  EXPECT_EQ(copy[2], 3.0);
+  s21::aligned_vector<double, 32> other(100, 0.5);
+  other = my_vec;
+  EXPECT_TRUE(IsAligned<32>(other.data()));
+  s21::aligned_vector<double, 32> moved(std::move(copy));
+  EXPECT_TRUE(IsAligned<32>(moved.data()));
+  EXPECT_EQ(moved.size(), 3);
+}
+
+TEST(AlignedVector, Strings_1) {
+  s21::aligned_vector<std::string, 128> my_vec{"a", "b"};
+  for (int i = 0; i < 100; ++i) my_vec.emplace_back(20, 'x');
+  EXPECT_TRUE(IsAligned<128>(my_vec.data()));
+  EXPECT_EQ(my_vec[1], "b");
+  EXPECT_EQ(my_vec.back(), std::string(20, 'x'));
+}
+
+TEST(AlignedVector, Allocator_1) {
+  typedef s21::aligned_allocator<int, 64> Alloc;
+  typedef std::allocator_traits<Alloc>::rebind_alloc<char> CharAlloc;
+  static_assert(std::is_same_v<CharAlloc, s21::aligned_allocator<char, 64>>);
+  static_assert(std::is_nothrow_move_assignable_v<s21::aligned_vector<int>>);
+  Alloc alloc;
+  CharAlloc char_alloc(alloc);
+  EXPECT_TRUE(alloc == char_alloc);
+  int *ptr = alloc.allocate(3);
+  EXPECT_TRUE(IsAligned<64>(ptr));
+  alloc.deallocate(ptr, 3);
+  EXPECT_THROW((void)alloc.allocate(SIZE_MAX / 2), std::bad_array_new_length);
+}
@@ -0,0 +1,360 @@
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+
+#include "s21_list.h"
+#include "s21_map.h"
+#include "s21_multiset.h"
+#include "s21_queue.h"
+#include "s21_set.h"
+#include "s21_stack.h"
+#include "s21_vector.h"
+
+namespace {
+struct AllocStats {
+  size_t allocs = 0;
+  size_t deallocs = 0;
+  size_t live_bytes = 0;
+};
+
+// Аллокатор со счётчиками. Propagate включает все три propagate_on_*, без
+// него два аллокатора с разной статистикой не равны и не переезжают
+template <typename T, bool Propagate = false>
+struct CountingAllocator {
+  typedef T value_type;
+  typedef std::bool_constant<Propagate>
+      propagate_on_container_copy_assignment;
+  typedef std::bool_constant<Propagate> propagate_on_container_move_assignment;
+  typedef std::bool_constant<Propagate> propagate_on_container_swap;
+  template <typename U>
+  struct rebind {
+    typedef CountingAllocator<U, Propagate> other;
+  };
+
+  explicit CountingAllocator(AllocStats *stats) : stats(stats) {}
+  template <typename U>
+  CountingAllocator(const CountingAllocator<U, Propagate> &other)
+      : stats(other.stats) {}
+
+  T *allocate(size_t n) {
+    ++stats->allocs;
+    stats->live_bytes += n * sizeof(T);
+    return std::allocator<T>().allocate(n);
+  }
+  void deallocate(T *ptr, size_t n) {
+    ++stats->deallocs;
+    stats->live_bytes -= n * sizeof(T);
+    std::allocator<T>().deallocate(ptr, n);
+  }
+
+  template <typename U>
+  bool operator==(const CountingAllocator<U, Propagate> &other) const {
+    return stats == other.stats;
+  }
+  template <typename U>
+  bool operator!=(const CountingAllocator<U, Propagate> &other) const {
+    return stats != other.stats;
+  }
+
+  AllocStats *stats;
+};
+
+// ключ только с перемещением: копия элемента не скомпилируется
+struct MoveOnly {
+  MoveOnly(int value = 0) : value(std::make_unique<int>(value)) {}
+  int key() const { return value ? *value : -1; }
+  bool operator==(const MoveOnly &other) const { return key() == other.key(); }
+  bool operator<(const MoveOnly &other) const { return key() < other.key(); }
+  bool operator>(const MoveOnly &other) const { return key() > other.key(); }
+  bool operator<=(const MoveOnly &other) const {
+    return key() <= other.key();
+  }
+  std::unique_ptr<int> value;
+};
+
+// ключ, считающий свои копии
+struct CountedKey {
+  static inline int copies = 0;
+  CountedKey(int value = 0) : value(value) {}
+  CountedKey(const CountedKey &other) : value(other.value) { ++copies; }
+  CountedKey(CountedKey &&other) noexcept = default;
+  CountedKey &operator=(const CountedKey &other) {
+    value = other.value;
+    ++copies;
+    return *this;
+  }
+  CountedKey &operator=(CountedKey &&other) noexcept = default;
+  bool operator==(const CountedKey &other) const {
+    return value == other.value;
+  }
+  bool operator<(const CountedKey &other) const { return value < other.value; }
+  bool operator>(const CountedKey &other) const { return value > other.value; }
+  int value;
+};
+}  // namespace
+
+TEST(Allocator, Default_1) {
+  static_assert(std::is_same_v<s21::map<int, int>::allocator_type,
+                               s21::pool_allocator<std::pair<const int, int>>>);
+  static_assert(std::is_same_v<s21::vector<int>::allocator_type,
+                               std::allocator<int>>);
+  static_assert(std::is_nothrow_move_assignable_v<s21::list<int>>);
+  static_assert(!std::is_nothrow_move_assignable_v<
+                s21::list<int, CountingAllocator<int>>>);
+  static_assert(std::is_nothrow_move_assignable_v<
+                s21::list<int, CountingAllocator<int, true>>>);
+  s21::map<int, int> my_map{{1, 2}};
+  EXPECT_EQ(my_map.at(1), 2);
+}
+
+TEST(Allocator, Vector_1) {
+  AllocStats stats;
+  {
+    CountingAllocator<std::string> alloc(&stats);
+    s21::vector<std::string, CountingAllocator<std::string>> my_vec(alloc);
+    EXPECT_EQ(stats.allocs, 0);
+    for (int i = 0; i < 100; ++i) my_vec.push_back(std::to_string(i));
+    // ёмкость 1, 2, 4, ..., 128
+    EXPECT_EQ(stats.allocs, 8);
+    EXPECT_EQ(stats.live_bytes, 128 * sizeof(std::string));
+    my_vec.insert(my_vec.begin(), 50, "x");
+    my_vec.erase(my_vec.begin(), my_vec.begin() + 10);
+    my_vec.shrink_to_fit();
+    EXPECT_EQ(stats.live_bytes, 140 * sizeof(std::string));
+    EXPECT_EQ(my_vec.get_allocator().stats, &stats);
+    auto copy = my_vec;
+    EXPECT_EQ(copy.get_allocator().stats, &stats);
+    EXPECT_EQ(copy[139], "99");
+  }
+  EXPECT_EQ(stats.allocs, stats.deallocs);
+  EXPECT_EQ(stats.live_bytes, 0);
+}
+
+TEST(Allocator, Vector_2) {
+  AllocStats stats1, stats2;
+  {
+    typedef s21::vector<std::string, CountingAllocator<std::string>> Vector;
+    Vector my_vec1({"a", "b", "c"}, CountingAllocator<std::string>{&stats1});
+    Vector my_vec2(CountingAllocator<std::string>{&stats2});
+    // аллокаторы не равны и не переезжают: элементы перемещаются поштучно
+    // в память my_vec2
+    my_vec2 = std::move(my_vec1);
+    EXPECT_EQ(my_vec2.size(), 3);
+    EXPECT_EQ(my_vec2[2], "c");
+    EXPECT_EQ(my_vec2.get_allocator().stats, &stats2);
+    EXPECT_EQ(stats2.allocs, 1);
+    my_vec1 = my_vec2;
+    EXPECT_EQ(my_vec1.get_allocator().stats, &stats1);
+    EXPECT_EQ(my_vec1[0], "a");
+  }
+  EXPECT_EQ(stats1.live_bytes, 0);
+  EXPECT_EQ(stats2.live_bytes, 0);
+}
+
+TEST(Allocator, Vector_3) {
+  AllocStats stats1, stats2;
+  {
+    typedef CountingAllocator<int, true> Alloc;
+    s21::vector<int, Alloc> my_vec1({1, 2}, Alloc{&stats1});
+    s21::vector<int, Alloc> my_vec2({3, 4, 5}, Alloc{&stats2});
+    int *data = my_vec1.data();
+    my_vec2 = std::move(my_vec1);
+    EXPECT_EQ(my_vec2.data(), data);
+    EXPECT_EQ(my_vec2.get_allocator().stats, &stats1);
+    EXPECT_EQ(stats2.live_bytes, 0);
+    s21::vector<int, Alloc> my_vec3({6}, Alloc{&stats2});
+    my_vec3.swap(my_vec2);
+    EXPECT_EQ(my_vec3.get_allocator().stats, &stats1);
+    EXPECT_EQ(my_vec2.get_allocator().stats, &stats2);
+    my_vec2 = my_vec3;
+    EXPECT_EQ(my_vec2.get_allocator().stats, &stats1);
+    EXPECT_EQ(my_vec2[1], 2);
+  }
+  EXPECT_EQ(stats1.live_bytes, 0);
+  EXPECT_EQ(stats2.live_bytes, 0);
+}
+
+TEST(Allocator, List_1) {
+  AllocStats stats1, stats2;
+  {
+    typedef CountingAllocator<int> Alloc;
+    s21::list<int, Alloc> my_list({1, 2}, Alloc{&stats1});
+    // только два узла с данными, фиктивный лежит в самом списке
+    EXPECT_EQ(stats1.allocs, 2);
+    s21::list<int, Alloc> empty_list(Alloc{&stats1});
+    EXPECT_EQ(stats1.allocs, 2);
+    my_list.push_front(7);
+    my_list.pop_back();
+    s21::list<int, Alloc> my_list2(Alloc{&stats2});
+    my_list2 = std::move(my_list);
+    EXPECT_EQ(my_list2.front(), 7);
+    EXPECT_EQ(my_list2.back(), 1);
+    EXPECT_EQ(my_list2.get_allocator().stats, &stats2);
+    EXPECT_EQ(stats2.allocs - stats2.deallocs, 2);
+  }
+  EXPECT_EQ(stats1.allocs, stats1.deallocs);
+  EXPECT_EQ(stats2.allocs, stats2.deallocs);
+}
+
+TEST(Allocator, Map_1) {
+  AllocStats stats;
+  {
+    typedef CountingAllocator<std::pair<const int, std::string>> Alloc;
+    s21::map<int, std::string, Alloc> my_map(Alloc{&stats});
+    for (int i = 0; i < 10; ++i) my_map.insert(i, std::to_string(i));
+    EXPECT_EQ(stats.allocs, 11);
+    my_map.erase(my_map.begin());
+    EXPECT_EQ(stats.deallocs, 1);
+    s21::map<int, std::string, Alloc> copy(my_map);
+    EXPECT_EQ(copy.get_allocator().stats, &stats);
+    EXPECT_EQ(copy.at(9), "9");
+  }
+  EXPECT_EQ(stats.allocs, stats.deallocs);
+  EXPECT_EQ(stats.live_bytes, 0);
+}
+
+TEST(Allocator, Map_2) {
+  AllocStats stats;
+  {
+    typedef CountingAllocator<std::pair<const int, int>> Alloc;
+    s21::map<int, int, Alloc> my_map(Alloc{&stats});
+    // пустой map не держит даже фиктивного узла
+    EXPECT_EQ(stats.allocs, 0);
+    EXPECT_FALSE(my_map.contains(1));
+    EXPECT_TRUE(my_map.begin() == my_map.end());
+    my_map.insert(1, 10);
+    my_map.insert(2, 20);
+    EXPECT_EQ(stats.allocs, 3);
+    s21::map<int, int, Alloc> moved(std::move(my_map));
+    EXPECT_EQ(stats.allocs, 3);
+    EXPECT_EQ(moved.at(2), 20);
+    EXPECT_TRUE(my_map.empty());
+    EXPECT_TRUE(my_map.begin() == my_map.end());
+    my_map.clear();
+    my_map[5] = 50;
+    EXPECT_EQ(my_map.at(5), 50);
+  }
+  EXPECT_EQ(stats.allocs, stats.deallocs);
+}
+
+TEST(Allocator, Set_1) {
+  AllocStats stats;
+  {
+    typedef CountingAllocator<int> Alloc;
+    s21::set<int, Alloc> my_set({5, 3, 8, 3}, Alloc{&stats});
+    // три узла и конечный узел
+    EXPECT_EQ(stats.allocs, 4);
+    my_set.erase(my_set.find(3));
+    s21::multiset<int, Alloc> my_multiset({1, 1, 2}, Alloc{&stats});
+    EXPECT_EQ(my_multiset.count(1), 2);
+    s21::multiset<int, Alloc> copy(my_multiset);
+    EXPECT_EQ(copy.size(), 3);
+    EXPECT_EQ(copy.get_allocator().stats, &stats);
+  }
+  EXPECT_EQ(stats.allocs, stats.deallocs);
+  EXPECT_EQ(stats.live_bytes, 0);
+}
+
+TEST(Allocator, Stack_Queue_1) {
+  AllocStats stats;
+  {
+    typedef CountingAllocator<int> Alloc;
+    s21::stack<int, Alloc> my_stack({1, 2, 3}, Alloc{&stats});
+    s21::queue<int, Alloc> my_queue({1, 2, 3}, Alloc{&stats});
+    EXPECT_EQ(stats.allocs, 6);
+    s21::stack<int, Alloc> stack_copy(my_stack);
+    EXPECT_EQ(stack_copy.top(), 3);
+    my_queue.pop();
+    EXPECT_EQ(my_queue.front(), 2);
+    EXPECT_EQ(my_queue.get_allocator().stats, &stats);
+  }
+  EXPECT_EQ(stats.allocs, stats.deallocs);
+  EXPECT_EQ(stats.live_bytes, 0);
+}
+
+TEST(Allocator, Move_Unequal_1) {
+  // неравные аллокаторы без распространения: элементы перемещаются по
+  // одному в узлы аллокатора приёмника
+  AllocStats stats1, stats2;
+  {
+    typedef CountingAllocator<MoveOnly> Alloc;
+    s21::set<MoveOnly, Alloc> src_set(Alloc{&stats1});
+    s21::multiset<MoveOnly, Alloc> src_multiset(Alloc{&stats1});
+    for (int i : {3, 1, 2, 1}) {
+      src_set.insert(MoveOnly(i));
+      src_multiset.insert(MoveOnly(i));
+    }
+    s21::set<MoveOnly, Alloc> my_set(Alloc{&stats2});
+    my_set = std::move(src_set);
+    s21::multiset<MoveOnly, Alloc> my_multiset(Alloc{&stats2});
+    my_multiset = std::move(src_multiset);
+    EXPECT_EQ(stats1.allocs, stats1.deallocs);
+    EXPECT_EQ(src_set.size(), 0);
+    ASSERT_EQ(my_set.size(), 3);
+    ASSERT_EQ(my_multiset.size(), 4);
+    int set_res[] = {1, 2, 3};
+    int multiset_res[] = {1, 1, 2, 3};
+    auto it = my_set.begin();
+    for (int key : set_res) {
+      EXPECT_EQ((*it).key(), key);
+      ++it;
+    }
+    auto multi_it = my_multiset.begin();
+    for (int key : multiset_res) {
+      EXPECT_EQ((*multi_it).key(), key);
+      ++multi_it;
+    }
+  }
+  EXPECT_EQ(stats2.allocs, stats2.deallocs);
+  {
+    typedef std::pair<const int, std::unique_ptr<int>> Value;
+    typedef CountingAllocator<Value> Alloc;
+    s21::map<int, std::unique_ptr<int>, Alloc> src_map(Alloc{&stats1});
+    for (int i = 0; i < 5; ++i) {
+      src_map.insert(Value(i, std::make_unique<int>(i * 10)));
+    }
+    s21::map<int, std::unique_ptr<int>, Alloc> my_map(Alloc{&stats2});
+    my_map = std::move(src_map);
+    EXPECT_TRUE(src_map.empty());
+    ASSERT_EQ(my_map.size(), 5);
+    EXPECT_EQ(*my_map.at(3), 30);
+    EXPECT_EQ(my_map.get_allocator().stats, &stats2);
+  }
+  EXPECT_EQ(stats1.allocs, stats1.deallocs);
+  EXPECT_EQ(stats2.allocs, stats2.deallocs);
+}
+
+TEST(Allocator, Move_Unequal_2) {
+  // поиск места, at и contains сравнивают ключи по ссылке, не копируя их.
+  // При переносе в неравный аллокатор const-ключ каждого элемента
+  // копируется в новый узел один раз, ещё одна копия — ключ фиктивного узла
+  AllocStats stats1, stats2;
+  {
+    typedef std::pair<const CountedKey, int> Value;
+    typedef CountingAllocator<Value> Alloc;
+    s21::map<CountedKey, int, Alloc> src_map(Alloc{&stats1});
+    for (int i : {3, 1, 4, 2, 5}) src_map.insert(Value(CountedKey(i), i * 10));
+    CountedKey present(4), missing(6), duplicate(1);
+    CountedKey::copies = 0;
+    EXPECT_TRUE(src_map.contains(present));
+    EXPECT_FALSE(src_map.contains(missing));
+    EXPECT_EQ(src_map.at(present), 40);
+    EXPECT_THROW(src_map.at(missing), std::out_of_range);
+    EXPECT_FALSE(src_map.insert(duplicate, 0).second);
+    EXPECT_EQ(CountedKey::copies, 1);
+    CountedKey::copies = 0;
+    s21::map<CountedKey, int, Alloc> my_map(Alloc{&stats2});
+    my_map = std::move(src_map);
+    EXPECT_EQ(CountedKey::copies, 5 + 1);
+    EXPECT_TRUE(src_map.empty());
+    ASSERT_EQ(my_map.size(), 5);
+    int key = 1;
+    for (auto it = my_map.begin(); it != my_map.end(); ++it, ++key) {
+      EXPECT_EQ((*it).first.value, key);
+      EXPECT_EQ((*it).second, key * 10);
+    }
+  }
+  EXPECT_EQ(stats1.allocs, stats1.deallocs);
+  EXPECT_EQ(stats2.allocs, stats2.deallocs);
+}
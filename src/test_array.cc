@@ -164,6 +164,42 @@ TEST(Array, Swap_1) {
   }
 }
 
+TEST(Array, Swap_2) {
+  s21::array<int, 3000> my_vec1;
+  s21::array<int, 3000> my_vec2;
+  for (int i = 0; i < 3000; ++i) {
+    my_vec1[i] = i;
+    my_vec2[i] = -i;
+  }
+  my_vec1.swap(my_vec2);
+  for (int i = 0; i < 3000; ++i) {
+    EXPECT_EQ(my_vec1[i], -i);
+    EXPECT_EQ(my_vec2[i], i);
+  }
+}
+
+TEST(Array, Copy_Constructor_2) {
+  s21::array<double, 5> my_vec1{1.5, 2.5, 3.5, 4.5, 5.5};
+  s21::array<double, 5> my_vec2(my_vec1);
+  for (size_t i = 0; i < my_vec1.size(); ++i) {
+    EXPECT_EQ(my_vec1[i], my_vec2[i]);
+  }
+}
+
+TEST(Array, Operator_Equal_1) {
+  s21::array<double, 3> my_array1{1.5, 2.5, 3.5};
+  s21::array<double, 3> my_array2;
+  my_array2 = my_array1;
+  EXPECT_EQ(my_array2[0], 1.5);
+  EXPECT_EQ(my_array2[2], 3.5);
+  s21::array<int, 3> my_array3{1, 2, 3};
+  s21::array<int, 3> my_array4;
+  my_array4 = std::move(my_array3);
+  EXPECT_EQ(my_array4[1], 2);
+  static_assert(std::is_nothrow_move_constructible_v<s21::array<int, 3>>);
+  static_assert(std::is_nothrow_swappable_v<s21::array<int, 3>>);
+}
+
 TEST(Array, Fill_1) {
   s21::array<int, 3> my_vec;
   my_vec.fill(-55);
@@ -0,0 +1,185 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "s21_concurrent_vector.h"
+
+namespace {
+// бросает при копировании строки "bad"; конструктора по умолчанию нет
+struct Fragile {
+  Fragile(const std::string &text) : text(text) {
+    if (text == "bad") throw std::runtime_error("bad");
+  }
+  std::string text;
+};
+
+// аллокатор, который бросает std::bad_alloc, пока поднят fail
+template <typename T>
+struct FailingAllocator {
+  typedef T value_type;
+
+  static inline bool fail = false;
+
+  FailingAllocator() = default;
+  template <typename U>
+  FailingAllocator(const FailingAllocator<U> &) {}
+
+  T *allocate(size_t n) {
+    if (fail) throw std::bad_alloc();
+    return std::allocator<T>().allocate(n);
+  }
+  void deallocate(T *ptr, size_t n) { std::allocator<T>().deallocate(ptr, n); }
+
+  template <typename U>
+  bool operator==(const FailingAllocator<U> &) const {
+    return true;
+  }
+  template <typename U>
+  bool operator!=(const FailingAllocator<U> &) const {
+    return false;
+  }
+};
+}  // namespace
+
+TEST(ConcurrentVector, PushBack_1) {
+  s21::concurrent_vector<int> my_vec;
+  EXPECT_TRUE(my_vec.empty());
+  for (int i = 0; i < 10000; ++i) my_vec.push_back(i);
+  ASSERT_EQ(my_vec.size(), 10000);
+  for (int i = 0; i < 10000; ++i) ASSERT_EQ(my_vec[i], i);
+  EXPECT_EQ(my_vec.front(), 0);
+  EXPECT_EQ(my_vec.back(), 9999);
+  EXPECT_THROW(my_vec.at(10000), std::out_of_range);
+  EXPECT_GE(my_vec.capacity(), 10000);
+  int sum = 0;
+  for (int value : my_vec) sum += value % 3;
+  EXPECT_EQ(sum, 9999);
+  EXPECT_EQ(std::distance(my_vec.begin(), my_vec.end()), 10000);
+  EXPECT_EQ(*std::next(my_vec.begin(), 64), 64);
+  EXPECT_EQ(*--my_vec.end(), 9999);
+}
+
+TEST(ConcurrentVector, Stable_1) {
+  s21::concurrent_vector<std::string> my_vec{"first", "second"};
+  const std::string *first = &my_vec[0];
+  const std::string *second = &my_vec[1];
+  for (int i = 0; i < 5000; ++i) my_vec.emplace_back(30, 'x');
+  EXPECT_EQ(first, &my_vec[0]);
+  EXPECT_EQ(second, &my_vec[1]);
+  EXPECT_EQ(*second, "second");
+  my_vec.clear();
+  EXPECT_TRUE(my_vec.empty());
+  my_vec.push_back("again");
+  EXPECT_EQ(first, &my_vec[0]);
+}
+
+TEST(ConcurrentVector, Threads_1) {
+  constexpr int kThreads = 8;
+  constexpr int kPerThread = 20000;
+  s21::concurrent_vector<int> my_vec;
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreads; ++t) {
+    threads.emplace_back([&my_vec, t] {
+      for (int i = 0; i < kPerThread; ++i) {
+        my_vec.push_back(t * kPerThread + i);
+      }
+    });
+  }
+  for (std::thread &thread : threads) thread.join();
+  ASSERT_EQ(my_vec.size(), size_t(kThreads) * kPerThread);
+  std::vector<int> values(my_vec.begin(), my_vec.end());
+  std::sort(values.begin(), values.end());
+  for (int i = 0; i < kThreads * kPerThread; ++i) ASSERT_EQ(values[i], i);
+}
+
+TEST(ConcurrentVector, Copy_1) {
+  s21::concurrent_vector<std::string> my_vec{"a", "b", "c"};
+  my_vec.reserve(1000);
+  EXPECT_GE(my_vec.capacity(), 1000);
+  s21::concurrent_vector<std::string> copy(my_vec);
+  EXPECT_EQ(copy.size(), 3);
+  EXPECT_EQ(copy[2], "c");
+  s21::concurrent_vector<std::string> moved(std::move(copy));
+  EXPECT_TRUE(copy.empty());
+  EXPECT_EQ(moved[1], "b");
+  copy = moved;
+  EXPECT_EQ(copy[0], "a");
+  moved = std::move(my_vec);
+  EXPECT_EQ(moved.size(), 3);
+  moved.swap(copy);
+  EXPECT_EQ(copy.size(), 3);
+}
+
+TEST(ConcurrentVector, Exception_1) {
+  s21::concurrent_vector<Fragile> my_vec;
+  my_vec.emplace_back(std::string("ok"));
+  EXPECT_THROW(my_vec.emplace_back(std::string("bad")), std::runtime_error);
+  my_vec.push_back(Fragile("last"));
+  ASSERT_EQ(my_vec.size(), 3);
+  EXPECT_TRUE(my_vec.valid(0));
+  EXPECT_FALSE(my_vec.valid(1));
+  EXPECT_TRUE(my_vec.valid(2));
+  EXPECT_FALSE(my_vec.valid(3));
+  EXPECT_THROW(my_vec.at(1), std::out_of_range);
+  std::vector<std::string> texts;
+  for (const Fragile &item : my_vec) texts.push_back(item.text);
+  EXPECT_EQ(texts, std::vector<std::string>({"ok", "last"}));
+  auto it = my_vec.end();
+  EXPECT_EQ((--it)->text, "last");
+  EXPECT_EQ((--it)->text, "ok");
+  EXPECT_TRUE(it == my_vec.begin());
+  s21::concurrent_vector<Fragile> copy(my_vec);
+  EXPECT_EQ(copy.size(), 2);
+  EXPECT_EQ(copy[1].text, "last");
+}
+
+TEST(ConcurrentVector, Exception_2) {
+  typedef FailingAllocator<int> Alloc;
+  s21::concurrent_vector<int, Alloc> my_vec;
+  for (int i = 0; i < 64; ++i) my_vec.push_back(i);
+  Alloc::fail = true;
+  EXPECT_THROW(my_vec.push_back(64), std::bad_alloc);
+  Alloc::fail = false;
+  // сломанный сегмент не выделяется повторно
+  EXPECT_THROW(my_vec.push_back(65), std::bad_alloc);
+  EXPECT_EQ(my_vec.size(), 66);
+  EXPECT_EQ(my_vec.capacity(), 64);
+  EXPECT_FALSE(my_vec.valid(64));
+  EXPECT_THROW(my_vec.at(65), std::out_of_range);
+  Alloc::fail = true;
+  EXPECT_THROW(my_vec.push_back(66), std::bad_alloc);
+  EXPECT_THROW(my_vec.reserve(1000), std::bad_alloc);
+  Alloc::fail = false;
+  EXPECT_EQ(my_vec.size(), 67);
+  my_vec.clear();
+  EXPECT_TRUE(my_vec.empty());
+  my_vec.reserve(1000);
+  EXPECT_GE(my_vec.capacity(), 1000);
+}
+
+TEST(ConcurrentVector, Exception_3) {
+  typedef FailingAllocator<int> Alloc;
+  s21::concurrent_vector<int, Alloc> my_vec;
+  for (int i = 0; i < 64; ++i) my_vec.push_back(i);
+  Alloc::fail = true;
+  EXPECT_THROW(my_vec.push_back(-1), std::bad_alloc);
+  EXPECT_THROW(my_vec.push_back(-1), std::bad_alloc);
+  Alloc::fail = false;
+  // места сломанного сегмента итераторы пропускают
+  int count = 0, sum = 0;
+  for (int value : my_vec) {
+    ++count;
+    sum += value;
+  }
+  EXPECT_EQ(count, 64);
+  EXPECT_EQ(sum, 63 * 64 / 2);
+  const s21::concurrent_vector<int, Alloc> &view = my_vec;
+  auto it = view.end();
+  EXPECT_EQ(*--it, 63);
+  std::vector<int> values(view.begin(), view.end());
+  EXPECT_EQ(values.size(), 64);
+  EXPECT_EQ(values.back(), 63);
+}
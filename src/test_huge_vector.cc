@@ -0,0 +1,71 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <string>
+
+#include "s21_huge_vector.h"
+
+namespace {
+bool IsPageAligned(const void *ptr) {
+  return reinterpret_cast<uintptr_t>(ptr) % 4096 == 0;
+}
+}  // namespace
+
+TEST(HugeVector, Growth_1) {
+  s21::huge_vector<int> my_vec;
+  for (int i = 0; i < 3000000; ++i) my_vec.push_back(i);
+  EXPECT_TRUE(IsPageAligned(my_vec.data()));
+  for (int i = 0; i < 3000000; i += 997) ASSERT_EQ(my_vec[i], i);
+  my_vec.insert(my_vec.begin() + 1, 5000000, -1);
+  EXPECT_EQ(my_vec.size(), 8000000);
+  EXPECT_EQ(my_vec[0], 0);
+  EXPECT_EQ(my_vec[5000000], -1);
+  EXPECT_EQ(my_vec[5000001], 1);
+  EXPECT_EQ(my_vec.back(), 2999999);
+  my_vec.erase(my_vec.begin() + 10, my_vec.end());
+  my_vec.shrink_to_fit();
+  EXPECT_EQ(my_vec.capacity(), 10);
+  EXPECT_EQ(my_vec[9], -1);
+}
+
+TEST(HugeVector, Alias_1) {
+  s21::huge_vector<double> my_vec(s21::mmap_allocator<double>::kHugePage /
+                                      sizeof(double),
+                                  2.5);
+  my_vec[0] = 7.0;
+  ASSERT_EQ(my_vec.size(), my_vec.capacity());
+  my_vec.push_back(my_vec[0]);
+  EXPECT_EQ(my_vec.back(), 7.0);
+  my_vec.emplace_back(my_vec[1]);
+  EXPECT_EQ(my_vec.back(), 2.5);
+  s21::huge_vector<double> copy(my_vec);
+  EXPECT_EQ(copy.size(), my_vec.size());
+  EXPECT_EQ(copy[copy.size() - 2], 7.0);
+}
+
+TEST(HugeVector, Allocator_1) {
+  s21::mmap_allocator<uint64_t> alloc;
+  size_t small = 1000, large = size_t(3) << 20, larger = size_t(40) << 20;
+  uint64_t *ptr = alloc.reallocate(nullptr, 0, small);
+  for (size_t i = 0; i < small; ++i) ptr[i] = i * 3;
+  ptr = alloc.reallocate(ptr, small, large);
+  EXPECT_TRUE(IsPageAligned(ptr));
+  for (size_t i = small; i < large; ++i) ptr[i] = i * 3;
+  ptr = alloc.reallocate(ptr, large, larger);
+  bool same = true;
+  for (size_t i = 0; i < large; ++i) same &= ptr[i] == i * 3;
+  EXPECT_TRUE(same);
+  ptr = alloc.reallocate(ptr, larger, 10);
+  EXPECT_EQ(ptr[9], 27);
+  EXPECT_EQ(alloc.reallocate(ptr, 10, 0), nullptr);
+  EXPECT_THROW((void)alloc.allocate(SIZE_MAX / 4), std::bad_array_new_length);
+}
+
+TEST(HugeVector, Strings_1) {
+  s21::huge_vector<std::string> my_vec{"a", "b"};
+  for (int i = 0; i < 100000; ++i) my_vec.emplace_back(20, 'x');
+  EXPECT_EQ(my_vec[1], "b");
+  EXPECT_EQ(my_vec.back(), std::string(20, 'x'));
+  my_vec.insert(my_vec.begin(), "front");
+  EXPECT_EQ(my_vec[0], "front");
+}
@@ -0,0 +1,256 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <list>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include "s21_intrusive_list.h"
+
+namespace {
+struct Wheel;
+struct Expired;
+
+// состоит сразу в двух списках: колесе таймеров и списке сработавших
+struct Timer : s21::intrusive_list_hook<Wheel>,
+               s21::intrusive_list_hook<Expired> {
+  Timer(int value = 0, int order = 0) : value(value), order(order) {}
+  bool operator<(const Timer &other) const { return value < other.value; }
+  int value;
+  int order;
+};
+
+struct Item : s21::intrusive_list_hook<> {
+  Item(int value = 0) : value(value) {}
+  bool operator<(const Item &other) const { return value < other.value; }
+  int value;
+};
+
+typedef s21::intrusive_list<Item> ItemList;
+
+template <typename List>
+void ExpectListEq(List &actual, const std::list<int> &expected) {
+  ASSERT_EQ(actual.size(), expected.size());
+  auto it = actual.begin();
+  for (int value : expected) {
+    EXPECT_EQ(it->value, value);
+    ++it;
+  }
+  EXPECT_TRUE(it == actual.end());
+  // обратный обход проверяет связи pPrev_
+  for (auto res = expected.rbegin(); res != expected.rend(); ++res) {
+    --it;
+    EXPECT_EQ(it->value, *res);
+  }
+  EXPECT_TRUE(it == actual.begin());
+}
+}  // namespace
+
+TEST(IntrusiveList, Push_1) {
+  std::vector<Item> items{1, 2, 3, 4, 5};
+  ItemList my_list;
+  EXPECT_TRUE(my_list.empty());
+  EXPECT_TRUE(my_list.begin() == my_list.end());
+  for (Item &item : items) {
+    EXPECT_FALSE(item.is_linked());
+    my_list.push_back(item);
+    EXPECT_TRUE(item.is_linked());
+  }
+  ExpectListEq(my_list, {1, 2, 3, 4, 5});
+  EXPECT_EQ(&my_list.front(), &items[0]);
+  EXPECT_EQ(&my_list.back(), &items[4]);
+  EXPECT_THROW(my_list.push_front(items[2]), std::invalid_argument);
+  my_list.pop_front();
+  my_list.pop_back();
+  EXPECT_FALSE(items[0].is_linked());
+  EXPECT_FALSE(items[4].is_linked());
+  my_list.push_front(items[4]);
+  ExpectListEq(my_list, {5, 2, 3, 4});
+  my_list.clear();
+  for (Item &item : items) EXPECT_FALSE(item.is_linked());
+  EXPECT_THROW(my_list.pop_back(), std::invalid_argument);
+}
+
+TEST(IntrusiveList, Erase_1) {
+  std::vector<Item> items;
+  for (int i = 0; i < 10; ++i) items.emplace_back(i);
+  ItemList my_list;
+  for (Item &item : items) my_list.push_back(item);
+  // по самому объекту, без поиска
+  auto next = my_list.erase(items[3]);
+  EXPECT_EQ(next->value, 4);
+  EXPECT_FALSE(items[3].is_linked());
+  next = my_list.erase(my_list.iterator_to(items[9]));
+  EXPECT_TRUE(next == my_list.end());
+  my_list.erase(my_list.begin());
+  ExpectListEq(my_list, {1, 2, 4, 5, 6, 7, 8});
+  EXPECT_THROW(my_list.erase(items[3]), std::invalid_argument);
+  EXPECT_THROW(my_list.erase(my_list.end()), std::invalid_argument);
+  auto inserted = my_list.insert(my_list.iterator_to(items[4]), items[3]);
+  EXPECT_EQ(&*inserted, &items[3]);
+  ExpectListEq(my_list, {1, 2, 3, 4, 5, 6, 7, 8});
+  my_list.clear();
+}
+
+TEST(IntrusiveList, Hook_1) {
+  std::vector<Timer> timers;
+  for (int i = 0; i < 6; ++i) timers.emplace_back(i);
+  s21::intrusive_list<Timer, Wheel> wheel;
+  s21::intrusive_list<Timer, Expired> expired;
+  for (Timer &timer : timers) wheel.push_back(timer);
+  expired.push_back(timers[4]);
+  expired.push_back(timers[1]);
+  // крюки разных тегов независимы
+  EXPECT_TRUE(
+      static_cast<s21::intrusive_list_hook<Expired> &>(timers[1]).is_linked());
+  EXPECT_FALSE(
+      static_cast<s21::intrusive_list_hook<Expired> &>(timers[2]).is_linked());
+  wheel.erase(timers[1]);
+  ExpectListEq(wheel, {0, 2, 3, 4, 5});
+  ExpectListEq(expired, {4, 1});
+  // копия объекта не связана, присваивание не трогает связи
+  Timer copy(timers[2]);
+  EXPECT_FALSE(
+      static_cast<s21::intrusive_list_hook<Wheel> &>(copy).is_linked());
+  timers[3] = copy;
+  ExpectListEq(wheel, {0, 2, 2, 4, 5});
+  expired.clear();
+  wheel.clear();
+}
+
+TEST(IntrusiveList, Move_1) {
+  std::vector<Item> items{1, 2, 3};
+  ItemList first_list;
+  for (Item &item : items) first_list.push_back(item);
+  ItemList second_list(std::move(first_list));
+  EXPECT_TRUE(first_list.empty());
+  ExpectListEq(second_list, {1, 2, 3});
+  Item extra(4);
+  first_list.push_back(extra);
+  first_list = std::move(second_list);
+  EXPECT_FALSE(extra.is_linked());
+  ExpectListEq(first_list, {1, 2, 3});
+  ItemList third_list;
+  third_list.swap(first_list);
+  ExpectListEq(third_list, {1, 2, 3});
+  ExpectListEq(first_list, {});
+  third_list.reverse();
+  ExpectListEq(third_list, {3, 2, 1});
+  {
+    ItemList scoped;
+    scoped.push_back(extra);
+  }
+  // деструктор списка отцепляет объекты
+  EXPECT_FALSE(extra.is_linked());
+  third_list.clear();
+}
+
+TEST(IntrusiveList, Splice_1) {
+  std::vector<Item> items;
+  for (int i = 0; i < 10; ++i) items.emplace_back(i);
+  ItemList first_list;
+  ItemList second_list;
+  for (int i = 0; i < 5; ++i) first_list.push_back(items[i]);
+  for (int i = 5; i < 10; ++i) second_list.push_back(items[i]);
+  first_list.splice(first_list.iterator_to(items[2]), second_list,
+                    second_list.iterator_to(items[7]));
+  ExpectListEq(first_list, {0, 1, 7, 2, 3, 4});
+  ExpectListEq(second_list, {5, 6, 8, 9});
+  first_list.splice(first_list.cend(), second_list,
+                    second_list.iterator_to(items[6]), second_list.cend());
+  ExpectListEq(first_list, {0, 1, 7, 2, 3, 4, 6, 8, 9});
+  ExpectListEq(second_list, {5});
+  first_list.splice(first_list.cbegin(), second_list);
+  EXPECT_TRUE(second_list.empty());
+  ExpectListEq(first_list, {5, 0, 1, 7, 2, 3, 4, 6, 8, 9});
+  // внутри одного списка размер не меняется
+  first_list.splice(first_list.cbegin(), first_list,
+                    first_list.iterator_to(items[2]), first_list.cend());
+  first_list.splice(first_list.cend(), first_list, first_list.begin());
+  ExpectListEq(first_list, {3, 4, 6, 8, 9, 5, 0, 1, 7, 2});
+  first_list.clear();
+}
+
+TEST(IntrusiveList, Sort_1) {
+  std::vector<Timer> timers;
+  std::mt19937 gen(5);
+  for (int i = 0; i < 1000; ++i) {
+    timers.emplace_back(static_cast<int>(gen() % 50), i);
+  }
+  s21::intrusive_list<Timer, Wheel> wheel;
+  for (Timer &timer : timers) wheel.push_back(timer);
+  wheel.sort();
+  std::vector<Timer> res(timers);
+  std::stable_sort(res.begin(), res.end());
+  ASSERT_EQ(wheel.size(), res.size());
+  auto it = wheel.begin();
+  for (const Timer &timer : res) {
+    EXPECT_EQ(it->value, timer.value);
+    EXPECT_EQ(it->order, timer.order);
+    ++it;
+  }
+  EXPECT_TRUE(--it == wheel.iterator_to(wheel.back()));
+  wheel.sort([](const Timer &a, const Timer &b) { return a.order < b.order; });
+  int order = 0;
+  for (auto c_it = wheel.cbegin(); c_it != wheel.cend(); ++c_it) {
+    EXPECT_EQ(c_it->order, order++);
+  }
+  wheel.clear();
+}
+
+TEST(IntrusiveList, Merge_1) {
+  // ключ — десятки, единицы — порядок среди равных
+  std::vector<Item> first_items{10, 20, 21, 40, 41};
+  std::vector<Item> second_items{11, 12, 22, 30, 49};
+  ItemList first_list;
+  ItemList second_list;
+  for (Item &item : first_items) first_list.push_back(item);
+  for (Item &item : second_items) second_list.push_back(item);
+  first_list.merge(second_list, [](const Item &a, const Item &b) {
+    return a.value / 10 < b.value / 10;
+  });
+  EXPECT_TRUE(second_list.empty());
+  ExpectListEq(first_list, {10, 11, 12, 20, 21, 22, 30, 40, 41, 49});
+  Item zero(0);
+  second_list.push_back(zero);
+  first_list.merge(second_list);
+  ExpectListEq(first_list, {0, 10, 11, 12, 20, 21, 22, 30, 40, 41, 49});
+  first_list.clear();
+}
+
+TEST(IntrusiveList, Exception_1) {
+  // сравнение бросает посреди sort и merge: объекты остаются в списке
+  std::vector<Item> first_items;
+  std::vector<Item> second_items;
+  for (int i = 0; i < 500; ++i) {
+    first_items.emplace_back(500 - i);
+    second_items.emplace_back(i * 2);
+  }
+  ItemList first_list;
+  ItemList second_list;
+  for (Item &item : first_items) first_list.push_back(item);
+  for (Item &item : second_items) second_list.push_back(item);
+  int calls = 0;
+  int limit = 1500;
+  auto comp = [&calls, &limit](const Item &a, const Item &b) {
+    if (++calls == limit) throw std::runtime_error("comp");
+    return a < b;
+  };
+  EXPECT_THROW(first_list.sort(comp), std::runtime_error);
+  EXPECT_EQ(first_list.size(), 500);
+  first_list.sort();
+  calls = 0;
+  limit = 300;
+  EXPECT_THROW(first_list.merge(second_list, comp), std::runtime_error);
+  EXPECT_EQ(first_list.size(), 1000);
+  EXPECT_TRUE(second_list.empty());
+  for (const Item &item : second_items) EXPECT_TRUE(item.is_linked());
+  first_list.sort();
+  std::list<int> res;
+  for (const Item &item : first_items) res.push_back(item.value);
+  for (const Item &item : second_items) res.push_back(item.value);
+  res.sort();
+  ExpectListEq(first_list, res);
+  first_list.clear();
+}
@@ -1,9 +1,22 @@
 #include <gtest/gtest.h>
 
 #include <list>
+#include <stdexcept>
+#include <string>
 
 #include "s21_containers.h"
 
+static void ExpectListEq(s21::list<int> &actual,
+                         const std::list<int> &expected) {
+  ASSERT_EQ(actual.size(), expected.size());
+  auto it = actual.begin();
+  for (int value : expected) {
+    EXPECT_EQ(*it, value);
+    ++it;
+  }
+  EXPECT_TRUE(it == actual.end());
+}
+
 TEST(List, Constructor_1) {
   s21::list<int> my_list;
   std::list<int> fact;
@@ -65,6 +78,29 @@ TEST(List, Move_Constructor_1) {
   EXPECT_EQ(ls.size(), 0);
 }
 
+TEST(List, Operator_Equal_1) {
+  s21::list<int> ls{1, 2, 3};
+  s21::list<int> ls2{7, 8};
+  ls2 = ls;
+  ls.push_back(4);
+  EXPECT_EQ(ls2.size(), 3);
+  EXPECT_EQ(ls2.front(), 1);
+  EXPECT_EQ(ls2.back(), 3);
+  EXPECT_EQ(ls.size(), 4);
+}
+
+TEST(List, Operator_Equal_2) {
+  s21::list<int> ls{1, 2, 3};
+  s21::list<int> ls2{7, 8};
+  ls2 = std::move(ls);
+  EXPECT_EQ(ls2.size(), 3);
+  EXPECT_EQ(ls2.front(), 1);
+  EXPECT_EQ(ls2.back(), 3);
+  EXPECT_EQ(ls.size(), 0);
+  ls.push_back(5);
+  EXPECT_EQ(ls.front(), 5);
+}
+
 TEST(List, push_front_1) {
   s21::list<int> my_list;
   std::list<int> fact;
@@ -460,6 +496,44 @@ TEST(List, Merge_5) {
   }
 }
 
+TEST(List, Merge_6) {
+  s21::list<int> first_list{9, 7, 7, 1};
+  s21::list<int> second_list{8, 7, 2, 0};
+  std::list<int> first_list_result{9, 8, 7, 7, 7, 2, 1, 0};
+  first_list.merge(second_list, std::greater<int>());
+  ExpectListEq(first_list, first_list_result);
+  EXPECT_TRUE(second_list.empty());
+  second_list.push_back(5);
+  second_list.push_front(4);
+  ExpectListEq(second_list, std::list<int>{4, 5});
+}
+
+TEST(List, Merge_7) {
+  // равные ключи: сначала элементы первого списка
+  s21::list<int> first_list{10, 20, 21};
+  s21::list<int> second_list{11, 12, 22, 30};
+  std::list<int> first_list_result{10, 11, 12, 20, 21, 22, 30};
+  first_list.merge(second_list, [](int a, int b) { return a / 10 < b / 10; });
+  ExpectListEq(first_list, first_list_result);
+  EXPECT_EQ(first_list.back(), 30);
+}
+
+TEST(List, Merge_8) {
+  s21::list<int> first_list{1, 3, 5, 7};
+  s21::list<int> second_list{2, 4, 6, 8};
+  int calls = 0;
+  auto comp = [&calls](int a, int b) {
+    if (++calls == 4) throw std::runtime_error("comp");
+    return a < b;
+  };
+  EXPECT_THROW(first_list.merge(second_list, comp), std::runtime_error);
+  // все узлы в первом списке, хоть и не по порядку
+  EXPECT_TRUE(second_list.empty());
+  EXPECT_EQ(first_list.size(), 8);
+  first_list.sort();
+  ExpectListEq(first_list, std::list<int>{1, 2, 3, 4, 5, 6, 7, 8});
+}
+
 TEST(List, Splice_1) {
   s21::list<int> first_list{78, -7, 9, 4, 0, 5, 78};
   s21::list<int> second_list{4, 5, 4, 4, 18};
@@ -578,6 +652,81 @@ TEST(List, Splice_5) {
   }
 }
 
+TEST(List, Splice_6) {
+  s21::list<int> first_list{1, 2, 3};
+  s21::list<int> second_list{10, 20, 30};
+  std::list<int> first_list_result{1, 20, 2, 3};
+  std::list<int> second_list_result{10, 30};
+
+  auto pos = first_list.cbegin();
+  ++pos;
+  auto it = second_list.cbegin();
+  ++it;
+  first_list.splice(pos, second_list, it);
+
+  EXPECT_EQ(first_list.size(), 4U);
+  EXPECT_EQ(second_list.size(), 2U);
+  ExpectListEq(first_list, first_list_result);
+  ExpectListEq(second_list, second_list_result);
+}
+
+TEST(List, Splice_7) {
+  s21::list<int> first_list{1, 2};
+  s21::list<int> second_list{10, 20, 30, 40, 50};
+  std::list<int> first_list_result{1, 2, 20, 30, 40};
+  std::list<int> second_list_result{10, 50};
+
+  auto first = second_list.cbegin();
+  ++first;
+  auto last = first;
+  ++last;
+  ++last;
+  ++last;
+  first_list.splice(first_list.cend(), second_list, first, last);
+
+  EXPECT_EQ(first_list.size(), 5U);
+  EXPECT_EQ(second_list.size(), 2U);
+  ExpectListEq(first_list, first_list_result);
+  ExpectListEq(second_list, second_list_result);
+  EXPECT_EQ(first_list.back(), 40);
+  EXPECT_EQ(second_list.back(), 50);
+}
+
+TEST(List, Splice_8) {
+  s21::list<int> my_list{1, 2, 3, 4, 5};
+  std::list<int> my_list_result{4, 5, 1, 2, 3};
+
+  auto first = my_list.cbegin();
+  ++first;
+  ++first;
+  ++first;
+  my_list.splice(my_list.cbegin(), my_list, first, my_list.cend());
+
+  EXPECT_EQ(my_list.size(), 5U);
+  EXPECT_EQ(my_list.front(), 4);
+  EXPECT_EQ(my_list.back(), 3);
+  ExpectListEq(my_list, my_list_result);
+}
+
+TEST(List, Splice_9) {
+  s21::list<int> first_list;
+  s21::list<int> second_list{7};
+
+  first_list.splice(first_list.cbegin(), second_list, second_list.cbegin());
+  EXPECT_TRUE(second_list.empty());
+  EXPECT_EQ(first_list.size(), 1U);
+  EXPECT_EQ(first_list.front(), 7);
+
+  second_list.push_back(8);
+  second_list.push_front(6);
+  first_list.push_front(5);
+  std::list<int> first_list_result{5, 7};
+  std::list<int> second_list_result{6, 8};
+  ExpectListEq(first_list, first_list_result);
+  ExpectListEq(second_list, second_list_result);
+  EXPECT_EQ(second_list.back(), 8);
+}
+
 TEST(List, Insert_front_1) {
   s21::list<int> my_list(8);
   my_list.push_front(123);  // 3
@@ -613,7 +762,7 @@ TEST(List, Swap_1) {
   ++iter;
   EXPECT_EQ(*iter, 66);
   ++iter;
-  EXPECT_EQ(*iter, 4);
+  EXPECT_TRUE(iter == my_list.end());
   ++iter;
   EXPECT_EQ(*iter, 99);
   EXPECT_EQ(my_list.size(), 4);
@@ -624,7 +773,7 @@ TEST(List, Swap_1) {
   ++iter;
   EXPECT_EQ(*iter, 33);
   ++iter;
-  EXPECT_EQ(*iter, 3);
+  EXPECT_TRUE(iter == swap_list.end());
   ++iter;
   EXPECT_EQ(*iter, 11);
   EXPECT_EQ(swap_list.size(), 3);
@@ -641,14 +790,14 @@ TEST(List, Swap_2) {
   ++iter;
   EXPECT_EQ(*iter, 77);
   ++iter;
-  EXPECT_EQ(*iter, 3);
+  EXPECT_TRUE(iter == my_list.end());
   ++iter;
   EXPECT_EQ(*iter, 99);
   EXPECT_EQ(my_list.size(), 3);
   iter = swap_list.begin();
-  EXPECT_EQ(*iter, 0);
+  EXPECT_TRUE(iter == swap_list.end());
   ++iter;
-  EXPECT_EQ(*iter, 0);
+  EXPECT_TRUE(iter == swap_list.end());
   EXPECT_EQ(swap_list.size(), 0);
 }
 
@@ -690,6 +839,65 @@ TEST(List, Sort_1) {
   }
 }
 
+TEST(List, Sort_2) {
+  s21::list<int> my_list;
+  std::list<int> res_list;
+  for (int i = 0; i < 1000; ++i) {
+    int value = (i % 37) * 1000 - i;
+    my_list.push_back(value);
+    res_list.push_back(value);
+  }
+  my_list.sort(std::greater<int>());
+  res_list.sort(std::greater<int>());
+  ExpectListEq(my_list, res_list);
+  EXPECT_EQ(my_list.back(), res_list.back());
+}
+
+TEST(List, Sort_3) {
+  // ключ — десятки, единицы — порядок среди равных
+  s21::list<int> my_list{31, 10, 32, 11, 20, 33, 12, 21};
+  std::list<int> res_list{10, 11, 12, 20, 21, 31, 32, 33};
+  my_list.sort([](int a, int b) { return a / 10 < b / 10; });
+  ExpectListEq(my_list, res_list);
+}
+
+TEST(List, Sort_4) {
+  s21::list<int> my_list;
+  std::list<int> res_list;
+  for (int i = 5000; i > 0; --i) {
+    my_list.push_back(i);
+    res_list.push_front(i);
+  }
+  my_list.sort();
+  ExpectListEq(my_list, res_list);
+  my_list.push_front(0);
+  my_list.pop_back();
+  EXPECT_EQ(my_list.front(), 0);
+  EXPECT_EQ(my_list.back(), 4999);
+}
+
+TEST(List, Sort_5) {
+  // сравнение бросает посреди сортировки: узлы остаются в списке
+  s21::list<int> my_list;
+  std::list<int> res_list;
+  for (int i = 1000; i > 0; --i) {
+    my_list.push_back(i);
+    res_list.push_front(i);
+  }
+  int calls = 0;
+  auto comp = [&calls](int a, int b) {
+    if (++calls == 3000) throw std::runtime_error("comp");
+    return a < b;
+  };
+  EXPECT_THROW(my_list.sort(comp), std::runtime_error);
+  EXPECT_EQ(my_list.size(), 1000);
+  size_t count = 0;
+  for (auto it = my_list.end(); it != my_list.begin(); --it) ++count;
+  EXPECT_EQ(count, 1000);
+  my_list.sort();
+  ExpectListEq(my_list, res_list);
+}
+
 TEST(List, Max_size_1) {
   s21::list<int> my_list{12, 10, 15, 3, 2, 1, 11, 5, 12, 12, 12, 4, 6, 9, 8};
   std::list<int> res_list{12, 10, 15, 3, 2, 1, 11, 5, 12, 12, 12, 4, 6, 9, 8};
@@ -763,3 +971,64 @@ TEST(List, EmplaceFront_1) {
   }
   EXPECT_EQ(my_list1.size(), my_list2.size());
 }
+
+TEST(List, String_1) {
+  s21::list<std::string> my_list{"delta", "alpha", "charlie"};
+  my_list.push_front("bravo");
+  my_list.push_back("alpha");
+  my_list.sort();
+  my_list.unique();
+  std::list<std::string> res_list{"alpha", "bravo", "charlie", "delta"};
+  EXPECT_EQ(my_list.size(), res_list.size());
+  auto it = my_list.begin();
+  for (const std::string &value : res_list) {
+    EXPECT_EQ(*it, value);
+    ++it;
+  }
+  EXPECT_TRUE(it == my_list.end());
+  my_list.reverse();
+  EXPECT_EQ(my_list.front(), "delta");
+  EXPECT_EQ(my_list.back(), "alpha");
+}
+
+TEST(List, String_2) {
+  s21::list<std::string> first_list{"a", "c", "e"};
+  s21::list<std::string> second_list{"b", "d"};
+  s21::list<std::string> copy(first_list);
+  first_list.merge(second_list);
+  EXPECT_EQ(first_list.size(), 5U);
+  EXPECT_TRUE(second_list.empty());
+  second_list.splice(second_list.cend(), first_list, first_list.cbegin());
+  EXPECT_EQ(second_list.front(), "a");
+  EXPECT_EQ(first_list.front(), "b");
+
+  s21::list<std::string> moved(std::move(first_list));
+  EXPECT_TRUE(first_list.empty());
+  EXPECT_TRUE(first_list.begin() == first_list.end());
+  EXPECT_EQ(moved.size(), 4U);
+  moved.swap(copy);
+  EXPECT_EQ(moved.back(), "e");
+  EXPECT_EQ(copy.back(), "e");
+  EXPECT_EQ(copy.size(), 4U);
+  copy.pop_back();
+  copy.pop_front();
+  EXPECT_EQ(copy.front(), "c");
+  EXPECT_EQ(copy.back(), "d");
+}
+
+TEST(List, Sentinel_1) {
+  typedef s21::list<std::string> List;
+  size_t live = s21::node_pool_stats<List>().nodes_live;
+  {
+    List empty_list;
+    List other_list(std::move(empty_list));
+    s21::vector<List> lists(100);
+    EXPECT_EQ(s21::node_pool_stats<List>().nodes_live, live);
+    other_list.push_back("x");
+    EXPECT_EQ(s21::node_pool_stats<List>().nodes_live, live + 1);
+    other_list.swap(empty_list);
+    empty_list.clear();
+    EXPECT_TRUE(empty_list.begin() == empty_list.end());
+  }
+  EXPECT_EQ(s21::node_pool_stats<List>().nodes_live, live);
+}
@@ -157,6 +157,17 @@ TEST(Map, OperatorEqual_2) {
   EXPECT_EQ(my_map2.size(), fact2.size());
 }
 
+TEST(Map, OperatorEqual_3) {
+  s21::map<int, std::string> my_map1{{1, "a"}, {2, "b"}, {3, "c"}};
+  s21::map<int, std::string> my_map2{{10, "x"}};
+  my_map2 = my_map1;
+  my_map1[1] = "z";
+  EXPECT_EQ(my_map2.size(), 3);
+  EXPECT_EQ(my_map2.at(1), "a");
+  EXPECT_EQ(my_map2.at(3), "c");
+  EXPECT_FALSE(my_map2.contains(10));
+}
+
 TEST(Map, MapIterator_1) {
   s21::map<int, int> my_map{{5, 0}, {1, 1},  {99, 2}, {-104, 3},
                             {7, 4}, {19, 5}, {2, 6},  {49, 7}};
@@ -0,0 +1,141 @@
+#include <gtest/gtest.h>
+
+#include <string>
+
+#include "s21_memory_resource.h"
+
+namespace {
+// upstream, который считает блоки, взятые и возвращённые ареной
+class CountingResource : public std::pmr::memory_resource {
+ public:
+  size_t allocs = 0;
+  size_t deallocs = 0;
+
+ protected:
+  void *do_allocate(size_t bytes, size_t alignment) override {
+    ++allocs;
+    return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+  }
+  void do_deallocate(void *ptr, size_t bytes, size_t alignment) override {
+    ++deallocs;
+    std::pmr::new_delete_resource()->deallocate(ptr, bytes, alignment);
+  }
+  bool do_is_equal(const memory_resource &other) const noexcept override {
+    return this == &other;
+  }
+};
+}  // namespace
+
+TEST(MemoryResource, Arena_1) {
+  CountingResource upstream;
+  {
+    s21::monotonic_arena arena(&upstream);
+    EXPECT_EQ(upstream.allocs, 0);
+    void *first = arena.allocate(24, 8);
+    void *second = arena.allocate(24, 8);
+    EXPECT_EQ(static_cast<char *>(second) - static_cast<char *>(first), 24);
+    void *aligned = arena.allocate(1, 64);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(aligned) % 64, 0);
+    EXPECT_EQ(upstream.allocs, 1);
+    EXPECT_EQ(arena.bytes_used(), 49);
+    arena.deallocate(first, 24, 8);
+    EXPECT_EQ(arena.bytes_used(), 49);
+    EXPECT_TRUE(arena.is_equal(arena));
+    EXPECT_FALSE(arena.is_equal(upstream));
+    EXPECT_EQ(arena.upstream_resource(), &upstream);
+  }
+  EXPECT_EQ(upstream.deallocs, 1);
+}
+
+TEST(MemoryResource, Arena_2) {
+  CountingResource upstream;
+  s21::monotonic_arena arena(1024, &upstream);
+  void *small = arena.allocate(16, 8);
+  // крупный запрос получает свой блок, текущий блок продолжает работать
+  (void)arena.allocate(4000, 8);
+  EXPECT_EQ(upstream.allocs, 2);
+  void *next = arena.allocate(16, 8);
+  EXPECT_EQ(static_cast<char *>(next) - static_cast<char *>(small), 16);
+  for (int i = 0; i < 200; ++i) (void)arena.allocate(16, 8);
+  EXPECT_EQ(upstream.allocs, 4);
+  size_t reserved = arena.bytes_reserved();
+  arena.release();
+  // остаётся только последний обычный блок, он вдвое больше предыдущего
+  EXPECT_EQ(upstream.deallocs, 3);
+  EXPECT_EQ(arena.bytes_used(), 0);
+  EXPECT_LT(arena.bytes_reserved(), reserved);
+  EXPECT_EQ(arena.bytes_reserved(), 4096);
+  for (int i = 0; i < 100; ++i) (void)arena.allocate(16, 8);
+  EXPECT_EQ(upstream.allocs, 4);
+}
+
+TEST(MemoryResource, Arena_3) {
+  CountingResource upstream;
+  alignas(std::max_align_t) char buffer[256];
+  s21::monotonic_arena arena(buffer, sizeof(buffer), &upstream);
+  EXPECT_EQ(arena.allocate(100, 1), buffer);
+  (void)arena.allocate(100, 1);
+  EXPECT_EQ(upstream.allocs, 0);
+  (void)arena.allocate(100, 1);
+  EXPECT_EQ(upstream.allocs, 1);
+  arena.release();
+  EXPECT_EQ(upstream.deallocs, 0);
+}
+
+TEST(MemoryResource, Arena_4) {
+  CountingResource upstream;
+  s21::monotonic_arena arena(&upstream);
+  arena.release();
+  alignas(std::max_align_t) char buffer[64];
+  s21::monotonic_arena arena2(buffer, sizeof(buffer), &upstream);
+  arena2.release();
+  EXPECT_EQ(arena2.allocate(8, 8), buffer);
+  EXPECT_EQ(upstream.allocs, 0);
+}
+
+TEST(MemoryResource, Pmr_1) {
+  CountingResource upstream;
+  s21::monotonic_arena arena(&upstream);
+  {
+    s21::pmr::map<int, std::string> my_map(&arena);
+    s21::pmr::list<int> my_list({1, 2, 3}, &arena);
+    s21::pmr::set<int> my_set({3, 1, 2}, &arena);
+    s21::pmr::multiset<int> my_multiset({1, 1}, &arena);
+    s21::pmr::vector<int> my_vec({1, 2}, &arena);
+    s21::pmr::stack<int> my_stack({1, 2}, &arena);
+    s21::pmr::queue<int> my_queue({1, 2}, &arena);
+    for (int i = 0; i < 100; ++i) my_map.insert(i, std::to_string(i));
+    for (int i = 0; i < 100; ++i) my_vec.push_back(i);
+    EXPECT_EQ(my_map.get_allocator().resource(), &arena);
+    EXPECT_EQ(my_list.back(), 3);
+    EXPECT_EQ(my_set.size(), 3);
+    EXPECT_EQ(my_multiset.count(1), 2);
+    EXPECT_EQ(my_vec[101], 99);
+    EXPECT_EQ(my_stack.top(), 2);
+    EXPECT_EQ(my_queue.front(), 1);
+    EXPECT_EQ(my_map.at(42), "42");
+    EXPECT_GT(arena.bytes_used(), 100 * sizeof(std::string));
+    // копия по умолчанию уходит в ресурс по умолчанию
+    s21::pmr::map<int, std::string> copy(my_map);
+    EXPECT_EQ(copy.get_allocator().resource(),
+              std::pmr::get_default_resource());
+    EXPECT_EQ(copy.at(99), "99");
+  }
+  arena.release();
+  EXPECT_EQ(arena.bytes_used(), 0);
+}
+
+TEST(MemoryResource, Pmr_2) {
+  s21::monotonic_arena arena1, arena2;
+  s21::pmr::list<int> my_list1({1, 2, 3}, &arena1);
+  s21::pmr::list<int> my_list2(&arena2);
+  // ресурсы разные, узлы переезжают поштучно в arena2
+  my_list2 = std::move(my_list1);
+  EXPECT_EQ(my_list2.size(), 3);
+  EXPECT_EQ(my_list2.get_allocator().resource(), &arena2);
+  s21::pmr::vector<int> my_vec1({1, 2, 3}, &arena1);
+  s21::pmr::vector<int> my_vec2(&arena1);
+  int *data = my_vec1.data();
+  my_vec2 = std::move(my_vec1);
+  EXPECT_EQ(my_vec2.data(), data);
+}
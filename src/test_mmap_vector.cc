@@ -0,0 +1,116 @@
+#include <gtest/gtest.h>
+#include <unistd.h>
+
+#include <cstdint>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <string>
+
+#include "s21_mmap_vector.h"
+
+namespace {
+// путь к временному файлу, удаляемому в конце теста
+class TempFile {
+ public:
+  explicit TempFile(const std::string &name)
+      : path_(testing::TempDir() + "s21_" + name + "_" +
+              std::to_string(getpid())) {
+    unlink(path_.c_str());
+  }
+  ~TempFile() { unlink(path_.c_str()); }
+  const std::string &path() const { return path_; }
+
+ private:
+  std::string path_;
+};
+
+struct Point {
+  int32_t x;
+  int32_t y;
+};
+}  // namespace
+
+TEST(MmapVector, Persist_1) {
+  TempFile file("persist");
+  {
+    s21::mmap_vector<int64_t> my_vec(file.path());
+    EXPECT_TRUE(my_vec.empty());
+    for (int64_t i = 0; i < 100000; ++i) my_vec.push_back(i * i);
+    my_vec.sync();
+  }
+  s21::mmap_vector<int64_t> my_vec(file.path());
+  ASSERT_EQ(my_vec.size(), 100000);
+  EXPECT_GE(my_vec.capacity(), 100000);
+  for (int64_t i = 0; i < 100000; i += 101) ASSERT_EQ(my_vec[i], i * i);
+  my_vec.shrink_to_fit();
+  EXPECT_EQ(my_vec.capacity(), 100000);
+  my_vec.erase(my_vec.begin() + 10, my_vec.end());
+  my_vec.push_back(-1);
+  EXPECT_EQ(my_vec.back(), -1);
+}
+
+TEST(MmapVector, Modify_1) {
+  TempFile file("modify");
+  s21::mmap_vector<Point> my_vec(file.path());
+  my_vec.insert(my_vec.end(), {{1, 2}, {3, 4}, {5, 6}});
+  my_vec.insert(my_vec.begin() + 1, 2, Point{7, 8});
+  my_vec.emplace(my_vec.begin(), Point{0, 0});
+  ASSERT_EQ(my_vec.size(), 6);
+  EXPECT_EQ(my_vec[0].x, 0);
+  EXPECT_EQ(my_vec[2].y, 8);
+  EXPECT_EQ(my_vec[4].x, 3);
+  my_vec.erase(my_vec.begin() + 2);
+  EXPECT_EQ(my_vec.erase_if([](const Point &p) { return p.x == 7; }), 1);
+  ASSERT_EQ(my_vec.size(), 4);
+  EXPECT_EQ(my_vec.at(1).x, 1);
+  EXPECT_THROW(my_vec.at(4), std::out_of_range);
+  // аргумент из этого же буфера переживает переотображение
+  my_vec.shrink_to_fit();
+  my_vec.push_back(my_vec[1]);
+  EXPECT_EQ(my_vec.back().y, 2);
+  my_vec.pop_back();
+  my_vec.clear();
+  EXPECT_THROW(my_vec.pop_back(), std::invalid_argument);
+}
+
+TEST(MmapVector, Insert_1) {
+  // однопроходный итератор
+  TempFile file("insert");
+  std::istringstream input("2 3");
+  s21::mmap_vector<int32_t> my_vec(file.path());
+  my_vec.insert(my_vec.end(), {1, 4});
+  auto it = my_vec.insert(my_vec.begin() + 1,
+                          std::istream_iterator<int32_t>(input),
+                          std::istream_iterator<int32_t>());
+  EXPECT_EQ(*it, 2);
+  ASSERT_EQ(my_vec.size(), 4);
+  for (int32_t i = 0; i < 4; ++i) EXPECT_EQ(my_vec[i], i + 1);
+}
+
+TEST(MmapVector, Move_1) {
+  TempFile first("move_a"), second("move_b");
+  s21::mmap_vector<float> lhs(first.path());
+  s21::mmap_vector<float> rhs(second.path());
+  lhs.push_back(1.5f);
+  rhs.reserve(1000);
+  lhs.swap(rhs);
+  EXPECT_TRUE(lhs.empty());
+  EXPECT_EQ(lhs.capacity(), 1000);
+  EXPECT_EQ(rhs[0], 1.5f);
+  s21::mmap_vector<float> moved(std::move(rhs));
+  EXPECT_EQ(moved.size(), 1);
+  moved = std::move(lhs);
+  EXPECT_EQ(moved.capacity(), 1000);
+}
+
+TEST(MmapVector, Header_1) {
+  TempFile file("header");
+  { s21::mmap_vector<int32_t> my_vec(file.path()); }
+  EXPECT_THROW(s21::mmap_vector<int64_t>{file.path()}, std::runtime_error);
+  TempFile garbage("garbage");
+  std::ofstream(garbage.path()) << "definitely not a vector";
+  EXPECT_THROW(s21::mmap_vector<int32_t>{garbage.path()}, std::runtime_error);
+  EXPECT_THROW(s21::mmap_vector<int32_t>{"/nonexistent/dir/file"},
+               std::system_error);
+}
@@ -0,0 +1,174 @@
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <vector>
+
+#include "s21_containers.h"
+#include "s21_multiset.h"
+
+namespace {
+// у каждого теста свой тип элемента, чтобы счётчики не смешивались
+struct Tag1 {
+  int value;
+};
+
+// узел map<int, Payload> попадает в класс 240 байт, которым больше никто
+// не пользуется
+struct Payload {
+  char data[200];
+};
+
+// узел list<Blob> попадает в класс 192 байта
+struct Blob {
+  char data[168];
+};
+}  // namespace
+
+TEST(NodePool, Stats_1) {
+  typedef s21::map<int, Tag1> Map;
+  EXPECT_EQ(s21::node_pool_stats<Map>().nodes_live, 0);
+  {
+    Map my_map;
+    for (int i = 0; i < 10; ++i) my_map.insert(i, Tag1{i});
+    // десять узлов и фиктивный
+    s21::PoolStats stats = s21::node_pool_stats<Map>();
+    EXPECT_EQ(stats.nodes_live, 11);
+    size_t hits = stats.free_list_hits;
+    // освобождённый узел сразу уходит следующей вставке
+    my_map.erase(my_map.begin());
+    my_map.insert(100, Tag1{100});
+    stats = s21::node_pool_stats<Map>();
+    EXPECT_EQ(stats.nodes_live, 11);
+    EXPECT_EQ(stats.free_list_hits, hits + 1);
+  }
+  EXPECT_EQ(s21::node_pool_stats<Map>().nodes_live, 0);
+}
+
+TEST(NodePool, Stats_2) {
+  typedef s21::list<long double> List;
+  typedef s21::stack<long double> Stack;
+  {
+    List my_list;
+    for (int i = 0; i < 1000; ++i) my_list.push_back(i);
+    Stack my_stack;
+    my_stack.push(1);
+    EXPECT_EQ(s21::node_pool_stats<List>().nodes_live, 1000);
+    EXPECT_EQ(s21::node_pool_stats<Stack>().nodes_live, 1);
+    for (int i = 0; i < 500; ++i) my_list.pop_front();
+    size_t hits = s21::node_pool_stats<List>().free_list_hits;
+    for (int i = 0; i < 500; ++i) my_list.push_back(i);
+    s21::PoolStats stats = s21::node_pool_stats<List>();
+    EXPECT_EQ(stats.nodes_live, 1000);
+    // часть узлов может прийти из остатка пачки, взятой из слэба
+    EXPECT_GT(stats.free_list_hits - hits, 500 - s21::NodePool::kBatch);
+    EXPECT_LE(stats.free_list_hits - hits, 500);
+  }
+  EXPECT_EQ(s21::node_pool_stats<List>().nodes_live, 0);
+  EXPECT_EQ(s21::node_pool_stats<Stack>().nodes_live, 0);
+}
+
+TEST(NodePool, Slabs_1) {
+  typedef s21::map<int, Payload> Map;
+  {
+    Map my_map;
+    for (int i = 0; i < 600; ++i) my_map.insert(i, Payload());
+    // 601 узел по 240 байт, в слэб 64 КиБ за заголовком помещается 272
+    EXPECT_EQ(s21::node_pool_stats<Map>().slabs_allocated, 3);
+  }
+  Map my_map;
+  for (int i = 0; i < 600; ++i) my_map.insert(i, Payload());
+  s21::PoolStats stats = s21::node_pool_stats<Map>();
+  // новых слэбов нет, узлы пришли из свободных списков и остатка пачки
+  EXPECT_EQ(stats.slabs_allocated, 3);
+  EXPECT_GT(stats.free_list_hits, 601 - s21::NodePool::kBatch);
+}
+
+TEST(NodePool, Release_1) {
+  typedef s21::list<Blob> List;
+  size_t before = s21::NodePool::slabs_in_use();
+  {
+    List my_list;
+    for (int i = 0; i < 20000; ++i) my_list.push_back(Blob());
+    // 20000 узлов по 192 байта — не меньше 58 слэбов
+    EXPECT_GE(s21::NodePool::slabs_in_use(), before + 58);
+  }
+  // в системе остаются слэбы с узлами в кэше потока, запасной и текущий
+  EXPECT_LE(s21::NodePool::slabs_in_use(), before + 4);
+  EXPECT_EQ(s21::node_pool_stats<List>().nodes_live, 0);
+  size_t slabs = s21::node_pool_stats<List>().slabs_allocated;
+  {
+    List my_list;
+    for (int i = 0; i < 100; ++i) my_list.push_back(Blob());
+  }
+  // небольшой список обходится оставшимися слэбами
+  EXPECT_EQ(s21::node_pool_stats<List>().slabs_allocated, slabs);
+}
+
+TEST(NodePool, Stats_3) {
+  typedef s21::set<unsigned short> Set;
+  typedef s21::multiset<unsigned short> Multiset;
+  typedef s21::queue<unsigned short> Queue;
+  {
+    Set my_set({1, 2});
+    Multiset my_multiset({1, 1, 1});
+    Queue my_queue({1, 2});
+    Set my_set2(std::move(my_set));
+    EXPECT_EQ(my_set2.size(), 2);
+    EXPECT_GE(s21::node_pool_stats<Set>().nodes_live, 3);
+    EXPECT_EQ(s21::node_pool_stats<Queue>().nodes_live, 2);
+    my_queue.pop();
+    EXPECT_EQ(s21::node_pool_stats<Queue>().nodes_live, 1);
+  }
+  EXPECT_EQ(s21::node_pool_stats<Set>().nodes_live, 0);
+  EXPECT_EQ(s21::node_pool_stats<Queue>().nodes_live, 0);
+}
+
+TEST(NodePool, Threads_1) {
+  typedef s21::list<long long> List;
+  std::vector<std::thread> threads;
+  // узлы, выделенные в одном потоке, освобождаются в другом
+  std::vector<List> lists(4);
+  for (int t = 0; t < 4; ++t) {
+    threads.emplace_back([&lists, t] {
+      for (int round = 0; round < 50; ++round) {
+        List local;
+        for (int i = 0; i < 100; ++i) local.push_back(i);
+        if (round == 0) lists[t] = std::move(local);
+      }
+    });
+  }
+  for (std::thread &thread : threads) thread.join();
+  // счётчики завершившихся потоков освобождены, их итоги в реестре
+  s21::PoolStats stats = s21::node_pool_stats<List>();
+  EXPECT_EQ(stats.nodes_live, 4 * 100);
+  EXPECT_GT(stats.free_list_hits, 4 * 100 * 40);
+  lists.clear();
+  EXPECT_EQ(s21::node_pool_stats<List>().nodes_live, 0);
+}
+
+TEST(NodePool, Allocator_1) {
+  s21::pool_allocator<int> alloc;
+  s21::pool_allocator<double> other(alloc);
+  EXPECT_TRUE(alloc == other);
+  EXPECT_FALSE(alloc != other);
+  // массивы идут мимо пула и мимо счётчиков
+  int *array = alloc.allocate(10);
+  EXPECT_EQ(s21::pool_allocator<int>::stats().nodes_live, 0);
+  alloc.deallocate(array, 10);
+  int *single = alloc.allocate(1);
+  int *single2 = alloc.allocate(1);
+  EXPECT_EQ(s21::pool_allocator<int>::stats().nodes_live, 2);
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(single) % s21::NodePool::kAlign, 0);
+  EXPECT_NE(single, single2);
+  alloc.deallocate(single2, 1);
+  alloc.deallocate(single, 1);
+  EXPECT_EQ(alloc.allocate(1), single);
+  alloc.deallocate(single, 1);
+  struct Big {
+    char data[1024];
+  };
+  s21::pool_allocator<Big> big;
+  Big *ptr = big.allocate(1);
+  EXPECT_EQ(s21::pool_allocator<Big>::stats().nodes_live, 0);
+  big.deallocate(ptr, 1);
+}
@@ -24,6 +24,20 @@ TEST(Queue, Move_Constructor) {
   EXPECT_EQ(ls2.front(), 10);
 }
 
+TEST(Queue, Operator_Equal) {
+  s21::queue<int> ls{1, 2, 3};
+  s21::queue<int> ls2{9};
+  ls2 = ls;
+  EXPECT_EQ(ls2.size(), 3);
+  EXPECT_EQ(ls2.front(), 1);
+  EXPECT_EQ(ls2.back(), 3);
+  s21::queue<int> ls3;
+  ls3 = std::move(ls2);
+  EXPECT_EQ(ls3.size(), 3);
+  EXPECT_EQ(ls2.size(), 0);
+  EXPECT_EQ(ls3.back(), 3);
+}
+
 TEST(Queue, Push) {
   s21::queue<int> my_queue;
   my_queue.push(8);
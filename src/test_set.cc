@@ -29,6 +29,22 @@ TEST(Set, Copy_Constructor) {
   EXPECT_TRUE(result.empty());
 }
 
+TEST(Set, Operator_Equal) {
+  s21::set<int> st{3, 5, 8};
+  s21::set<int> st2{1, 2};
+  st2 = st;
+  EXPECT_EQ(st2.size(), 3);
+  EXPECT_EQ(*st2.begin(), 3);
+  s21::set<int> st3;
+  st3 = std::move(st2);
+  EXPECT_EQ(st3.size(), 3);
+  EXPECT_EQ(*st3.begin(), 3);
+  EXPECT_EQ(st.size(), 3);
+  s21::set<int> empty;
+  st3 = empty;
+  EXPECT_EQ(st3.size(), 0);
+}
+
 TEST(Set, Move_Constructor) {
   s21::set<int> st{3, 5, 8, 7, 2};
   s21::set<int> result = std::move(st);
@@ -234,6 +250,19 @@ TEST(Multiset, Constructor_Move) {
   EXPECT_TRUE(st2.empty());
 }
 
+TEST(Multiset, Operator_Equal) {
+  s21::multiset<int> st{7, 7, 3};
+  s21::multiset<int> st2{1};
+  st2 = st;
+  EXPECT_EQ(st2.size(), 3);
+  EXPECT_EQ(st2.count(7), 2);
+  s21::multiset<int> st3;
+  st3 = std::move(st2);
+  EXPECT_EQ(st3.size(), 3);
+  EXPECT_EQ(*st3.begin(), 3);
+  static_assert(std::is_nothrow_move_constructible_v<s21::multiset<int>>);
+}
+
 TEST(Multiset, Erase_1) {
   s21::multiset<int> st{7, 7, 3, 1, 1, 5};
   s21::multiset<int>::iterator it = st.begin();
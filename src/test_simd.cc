@@ -0,0 +1,196 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "s21_containers.h"
+#include "s21_containersplus.h"
+#include "s21_simd.h"
+
+namespace {
+// прогоняет проверку на всех доступных наборах инструкций
+template <typename Check>
+void ForEachIsa(Check check) {
+  for (s21::simd::Isa isa : {s21::simd::Isa::kScalar, s21::simd::Isa::kSse2,
+                             s21::simd::Isa::kAvx2}) {
+    s21::simd::set_isa(isa);
+    check();
+  }
+  s21::simd::set_isa(s21::simd::Isa::kAvx2);
+}
+
+// сверяет ядра с std на срезах всех длин и сдвигов до 70 элементов
+template <typename T>
+void CompareWithStd(const std::vector<T> &data) {
+  ForEachIsa([&] {
+    for (size_t first = 0; first < 8 && first <= data.size(); ++first) {
+      for (size_t last = first; last <= data.size(); ++last) {
+        const T *b = data.data() + first;
+        const T *e = data.data() + last;
+        for (size_t i = first; i < last; i += 7) {
+          ASSERT_EQ(s21::simd::find(b, e, data[i]), std::find(b, e, data[i]));
+          ASSERT_EQ(s21::simd::count(b, e, data[i]),
+                    size_t(std::count(b, e, data[i])));
+        }
+        ASSERT_EQ(s21::simd::find(b, e, T(99)), std::find(b, e, T(99)));
+        ASSERT_EQ(s21::simd::min_element(b, e), std::min_element(b, e));
+        ASSERT_EQ(s21::simd::max_element(b, e), std::max_element(b, e));
+        ASSERT_EQ(s21::simd::equal(b, e, b), std::equal(b, e, b));
+      }
+    }
+  });
+}
+
+template <typename T>
+std::vector<T> Pattern(size_t n) {
+  std::vector<T> data(n);
+  for (size_t i = 0; i < n; ++i) data[i] = T((i * 37 + 11) % 23);
+  return data;
+}
+}  // namespace
+
+TEST(Simd, Kernels_1) {
+  CompareWithStd(Pattern<char>(70));
+  CompareWithStd(Pattern<signed char>(70));
+  CompareWithStd(Pattern<unsigned char>(70));
+  CompareWithStd(Pattern<int16_t>(70));
+  CompareWithStd(Pattern<uint16_t>(70));
+  CompareWithStd(Pattern<int32_t>(70));
+  CompareWithStd(Pattern<uint32_t>(70));
+  CompareWithStd(Pattern<int64_t>(70));
+  CompareWithStd(Pattern<uint64_t>(70));
+  CompareWithStd(Pattern<float>(70));
+  CompareWithStd(Pattern<double>(70));
+  CompareWithStd(Pattern<long double>(20));
+}
+
+TEST(Simd, Kernels_2) {
+  std::vector<int8_t> data(100, -128);
+  data[60] = 127;
+  data[99] = -1;
+  CompareWithStd(data);
+  std::vector<uint32_t> big{0xffffffffu, 0, 0x80000000u, 7, 0x7fffffffu};
+  big.resize(40, 0x80000001u);
+  CompareWithStd(big);
+  bool plain[50] = {};
+  plain[45] = true;
+  ForEachIsa([&] {
+    EXPECT_EQ(s21::simd::find(plain, plain + 50, true), plain + 45);
+    EXPECT_EQ(s21::simd::count(plain, plain + 50, false), 49);
+    EXPECT_EQ(s21::simd::max_element(plain, plain + 50), plain + 45);
+  });
+}
+
+TEST(Simd, Count_1) {
+  // больше 255 совпадений в одной байтовой дорожке
+  std::vector<unsigned char> data(100000, 3);
+  data[5] = 4;
+  ForEachIsa([&] {
+    EXPECT_EQ(s21::simd::count(data.data(), data.data() + data.size(), 3),
+              99999);
+  });
+}
+
+TEST(Simd, Count_2) {
+  // дорожки знаковых типов копят больше совпадений, чем их максимум
+  std::vector<int8_t> small(5000, -5);
+  std::vector<int16_t> wide(40000 * 16, 7);
+  small[17] = 5;
+  ForEachIsa([&] {
+    EXPECT_EQ(s21::simd::count(small.data(), small.data() + small.size(),
+                               int8_t(-5)),
+              4999);
+    EXPECT_EQ(
+        s21::simd::count(wide.data(), wide.data() + wide.size(), int16_t(7)),
+        wide.size());
+  });
+}
+
+TEST(Simd, Float_1) {
+  const double nan = std::numeric_limits<double>::quiet_NaN();
+  std::vector<double> data(40, 1.0);
+  data[3] = nan;
+  data[17] = -0.0;
+  data[20] = 0.0;
+  data[33] = -5.0;
+  data[34] = 8.0;
+  CompareWithStd(data);
+  data[0] = nan;
+  CompareWithStd(data);
+  ForEachIsa([&] {
+    double *b = data.data(), *e = b + data.size();
+    EXPECT_EQ(s21::simd::find(b, e, nan), e);
+    EXPECT_EQ(s21::simd::find(b, e, 0.0), b + 17);
+    EXPECT_EQ(s21::simd::count(b, e, -0.0), 2);
+    EXPECT_FALSE(s21::simd::equal(b, e, b));
+    EXPECT_EQ(s21::simd::min_element(b, e), b);
+  });
+}
+
+TEST(Simd, Equal_1) {
+  ForEachIsa([] {
+    for (size_t n = 0; n < 80; ++n) {
+      std::vector<float> lhs(n, 2.5f), rhs(n, 2.5f);
+      ASSERT_TRUE(s21::simd::equal(lhs.data(), lhs.data() + n, rhs.data()));
+      for (size_t i = 0; i < n; ++i) {
+        rhs[i] = 3.0f;
+        ASSERT_FALSE(
+            s21::simd::equal(lhs.data(), lhs.data() + n, rhs.data()));
+        rhs[i] = 2.5f;
+      }
+    }
+  });
+}
+
+TEST(Simd, Fill_1) {
+  ForEachIsa([] {
+    for (size_t n = 0; n < 80; ++n) {
+      std::vector<int16_t> data(n + 2, 7);
+      s21::simd::fill(data.data() + 1, data.data() + 1 + n, int16_t(-3));
+      ASSERT_EQ(data.front(), 7);
+      ASSERT_EQ(data.back(), 7);
+      ASSERT_EQ(std::count(data.begin(), data.end(), -3), long(n));
+    }
+  });
+  std::string words[3];
+  s21::simd::fill(words, words + 3, std::string("ab"));
+  EXPECT_EQ(words[2], "ab");
+}
+
+TEST(Simd, Containers_1) {
+  s21::vector<int> my_vec{5, 3, 9, 3, -1, 9};
+  EXPECT_EQ(s21::simd::find(my_vec, 9) - my_vec.begin(), 2);
+  EXPECT_EQ(s21::simd::find(my_vec, 42), my_vec.end());
+  EXPECT_EQ(s21::simd::count(my_vec, 3), 2);
+  EXPECT_EQ(*s21::simd::min_element(my_vec), -1);
+  EXPECT_EQ(s21::simd::max_element(my_vec) - my_vec.begin(), 2);
+  s21::vector<int> copy(my_vec);
+  EXPECT_TRUE(s21::simd::equal(my_vec, copy));
+  copy.push_back(0);
+  EXPECT_FALSE(s21::simd::equal(my_vec, copy));
+  s21::simd::fill(my_vec, 4);
+  EXPECT_EQ(s21::simd::count(my_vec, 4), 6);
+
+  s21::array<double, 5> my_array{1.5, 0.5, 2.5, 0.5, 3.0};
+  EXPECT_EQ(s21::simd::min_element(my_array), my_array.begin() + 1);
+  EXPECT_EQ(s21::simd::find(my_array, 3.0), my_array.begin() + 4);
+  s21::aligned_vector<float> aligned(100, 1.0f);
+  EXPECT_EQ(s21::simd::count(aligned, 1.0f), 100);
+  s21::small_vector<short, 4> small{1, 2, 3};
+  EXPECT_EQ(*s21::simd::max_element(small), 3);
+}
+
+TEST(Simd, Members_1) {
+  s21::array<int, 37> my_array;
+  my_array.fill(-7);
+  EXPECT_EQ(std::count(my_array.begin(), my_array.end(), -7), 37);
+  s21::vector<uint8_t> my_vec(1000, 200);
+  EXPECT_EQ(my_vec.size(), 1000);
+  EXPECT_EQ(std::count(my_vec.begin(), my_vec.end(), 200), 1000);
+  s21::vector<std::string> strings(3, "x");
+  EXPECT_EQ(strings[2], "x");
+}
@@ -0,0 +1,226 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <iterator>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "s21_small_vector.h"
+
+namespace {
+// лежит ли буфер вектора внутри самого объекта
+template <typename Vector>
+bool IsInline(Vector &vec) {
+  const char *data = reinterpret_cast<const char *>(vec.data());
+  const char *self = reinterpret_cast<const char *>(&vec);
+  return data >= self && data < self + sizeof(vec);
+}
+
+// копия бросает, когда разрешённые копии кончатся, конструктор — на
+// отрицательном числе. Перемещение не noexcept, поэтому перенос при росте
+// тоже копирует
+struct Brittle {
+  static inline int copies_left = 0;
+  explicit Brittle(int value) : value(std::to_string(value)) {
+    if (value < 0) throw std::invalid_argument("negative");
+  }
+  Brittle(const Brittle &other) : value(other.value) {
+    if (copies_left-- == 0) throw std::runtime_error("copy");
+  }
+  Brittle(Brittle &&other) : value(std::move(other.value)) {}
+  Brittle &operator=(const Brittle &other) = default;
+  Brittle &operator=(Brittle &&other) = default;
+  std::string value;
+};
+}  // namespace
+
+TEST(SmallVector, Constructor_1) {
+  s21::small_vector<int, 8> my_vec;
+  EXPECT_EQ(my_vec.size(), 0);
+  EXPECT_EQ(my_vec.capacity(), 8);
+  EXPECT_TRUE(my_vec.empty());
+  EXPECT_TRUE(IsInline(my_vec));
+}
+
+TEST(SmallVector, Constructor_2) {
+  s21::small_vector<double, 4> my_vec(3, -5.65);
+  EXPECT_EQ(my_vec.size(), 3);
+  EXPECT_EQ(my_vec[2], -5.65);
+  EXPECT_TRUE(IsInline(my_vec));
+  s21::small_vector<int, 4> my_vec2(10);
+  EXPECT_EQ(my_vec2.size(), 10);
+  EXPECT_EQ(my_vec2[9], 0);
+  EXPECT_FALSE(IsInline(my_vec2));
+}
+
+TEST(SmallVector, Constructor_3) {
+  s21::small_vector<int, 4> my_vec{1, 2, 3, 4, 5, 6};
+  std::vector<int> fact{1, 2, 3, 4, 5, 6};
+  EXPECT_EQ(my_vec.size(), fact.size());
+  for (size_t i = 0; i < fact.size(); ++i) EXPECT_EQ(my_vec[i], fact[i]);
+}
+
+TEST(SmallVector, Push_back_1) {
+  s21::small_vector<int, 4> my_vec;
+  for (int i = 0; i < 4; ++i) my_vec.push_back(i);
+  EXPECT_TRUE(IsInline(my_vec));
+  EXPECT_EQ(my_vec.capacity(), 4);
+  my_vec.push_back(4);
+  EXPECT_FALSE(IsInline(my_vec));
+  EXPECT_EQ(my_vec.capacity(), 8);
+  for (int i = 0; i < 5; ++i) EXPECT_EQ(my_vec[i], i);
+  EXPECT_EQ(my_vec.back(), 4);
+}
+
+TEST(SmallVector, Push_back_2) {
+  s21::small_vector<std::string, 2> my_vec;
+  for (int i = 0; i < 100; ++i) my_vec.push_back(std::to_string(i));
+  EXPECT_EQ(my_vec.size(), 100);
+  EXPECT_EQ(my_vec[57], "57");
+  my_vec.pop_back();
+  EXPECT_EQ(my_vec.back(), "98");
+}
+
+TEST(SmallVector, Emplace_1) {
+  s21::small_vector<std::string, 4> my_vec{"abc", "de"};
+  my_vec.emplace_back(3, 'x');
+  auto it = my_vec.emplace(my_vec.begin() + 1, my_vec[0], 1);
+  EXPECT_EQ(*it, "bc");
+  my_vec.emplace(my_vec.end(), "end");
+  EXPECT_EQ(my_vec.size(), 5);
+  EXPECT_EQ(my_vec[0], "abc");
+  EXPECT_EQ(my_vec[2], "de");
+  EXPECT_EQ(my_vec[3], "xxx");
+  EXPECT_EQ(my_vec[4], "end");
+}
+
+TEST(SmallVector, Insert_1) {
+  s21::small_vector<int, 4> my_vec{1, 5};
+  std::vector<int> fact{1, 5};
+  int src[] = {2, 3, 4};
+  my_vec.insert(my_vec.begin() + 1, src, src + 3);
+  fact.insert(fact.begin() + 1, src, src + 3);
+  my_vec.insert(my_vec.begin(), 2, 0);
+  fact.insert(fact.begin(), 2, 0);
+  my_vec.insert(my_vec.end(), {6, 7});
+  fact.insert(fact.end(), {6, 7});
+  EXPECT_EQ(my_vec.size(), fact.size());
+  for (size_t i = 0; i < fact.size(); ++i) EXPECT_EQ(my_vec[i], fact[i]);
+}
+
+TEST(SmallVector, Insert_2) {
+  // однопроходный итератор, вставка переносит элементы в кучу
+  std::istringstream input("2 3 4 5");
+  s21::small_vector<int, 4> my_vec{1, 6};
+  auto it = my_vec.insert(my_vec.begin() + 1, std::istream_iterator<int>(input),
+                          std::istream_iterator<int>());
+  EXPECT_EQ(*it, 2);
+  std::vector<int> fact{1, 2, 3, 4, 5, 6};
+  EXPECT_EQ(my_vec.size(), fact.size());
+  for (size_t i = 0; i < fact.size(); ++i) EXPECT_EQ(my_vec[i], fact[i]);
+}
+
+TEST(SmallVector, Erase_1) {
+  s21::small_vector<int, 8> my_vec{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+  my_vec.erase(my_vec.begin());
+  auto it = my_vec.erase(my_vec.begin() + 2, my_vec.begin() + 4);
+  EXPECT_EQ(*it, 5);
+  EXPECT_EQ(my_vec.erase_if([](int x) { return x % 2; }), 4);
+  std::vector<int> fact{2, 6, 8};
+  EXPECT_EQ(my_vec.size(), fact.size());
+  for (size_t i = 0; i < fact.size(); ++i) EXPECT_EQ(my_vec[i], fact[i]);
+}
+
+TEST(SmallVector, Shrink_to_fit_1) {
+  s21::small_vector<int, 4> my_vec{1, 2, 3, 4, 5, 6};
+  EXPECT_FALSE(IsInline(my_vec));
+  my_vec.pop_back();
+  my_vec.pop_back();
+  my_vec.shrink_to_fit();
+  EXPECT_TRUE(IsInline(my_vec));
+  EXPECT_EQ(my_vec.capacity(), 4);
+  EXPECT_EQ(my_vec[3], 4);
+  my_vec.reserve(2);
+  EXPECT_EQ(my_vec.capacity(), 4);
+}
+
+TEST(SmallVector, Copy_1) {
+  s21::small_vector<std::string, 2> my_vec{"a", "b"};
+  s21::small_vector<std::string, 2> my_vec2(my_vec);
+  EXPECT_TRUE(IsInline(my_vec2));
+  EXPECT_EQ(my_vec2[1], "b");
+  my_vec.push_back("c");
+  my_vec2 = my_vec;
+  EXPECT_EQ(my_vec2.size(), 3);
+  EXPECT_EQ(my_vec2[2], "c");
+  EXPECT_NE(my_vec2.data(), my_vec.data());
+}
+
+TEST(SmallVector, Move_1) {
+  s21::small_vector<std::string, 2> inline_vec{"a"};
+  s21::small_vector<std::string, 2> moved(std::move(inline_vec));
+  EXPECT_TRUE(IsInline(moved));
+  EXPECT_EQ(moved[0], "a");
+  EXPECT_EQ(inline_vec.size(), 0);
+  s21::small_vector<std::string, 2> heap_vec{"x", "y", "z"};
+  std::string *data = heap_vec.data();
+  moved = std::move(heap_vec);
+  EXPECT_EQ(moved.data(), data);
+  EXPECT_EQ(moved.size(), 3);
+  EXPECT_TRUE(IsInline(heap_vec));
+  EXPECT_EQ(heap_vec.capacity(), 2);
+  static_assert(
+      std::is_nothrow_move_constructible_v<s21::small_vector<int, 4>>);
+}
+
+TEST(SmallVector, Swap_1) {
+  s21::small_vector<int, 2> my_vec1{1};
+  s21::small_vector<int, 2> my_vec2{5, 6, 7};
+  my_vec1.swap(my_vec2);
+  EXPECT_EQ(my_vec1.size(), 3);
+  EXPECT_EQ(my_vec1[2], 7);
+  EXPECT_EQ(my_vec2.size(), 1);
+  EXPECT_EQ(my_vec2[0], 1);
+  EXPECT_TRUE(IsInline(my_vec2));
+  s21::small_vector<int, 2> my_vec3{8, 9, 10, 11};
+  int *data = my_vec3.data();
+  my_vec1.swap(my_vec3);
+  EXPECT_EQ(my_vec1.data(), data);
+  EXPECT_EQ(my_vec3[0], 5);
+}
+
+TEST(SmallVector, Iterator_1) {
+  s21::small_vector<int, 4> my_vec{4, 1, 3, 2, 5};
+  std::sort(my_vec.begin(), my_vec.end());
+  int expected = 1;
+  for (const int &val : my_vec) EXPECT_EQ(val, expected++);
+  const auto &const_vec = my_vec;
+  EXPECT_EQ(const_vec.end() - const_vec.begin(), 5);
+  EXPECT_EQ(*(my_vec.cend() - 1), 5);
+  EXPECT_THROW(my_vec.at(5), std::out_of_range);
+}
+
+TEST(SmallVector, Exception_1) {
+  // неудачная вставка любым путём оставляет вектор прежним
+  Brittle::copies_left = 1000;
+  s21::small_vector<Brittle, 4> my_vec;
+  for (int i = 0; i < 3; ++i) my_vec.emplace_back(i);
+  Brittle value(7);
+  // копия value и первый элемент, второй бросает посреди промежутка
+  Brittle::copies_left = 2;
+  EXPECT_THROW(my_vec.insert(my_vec.begin() + 1, 2, value),
+               std::runtime_error);
+  // рост: копия value и перенос my_vec[0], my_vec[1] бросает
+  Brittle::copies_left = 2;
+  EXPECT_THROW(my_vec.insert(my_vec.begin() + 1, 3, value),
+               std::runtime_error);
+  Brittle::copies_left = 1000;
+  std::istringstream input("5 6 -1");
+  EXPECT_THROW(my_vec.insert(my_vec.begin(), std::istream_iterator<int>(input),
+                             std::istream_iterator<int>()),
+               std::invalid_argument);
+  ASSERT_EQ(my_vec.size(), 3);
+  for (int i = 0; i < 3; ++i) EXPECT_EQ(my_vec[i].value, std::to_string(i));
+}
@@ -0,0 +1,99 @@
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <string>
+
+#include "s21_simd.h"
+#include "s21_soa_vector.h"
+
+namespace {
+// бросает при создании из отрицательного числа
+struct Picky {
+  Picky(int value) : value(value) {
+    if (value < 0) throw std::invalid_argument("negative");
+  }
+  int value;
+};
+}  // namespace
+
+TEST(SoaVector, PushBack_1) {
+  s21::soa_vector<int, double, std::string> my_soa;
+  for (int i = 0; i < 1000; ++i) {
+    my_soa.emplace_back(i, i * 0.5, std::to_string(i));
+  }
+  my_soa.push_back({-1, -0.5, "last"});
+  ASSERT_EQ(my_soa.size(), 1001);
+  EXPECT_GE(my_soa.capacity(), 1001);
+  auto [id, price, name] = my_soa[500];
+  EXPECT_EQ(id, 500);
+  EXPECT_EQ(price, 250.0);
+  EXPECT_EQ(name, "500");
+  std::get<2>(my_soa.back()) += "!";
+  EXPECT_EQ(std::get<2>(my_soa[1000]), "last!");
+  EXPECT_EQ(std::get<0>(my_soa.front()), 0);
+  EXPECT_THROW(my_soa.at(1001), std::out_of_range);
+  my_soa.pop_back();
+  EXPECT_EQ(my_soa.size(), 1000);
+  my_soa.shrink_to_fit();
+  EXPECT_EQ(my_soa.capacity(), 1000);
+  // строка этого же вектора переживает рост столбцов
+  my_soa.push_back(my_soa[3]);
+  EXPECT_EQ(std::get<2>(my_soa.back()), "3");
+  my_soa.clear();
+  EXPECT_TRUE(my_soa.empty());
+  EXPECT_THROW(my_soa.pop_back(), std::invalid_argument);
+}
+
+TEST(SoaVector, Column_1) {
+  s21::soa_vector<int32_t, float> my_soa{{1, 1.5f}, {2, 2.5f}, {3, 0.5f}};
+  s21::column_span<int32_t> ids = my_soa.column<0>();
+  ASSERT_EQ(ids.size(), 3);
+  for (int32_t &id : ids) id *= 10;
+  EXPECT_EQ(std::get<0>(my_soa[2]), 30);
+  s21::column_span<float> prices = my_soa.column<1>();
+  EXPECT_EQ(s21::simd::min_element(prices) - prices.begin(), 2);
+  EXPECT_EQ(s21::simd::count(ids, 20), 1);
+  const auto &view = my_soa;
+  s21::column_span<const float> const_prices = view.column<1>();
+  EXPECT_EQ(*s21::simd::max_element(const_prices), 2.5f);
+  EXPECT_EQ(s21::simd::find(const_prices, 1.5f), const_prices.begin());
+}
+
+TEST(SoaVector, Iterator_1) {
+  s21::soa_vector<int, char> my_soa{{1, 'a'}, {2, 'b'}, {3, 'c'}};
+  for (auto [number, letter] : my_soa) {
+    number *= 2;
+    ++letter;
+  }
+  EXPECT_EQ(std::get<0>(my_soa[2]), 6);
+  EXPECT_EQ(std::get<1>(my_soa[0]), 'b');
+  s21::soa_vector<int, char>::iterator it = my_soa.begin();
+  s21::soa_vector<int, char>::const_iterator last = my_soa.cend();
+  EXPECT_EQ(last - it, 3);
+  EXPECT_EQ(std::get<0>(it[1]), 4);
+  it += 2;
+  EXPECT_TRUE(it < last);
+  EXPECT_EQ(std::get<1>(*it--), 'd');
+  EXPECT_EQ(std::get<0>(*(1 + it)), 6);
+  int sum = 0;
+  const auto &view = my_soa;
+  for (auto [number, letter] : view) sum += number + (letter - 'a');
+  EXPECT_EQ(sum, 12 + 1 + 2 + 3);
+}
+
+TEST(SoaVector, Rollback_1) {
+  s21::soa_vector<std::string, Picky, int> my_soa;
+  my_soa.emplace_back("a", 1, 1);
+  EXPECT_THROW(my_soa.emplace_back("b", -1, 2), std::invalid_argument);
+  EXPECT_EQ(my_soa.size(), 1);
+  EXPECT_EQ(my_soa.column<0>().size(), 1);
+  my_soa.reserve(10);
+  EXPECT_THROW(my_soa.emplace_back("c", -1, 3), std::invalid_argument);
+  EXPECT_EQ(my_soa.size(), 1);
+  my_soa.emplace_back("d", 4, 4);
+  EXPECT_EQ(std::get<0>(my_soa[1]), "d");
+  s21::soa_vector<std::string, Picky, int> other;
+  other.swap(my_soa);
+  EXPECT_EQ(other.size(), 2);
+  EXPECT_TRUE(my_soa.empty());
+}
@@ -84,6 +84,19 @@ TEST(Stack, Ravno) {
   EXPECT_TRUE(st2->empty());
 }
 
+TEST(Stack, Operator_Equal) {
+  s21::stack<int> st{1, 2, 3};
+  s21::stack<int> st2{9};
+  st2 = st;
+  EXPECT_EQ(st2.size(), 3);
+  EXPECT_EQ(st2.top(), 3);
+  s21::stack<int> st3;
+  st3 = std::move(st2);
+  EXPECT_EQ(st3.size(), 3);
+  EXPECT_EQ(st2.size(), 0);
+  EXPECT_EQ(st3.top(), 3);
+}
+
 TEST(Stack, Emplace) {
   s21::stack<int> my_queue{1, 8, 7};
   my_queue.emplace_back(11);
@@ -0,0 +1,178 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "s21_static_vector.h"
+
+namespace {
+constexpr int ConstexprSum() {
+  s21::static_vector<int, 8> vec{1, 2, 3};
+  vec.push_back(4);
+  vec.insert(vec.begin(), 10);
+  vec.erase(vec.begin() + 1);
+  vec.erase_if([](int x) { return x == 3; });
+  vec.emplace(vec.begin() + 1, 5);
+  int sum = 0;
+  for (int x : vec) sum += x;
+  return sum;
+}
+}  // namespace
+
+TEST(StaticVector, Constructor_1) {
+  s21::static_vector<int, 8> my_vec;
+  EXPECT_EQ(my_vec.size(), 0);
+  EXPECT_EQ(my_vec.capacity(), 8);
+  EXPECT_EQ(my_vec.max_size(), 8);
+  EXPECT_TRUE(my_vec.empty());
+  s21::static_vector<double, 4> my_vec2(3, -5.65);
+  EXPECT_EQ(my_vec2.size(), 3);
+  EXPECT_EQ(my_vec2[2], -5.65);
+  s21::static_vector<std::string, 4> my_vec3(2);
+  EXPECT_EQ(my_vec3.size(), 2);
+  EXPECT_EQ(my_vec3[1], "");
+}
+
+TEST(StaticVector, Constructor_2) {
+  s21::static_vector<std::string, 4> my_vec{"a", "b", "c"};
+  EXPECT_EQ(my_vec.size(), 3);
+  EXPECT_EQ(my_vec.front(), "a");
+  EXPECT_EQ(my_vec.back(), "c");
+  EXPECT_THROW((s21::static_vector<int, 2>{1, 2, 3}), std::length_error);
+}
+
+TEST(StaticVector, Trivial_1) {
+  static_assert(std::is_trivially_copyable_v<s21::static_vector<int, 8>>);
+  static_assert(!std::is_trivially_copyable_v<
+                s21::static_vector<std::string, 8>>);
+  static_assert(ConstexprSum() == 21);
+  constexpr s21::static_vector<int, 4> my_vec{5, 6};
+  static_assert(my_vec.end() - my_vec.begin() == 2);
+  static_assert(*my_vec.cbegin() == 5);
+}
+
+TEST(StaticVector, Push_back_1) {
+  s21::static_vector<std::string, 3> my_vec;
+  my_vec.push_back("a");
+  std::string b = "b";
+  my_vec.push_back(b);
+  EXPECT_EQ(my_vec.emplace_back(2, 'c'), "cc");
+  EXPECT_THROW(my_vec.push_back("d"), std::length_error);
+  EXPECT_EQ(my_vec.size(), 3);
+  my_vec.pop_back();
+  EXPECT_EQ(my_vec.back(), "b");
+  my_vec.clear();
+  EXPECT_THROW(my_vec.pop_back(), std::invalid_argument);
+}
+
+TEST(StaticVector, Insert_1) {
+  s21::static_vector<int, 8> my_vec{1, 5};
+  std::vector<int> fact{1, 5};
+  int src[] = {2, 3, 4};
+  my_vec.insert(my_vec.begin() + 1, src, src + 3);
+  fact.insert(fact.begin() + 1, src, src + 3);
+  my_vec.insert(my_vec.begin(), 2, 0);
+  fact.insert(fact.begin(), 2, 0);
+  my_vec.insert(my_vec.end(), 7);
+  fact.insert(fact.end(), 7);
+  EXPECT_EQ(my_vec.size(), fact.size());
+  for (size_t i = 0; i < fact.size(); ++i) EXPECT_EQ(my_vec[i], fact[i]);
+  EXPECT_THROW(my_vec.insert(my_vec.begin(), {1, 2}), std::length_error);
+  EXPECT_EQ(my_vec.size(), 8);
+}
+
+TEST(StaticVector, Insert_2) {
+  s21::static_vector<std::string, 8> my_vec{"abc", "de"};
+  auto it = my_vec.emplace(my_vec.begin() + 1, my_vec[0], 1);
+  EXPECT_EQ(*it, "bc");
+  my_vec.insert(my_vec.begin(), my_vec[2]);
+  std::vector<std::string> fact{"de", "abc", "bc", "de"};
+  EXPECT_EQ(my_vec.size(), fact.size());
+  for (size_t i = 0; i < fact.size(); ++i) EXPECT_EQ(my_vec[i], fact[i]);
+}
+
+TEST(StaticVector, Insert_3) {
+  std::istringstream input("b c");
+  s21::static_vector<std::string, 8> my_vec{"a", "d"};
+  auto it = my_vec.insert(my_vec.begin() + 1,
+                          std::istream_iterator<std::string>(input),
+                          std::istream_iterator<std::string>());
+  EXPECT_EQ(*it, "b");
+  std::vector<std::string> fact{"a", "b", "c", "d"};
+  EXPECT_EQ(my_vec.size(), fact.size());
+  for (size_t i = 0; i < fact.size(); ++i) EXPECT_EQ(my_vec[i], fact[i]);
+  // не влезший однопроходный диапазон не оставляет следов
+  std::istringstream numbers("3 4 5");
+  s21::static_vector<int, 4> my_ints{1, 2};
+  EXPECT_THROW(my_ints.insert(my_ints.begin(),
+                              std::istream_iterator<int>(numbers),
+                              std::istream_iterator<int>()),
+               std::length_error);
+  EXPECT_EQ(my_ints.size(), 2);
+  EXPECT_EQ(my_ints[0], 1);
+  EXPECT_EQ(my_ints[1], 2);
+}
+
+TEST(StaticVector, Erase_1) {
+  s21::static_vector<std::string, 8> my_vec{"0", "1", "2", "3", "4", "5"};
+  my_vec.erase(my_vec.begin());
+  auto it = my_vec.erase(my_vec.begin() + 1, my_vec.begin() + 3);
+  EXPECT_EQ(*it, "4");
+  EXPECT_EQ(my_vec.erase_if([](const std::string &s) { return s == "5"; }),
+            1);
+  std::vector<std::string> fact{"1", "4"};
+  EXPECT_EQ(my_vec.size(), fact.size());
+  for (size_t i = 0; i < fact.size(); ++i) EXPECT_EQ(my_vec[i], fact[i]);
+}
+
+TEST(StaticVector, Copy_1) {
+  s21::static_vector<std::string, 4> my_vec{"a", "b", "c"};
+  s21::static_vector<std::string, 4> my_vec2(my_vec);
+  EXPECT_EQ(my_vec2.size(), 3);
+  EXPECT_EQ(my_vec2[2], "c");
+  s21::static_vector<std::string, 4> my_vec3{"x"};
+  my_vec3 = my_vec;
+  EXPECT_EQ(my_vec3.size(), 3);
+  my_vec3 = s21::static_vector<std::string, 4>{"y"};
+  EXPECT_EQ(my_vec3.size(), 1);
+  EXPECT_EQ(my_vec3[0], "y");
+  s21::static_vector<std::string, 4> my_vec4(std::move(my_vec));
+  EXPECT_EQ(my_vec4.size(), 3);
+  EXPECT_EQ(my_vec.size(), 0);
+}
+
+TEST(StaticVector, Swap_1) {
+  s21::static_vector<std::string, 4> my_vec1{"a"};
+  s21::static_vector<std::string, 4> my_vec2{"x", "y", "z"};
+  my_vec1.swap(my_vec2);
+  EXPECT_EQ(my_vec1.size(), 3);
+  EXPECT_EQ(my_vec1[2], "z");
+  EXPECT_EQ(my_vec2.size(), 1);
+  EXPECT_EQ(my_vec2[0], "a");
+  s21::static_vector<int, 4> my_vec3{1, 2, 3};
+  s21::static_vector<int, 4> my_vec4{4};
+  my_vec4.swap(my_vec3);
+  EXPECT_EQ(my_vec3.size(), 1);
+  EXPECT_EQ(my_vec4[2], 3);
+}
+
+TEST(StaticVector, Reserve_1) {
+  s21::static_vector<int, 4> my_vec{4, 3, 1, 2};
+  my_vec.reserve(4);
+  my_vec.shrink_to_fit();
+  EXPECT_EQ(my_vec.capacity(), 4);
+  EXPECT_THROW(my_vec.reserve(5), std::length_error);
+  std::sort(my_vec.begin(), my_vec.end());
+  EXPECT_EQ(my_vec.at(0), 1);
+  EXPECT_THROW(my_vec.at(4), std::out_of_range);
+}
+
+#ifndef NDEBUG
+TEST(StaticVector, Assert_1) {
+  s21::static_vector<int, 2, s21::AssertOnOverflow> my_vec{1, 2};
+  EXPECT_DEATH(my_vec.push_back(3), "capacity exceeded");
+}
+#endif
@@ -0,0 +1,356 @@
+#include <gtest/gtest.h>
+
+#include <iterator>
+#include <list>
+#include <random>
+#include <stdexcept>
+#include <string>
+
+#include "s21_unrolled_list.h"
+
+namespace {
+// 10 int в блоке: деление и слияние блоков видны на малых размерах
+typedef s21::unrolled_list<int, 64> SmallList;
+
+// бросает при создании из отрицательного числа
+struct Picky {
+  Picky(int value) : value(value) {
+    if (value < 0) throw std::invalid_argument("negative");
+  }
+  int value;
+};
+
+template <typename List, typename T>
+void ExpectListEq(const List &actual, const std::list<T> &expected) {
+  ASSERT_EQ(actual.size(), expected.size());
+  auto it = actual.begin();
+  for (const T &value : expected) {
+    EXPECT_EQ(*it, value);
+    ++it;
+  }
+  EXPECT_TRUE(it == actual.end());
+}
+}  // namespace
+
+TEST(UnrolledList, Constructor_1) {
+  SmallList empty;
+  EXPECT_TRUE(empty.empty());
+  EXPECT_TRUE(empty.begin() == empty.end());
+  SmallList filled(25, 7);
+  ExpectListEq(filled, std::list<int>(25, 7));
+  SmallList items{1, 2, 3};
+  SmallList copy(items);
+  SmallList moved(std::move(items));
+  EXPECT_TRUE(items.empty());
+  ExpectListEq(copy, std::list<int>{1, 2, 3});
+  ExpectListEq(moved, std::list<int>{1, 2, 3});
+  copy = filled;
+  ExpectListEq(copy, std::list<int>(25, 7));
+  moved = std::move(copy);
+  ExpectListEq(moved, std::list<int>(25, 7));
+  EXPECT_EQ(SmallList::kChunkCapacity, 10);
+}
+
+TEST(UnrolledList, Push_1) {
+  SmallList my_list;
+  std::list<int> res_list;
+  for (int i = 0; i < 100; ++i) {
+    my_list.push_back(i);
+    res_list.push_back(i);
+    my_list.push_front(-i);
+    res_list.push_front(-i);
+  }
+  ExpectListEq(my_list, res_list);
+  EXPECT_EQ(my_list.front(), -99);
+  EXPECT_EQ(my_list.back(), 99);
+  auto it = my_list.end();
+  for (auto res = res_list.rbegin(); res != res_list.rend(); ++res) {
+    --it;
+    EXPECT_EQ(*it, *res);
+  }
+  EXPECT_TRUE(it == my_list.begin());
+  for (int i = 0; i < 100; ++i) {
+    my_list.pop_back();
+    my_list.pop_front();
+  }
+  EXPECT_TRUE(my_list.empty());
+  EXPECT_THROW(my_list.pop_back(), std::invalid_argument);
+}
+
+TEST(UnrolledList, Insert_1) {
+  SmallList my_list;
+  std::list<int> res_list;
+  std::mt19937 gen(7);
+  for (int step = 0; step < 3000; ++step) {
+    size_t pos = res_list.empty() ? 0 : gen() % (res_list.size() + 1);
+    auto it = std::next(my_list.begin(), pos);
+    auto res = std::next(res_list.begin(), pos);
+    if (gen() % 3 || res == res_list.end()) {
+      auto inserted = my_list.insert(it, step);
+      EXPECT_EQ(*inserted, step);
+      res_list.insert(res, step);
+    } else {
+      auto next = my_list.erase(it);
+      res = res_list.erase(res);
+      if (res == res_list.end()) {
+        EXPECT_TRUE(next == my_list.end());
+      } else {
+        EXPECT_EQ(*next, *res);
+      }
+    }
+  }
+  ExpectListEq(my_list, res_list);
+}
+
+TEST(UnrolledList, Erase_1) {
+  SmallList my_list;
+  std::list<int> res_list;
+  for (int i = 0; i < 200; ++i) {
+    my_list.push_back(i);
+    if (i % 3 == 0) res_list.push_back(i);
+  }
+  for (auto it = my_list.begin(); it != my_list.end();) {
+    if (*it % 3) {
+      it = my_list.erase(it);
+    } else {
+      ++it;
+    }
+  }
+  ExpectListEq(my_list, res_list);
+  EXPECT_THROW(my_list.erase(my_list.end()), std::invalid_argument);
+}
+
+TEST(UnrolledList, String_1) {
+  s21::unrolled_list<std::string, 128> my_list;
+  std::list<std::string> res_list;
+  for (int i = 0; i < 50; ++i) {
+    std::string value(20, static_cast<char>('a' + i % 26));
+    my_list.emplace_back(value);
+    res_list.push_back(value);
+  }
+  auto it = std::next(my_list.begin(), 3);
+  auto res = std::next(res_list.begin(), 3);
+  // аргумент — элемент того же блока, он сдвигается при вставке
+  my_list.insert(it, *it);
+  res_list.insert(res, *res);
+  my_list.emplace_front(5, 'z');
+  res_list.emplace_front(5, 'z');
+  ExpectListEq(my_list, res_list);
+  s21::unrolled_list<std::string, 128> copy(my_list);
+  copy.reverse();
+  res_list.reverse();
+  ExpectListEq(copy, res_list);
+  EXPECT_EQ(copy.back(), "zzzzz");
+}
+
+TEST(UnrolledList, Splice_1) {
+  SmallList first_list;
+  SmallList second_list;
+  std::list<int> first_res;
+  std::list<int> second_res;
+  for (int i = 0; i < 25; ++i) {
+    first_list.push_back(i);
+    first_res.push_back(i);
+    second_list.push_back(100 + i);
+    second_res.push_back(100 + i);
+  }
+  auto pos = std::next(first_list.cbegin(), 13);
+  auto res = std::next(first_res.begin(), 13);
+  first_list.splice(pos, second_list);
+  first_res.splice(res, second_res);
+  ExpectListEq(first_list, first_res);
+  EXPECT_TRUE(second_list.empty());
+
+  second_list.push_back(-1);
+  second_list.push_back(-2);
+  first_list.splice(first_list.cbegin(), second_list);
+  first_res.push_front(-2);
+  first_res.push_front(-1);
+  second_list.push_back(-3);
+  first_list.splice(first_list.cend(), second_list);
+  first_res.push_back(-3);
+  ExpectListEq(first_list, first_res);
+  first_list.push_back(1000);
+  EXPECT_EQ(first_list.back(), 1000);
+}
+
+TEST(UnrolledList, Splice_2) {
+  std::mt19937 gen(11);
+  SmallList lists[2];
+  std::list<int> res[2];
+  for (int i = 0; i < 40; ++i) {
+    lists[i % 2].push_back(i);
+    res[i % 2].push_back(i);
+  }
+  // элементы и диапазоны между списками и внутри одного, по любым местам
+  for (int step = 0; step < 300; ++step) {
+    int to = gen() % 2;
+    int from = gen() % 2;
+    if (res[from].empty()) continue;
+    size_t size = res[from].size();
+    size_t a = gen() % size;
+    size_t b = a + gen() % (size - a + 1);
+    size_t where = gen() % (res[to].size() + 1);
+    auto pos = std::next(lists[to].cbegin(), where);
+    auto first = std::next(lists[from].cbegin(), a);
+    auto res_pos = std::next(res[to].begin(), where);
+    auto res_first = std::next(res[from].begin(), a);
+    if (step % 3 == 0) {
+      lists[to].splice(pos, lists[from], first);
+      res[to].splice(res_pos, res[from], res_first);
+    } else {
+      // pos не может лежать внутри переносимого диапазона
+      if (to == from && where >= a && where < b) continue;
+      lists[to].splice(pos, lists[from], first,
+                       std::next(lists[from].cbegin(), b));
+      res[to].splice(res_pos, res[from], res_first,
+                     std::next(res[from].begin(), b));
+    }
+    ExpectListEq(lists[0], res[0]);
+    ExpectListEq(lists[1], res[1]);
+  }
+  lists[0].push_back(1000);
+  EXPECT_EQ(lists[0].back(), 1000);
+}
+
+TEST(UnrolledList, Merge_1) {
+  // ключ — десятки, единицы — порядок среди равных
+  SmallList first_list{10, 20, 21, 40, 41, 42, 43, 44, 45, 46, 47, 48};
+  SmallList second_list{11, 12, 22, 30, 49};
+  std::list<int> res_list{10, 11, 12, 20, 21, 22, 30, 40, 41,
+                          42, 43, 44, 45, 46, 47, 48, 49};
+  first_list.merge(second_list, [](int a, int b) { return a / 10 < b / 10; });
+  ExpectListEq(first_list, res_list);
+  EXPECT_TRUE(second_list.empty());
+  SmallList third_list{0, 50};
+  first_list.merge(third_list);
+  res_list.push_front(0);
+  res_list.push_back(50);
+  ExpectListEq(first_list, res_list);
+}
+
+TEST(UnrolledList, Merge_2) {
+  SmallList first_list;
+  SmallList second_list;
+  for (int i = 0; i < 30; ++i) {
+    first_list.push_back(2 * i);
+    second_list.push_back(2 * i + 1);
+  }
+  int calls = 0;
+  auto comp = [&calls](int a, int b) {
+    if (++calls == 20) throw std::runtime_error("comp");
+    return a < b;
+  };
+  // все элементы остаются в first_list, хоть и не по порядку
+  EXPECT_THROW(first_list.merge(second_list, comp), std::runtime_error);
+  EXPECT_EQ(first_list.size(), 60);
+  EXPECT_TRUE(second_list.empty());
+  EXPECT_EQ(std::distance(first_list.begin(), first_list.end()), 60);
+  first_list.sort();
+  std::list<int> res_list;
+  for (int i = 0; i < 60; ++i) res_list.push_back(i);
+  ExpectListEq(first_list, res_list);
+  second_list.push_back(-1);
+  first_list.merge(second_list);
+  EXPECT_EQ(first_list.front(), -1);
+  EXPECT_EQ(first_list.size(), 61);
+}
+
+TEST(UnrolledList, Sort_1) {
+  SmallList my_list;
+  std::list<int> res_list;
+  std::mt19937 gen(3);
+  for (int i = 0; i < 500; ++i) {
+    int value = static_cast<int>(gen() % 1000);
+    my_list.push_back(value);
+    res_list.push_back(value);
+  }
+  my_list.sort();
+  res_list.sort();
+  ExpectListEq(my_list, res_list);
+  my_list.sort(std::greater<int>());
+  res_list.sort(std::greater<int>());
+  ExpectListEq(my_list, res_list);
+}
+
+TEST(UnrolledList, Sort_2) {
+  // строки сравниваются по первой букве: проверяет устойчивость, а
+  // исключение из comp не должно оставить перемещённых оболочек
+  s21::unrolled_list<std::string, 128> my_list;
+  std::list<std::string> res_list;
+  std::mt19937 gen(7);
+  for (int i = 0; i < 400; ++i) {
+    std::string value(1, static_cast<char>('a' + gen() % 10));
+    value += std::to_string(i) + std::string(20, 'x');
+    res_list.push_back(value);
+  }
+  int calls = 0;
+  int limit = 0;
+  auto comp = [&calls, &limit](const std::string &a, const std::string &b) {
+    if (++calls == limit) throw std::runtime_error("comp");
+    return a[0] < b[0];
+  };
+  for (limit = 100; limit < 3000; limit += 700) {
+    my_list.clear();
+    for (const std::string &value : res_list) my_list.push_back(value);
+    calls = 0;
+    EXPECT_THROW(my_list.sort(comp), std::runtime_error);
+    std::list<std::string> rest(my_list.begin(), my_list.end());
+    rest.sort();
+    std::list<std::string> all(res_list);
+    all.sort();
+    EXPECT_TRUE(rest == all);
+  }
+  my_list.clear();
+  for (const std::string &value : res_list) my_list.push_back(value);
+  limit = 0;
+  my_list.sort(comp);
+  res_list.sort([](const std::string &a, const std::string &b) {
+    return a[0] < b[0];
+  });
+  ExpectListEq(my_list, res_list);
+}
+
+TEST(UnrolledList, Unique_1) {
+  SmallList my_list;
+  std::list<int> res_list;
+  for (int i = 0; i < 300; ++i) {
+    my_list.push_back(i / 7);
+    res_list.push_back(i / 7);
+  }
+  my_list.unique();
+  res_list.unique();
+  ExpectListEq(my_list, res_list);
+  my_list.push_back(-5);
+  EXPECT_EQ(my_list.back(), -5);
+  SmallList same(30, 1);
+  same.unique();
+  ExpectListEq(same, std::list<int>{1});
+}
+
+TEST(UnrolledList, Throw_1) {
+  s21::unrolled_list<Picky, 64> my_list;
+  for (int i = 0; i < 30; ++i) my_list.emplace_back(i);
+  EXPECT_THROW(my_list.emplace_back(-1), std::invalid_argument);
+  auto pos = std::next(my_list.cbegin(), 5);
+  EXPECT_THROW(my_list.emplace(pos, -1), std::invalid_argument);
+  EXPECT_EQ(my_list.size(), 30);
+  int expected = 0;
+  for (const Picky &item : my_list) EXPECT_EQ(item.value, expected++);
+}
+
+TEST(UnrolledList, Pool_1) {
+  typedef s21::unrolled_list<long long> List;
+  size_t live = s21::node_pool_stats<List>().nodes_live;
+  {
+    List my_list;
+    EXPECT_EQ(s21::node_pool_stats<List>().nodes_live, live);
+    for (int i = 0; i < 1000; ++i) my_list.push_back(i);
+    size_t chunks = (1000 + List::kChunkCapacity - 1) / List::kChunkCapacity;
+    EXPECT_EQ(s21::node_pool_stats<List>().nodes_live, live + chunks);
+    my_list.clear();
+    EXPECT_EQ(s21::node_pool_stats<List>().nodes_live, live);
+    for (int i = 0; i < 10; ++i) my_list.push_front(i);
+  }
+  EXPECT_EQ(s21::node_pool_stats<List>().nodes_live, live);
+}
@@ -1,5 +1,8 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <iterator>
+#include <sstream>
 #include <vector>
 
 #include "s21_containers.h"
@@ -450,3 +453,467 @@ TEST(Vector, Insert_6) {
     EXPECT_EQ(my_vec[i], fact[i]);
   }
 }
+
+TEST(Vector, Push_back_Growth_1) {
+  s21::vector<int> my_vec;
+  std::vector<int> fact;
+  for (int i = 0; i < 1000; ++i) {
+    my_vec.push_back(i);
+    fact.push_back(i);
+    EXPECT_EQ(my_vec.capacity(), fact.capacity());
+  }
+  for (size_t i = 0; i < fact.size(); ++i) {
+    EXPECT_EQ(my_vec[i], fact[i]);
+  }
+}
+
+TEST(Vector, Push_back_Growth_2) {
+  s21::vector<int> my_vec;
+  my_vec.reserve(100);
+  int *data = my_vec.data();
+  for (int i = 0; i < 100; ++i) my_vec.push_back(i);
+  EXPECT_EQ(my_vec.data(), data);
+  EXPECT_EQ(my_vec.capacity(), 100);
+  my_vec.push_back(100);
+  EXPECT_EQ(my_vec.capacity(), 200);
+}
+
+TEST(Vector, Push_back_Growth_3) {
+  s21::vector<int, std::allocator<int>, s21::GeometricGrowth<3, 2>> my_vec;
+  size_t expected[] = {1, 2, 3, 4, 6, 9, 13, 19, 28};
+  size_t step = 0;
+  for (int i = 0; i < 28; ++i) {
+    my_vec.push_back(i);
+    if (my_vec.size() > expected[step]) ++step;
+    EXPECT_EQ(my_vec.capacity(), expected[step]);
+  }
+  for (int i = 0; i < 28; ++i) EXPECT_EQ(my_vec[i], i);
+}
+
+namespace {
+struct NoDefault {
+  explicit NoDefault(int value) : value_(value) {}
+  int value_;
+};
+
+struct Counted {
+  static int alive;
+  Counted() { ++alive; }
+  Counted(const Counted &) { ++alive; }
+  ~Counted() { --alive; }
+};
+int Counted::alive = 0;
+}  // namespace
+
+TEST(Vector, Raw_Storage_1) {
+  s21::vector<NoDefault> my_vec;
+  my_vec.reserve(10);
+  EXPECT_EQ(my_vec.size(), 0);
+  EXPECT_EQ(my_vec.capacity(), 10);
+  for (int i = 0; i < 20; ++i) my_vec.push_back(NoDefault(i));
+  for (int i = 0; i < 20; ++i) EXPECT_EQ(my_vec[i].value_, i);
+}
+
+TEST(Vector, Raw_Storage_2) {
+  {
+    s21::vector<Counted> my_vec;
+    my_vec.reserve(100);
+    EXPECT_EQ(Counted::alive, 0);
+    my_vec.push_back(Counted());
+    my_vec.push_back(Counted());
+    my_vec.push_back(Counted());
+    EXPECT_EQ(Counted::alive, 3);
+    my_vec.pop_back();
+    EXPECT_EQ(Counted::alive, 2);
+    my_vec.clear();
+    EXPECT_EQ(Counted::alive, 0);
+    my_vec.push_back(Counted());
+    my_vec.shrink_to_fit();
+    EXPECT_EQ(Counted::alive, 1);
+  }
+  EXPECT_EQ(Counted::alive, 0);
+}
+
+TEST(Vector, Raw_Storage_3) {
+  s21::vector<std::string> my_vec{"a", "b"};
+  for (int i = 0; i < 10; ++i) my_vec.push_back(my_vec[0]);
+  EXPECT_EQ(my_vec.size(), 12);
+  for (size_t i = 0; i < my_vec.size(); ++i) {
+    EXPECT_EQ(my_vec[i], i == 1 ? "b" : "a");
+  }
+}
+
+TEST(Vector, Erase_3) {
+  s21::vector<std::string> my_vec{"a", "b", "c", "d"};
+  std::vector<std::string> fact{"a", "b", "c", "d"};
+  s21::vector<std::string>::iterator it = my_vec.begin();
+  ++it;
+  my_vec.erase(it);
+  fact.erase(fact.begin() + 1);
+  EXPECT_EQ(my_vec.size(), fact.size());
+  for (size_t i = 0; i < fact.size(); ++i) {
+    EXPECT_EQ(my_vec[i], fact[i]);
+  }
+}
+
+TEST(Vector, Copy_Constructor_2) {
+  s21::vector<std::string> vec{"one", "two", "three"};
+  s21::vector<std::string> vec2(vec);
+  EXPECT_EQ(vec2.size(), vec.size());
+  for (size_t i = 0; i < vec.size(); ++i) {
+    EXPECT_EQ(vec2[i], vec[i]);
+  }
+}
+
+TEST(Vector, Insert_7) {
+  s21::vector<int> my_vec{1, 2, 3, 4, 5};
+  my_vec.reserve(10);
+  int *data = my_vec.data();
+  s21::vector<int>::iterator it = my_vec.begin();
+  ++it;
+  ++it;
+  it = my_vec.insert(it, 8);
+  std::vector<int> fact{1, 2, 8, 3, 4, 5};
+  EXPECT_EQ(my_vec.data(), data);
+  EXPECT_EQ(*it, 8);
+  EXPECT_EQ(my_vec.size(), fact.size());
+  for (size_t i = 0; i < fact.size(); ++i) {
+    EXPECT_EQ(my_vec[i], fact[i]);
+  }
+}
+
+TEST(Vector, Insert_Range_1) {
+  s21::vector<std::string> my_vec{"a", "b", "c"};
+  std::vector<std::string> fact{"a", "b", "c"};
+  std::string src[] = {"x", "y", "z", "w"};
+  s21::vector<std::string>::iterator it = my_vec.begin();
+  ++it;
+  it = my_vec.insert(it, src, src + 4);
+  fact.insert(fact.begin() + 1, src, src + 4);
+  EXPECT_EQ(*it, "x");
+  EXPECT_EQ(my_vec.size(), fact.size());
+  EXPECT_EQ(my_vec.capacity(), fact.capacity());
+  for (size_t i = 0; i < fact.size(); ++i) {
+    EXPECT_EQ(my_vec[i], fact[i]);
+  }
+}
+
+TEST(Vector, Insert_Range_2) {
+  s21::vector<std::string> my_vec{"a", "b", "c", "d", "e"};
+  my_vec.reserve(20);
+  std::vector<std::string> fact{"a", "b", "c", "d", "e"};
+  s21::vector<std::string>::iterator it = my_vec.begin();
+  ++it;
+  my_vec.insert(it, 3, "q");
+  fact.insert(fact.begin() + 1, 3, "q");
+  my_vec.insert(my_vec.end(), 10, "t");
+  fact.insert(fact.end(), 10, "t");
+  EXPECT_EQ(my_vec.size(), fact.size());
+  EXPECT_EQ(my_vec.capacity(), 20);
+  for (size_t i = 0; i < fact.size(); ++i) {
+    EXPECT_EQ(my_vec[i], fact[i]);
+  }
+}
+
+TEST(Vector, Insert_Range_3) {
+  s21::vector<int> my_vec{1, 2};
+  std::vector<int> fact{1, 2};
+  my_vec.insert(my_vec.begin(), {7, 8, 9});
+  fact.insert(fact.begin(), {7, 8, 9});
+  my_vec.insert(my_vec.end(), {});
+  EXPECT_EQ(my_vec.size(), fact.size());
+  for (size_t i = 0; i < fact.size(); ++i) {
+    EXPECT_EQ(my_vec[i], fact[i]);
+  }
+}
+
+TEST(Vector, Insert_Range_4) {
+  s21::vector<int> my_vec{1, 2, 3};
+  my_vec.insert(my_vec.begin(), my_vec[2]);
+  my_vec.insert(my_vec.end(), 2, my_vec[0]);
+  std::vector<int> fact{3, 1, 2, 3, 3, 3};
+  EXPECT_EQ(my_vec.size(), fact.size());
+  for (size_t i = 0; i < fact.size(); ++i) {
+    EXPECT_EQ(my_vec[i], fact[i]);
+  }
+}
+
+TEST(Vector, Insert_Range_5) {
+  // однопроходный итератор: длину диапазона заранее не узнать
+  std::istringstream input("7 8 9 10");
+  s21::vector<int> my_vec{1, 2, 3};
+  std::vector<int> fact{1, 7, 8, 9, 10, 2, 3};
+  auto it = my_vec.insert(my_vec.begin() + 1, std::istream_iterator<int>(input),
+                          std::istream_iterator<int>());
+  EXPECT_EQ(*it, 7);
+  EXPECT_EQ(my_vec.size(), fact.size());
+  for (size_t i = 0; i < fact.size(); ++i) {
+    EXPECT_EQ(my_vec[i], fact[i]);
+  }
+}
+
+TEST(Vector, Erase_Range_1) {
+  s21::vector<int> my_vec{0, 1, 2, 3, 4, 5, 6, 7};
+  std::vector<int> fact{0, 1, 2, 3, 4, 5, 6, 7};
+  s21::vector<int>::iterator first = my_vec.begin();
+  ++first;
+  s21::vector<int>::iterator last = first;
+  ++last;
+  ++last;
+  ++last;
+  s21::vector<int>::iterator it = my_vec.erase(first, last);
+  fact.erase(fact.begin() + 1, fact.begin() + 4);
+  EXPECT_EQ(*it, 4);
+  EXPECT_EQ(my_vec.size(), fact.size());
+  EXPECT_EQ(my_vec.capacity(), fact.capacity());
+  for (size_t i = 0; i < fact.size(); ++i) {
+    EXPECT_EQ(my_vec[i], fact[i]);
+  }
+  my_vec.erase(my_vec.begin(), my_vec.end());
+  EXPECT_TRUE(my_vec.empty());
+}
+
+TEST(Vector, Erase_Range_2) {
+  s21::vector<std::string> my_vec{"a", "b", "c", "d", "e", "f"};
+  std::vector<std::string> fact{"a", "b", "c", "d", "e", "f"};
+  s21::vector<std::string>::iterator first = my_vec.begin();
+  ++first;
+  s21::vector<std::string>::iterator last = first;
+  ++last;
+  ++last;
+  my_vec.erase(first, last);
+  fact.erase(fact.begin() + 1, fact.begin() + 3);
+  my_vec.erase(my_vec.begin(), my_vec.begin());
+  EXPECT_EQ(my_vec.size(), fact.size());
+  for (size_t i = 0; i < fact.size(); ++i) {
+    EXPECT_EQ(my_vec[i], fact[i]);
+  }
+}
+
+TEST(Vector, Erase_If_1) {
+  s21::vector<int> my_vec;
+  std::vector<int> fact;
+  for (int i = 0; i < 1000; ++i) {
+    my_vec.push_back(i);
+    fact.push_back(i);
+  }
+  auto pred = [](int x) { return x % 7 == 0 || (x > 100 && x < 300); };
+  int calls = 0;
+  size_t removed = my_vec.erase_if([&](int x) {
+    ++calls;
+    return pred(x);
+  });
+  size_t fact_removed = fact.size();
+  fact.erase(std::remove_if(fact.begin(), fact.end(), pred), fact.end());
+  fact_removed -= fact.size();
+  EXPECT_EQ(calls, 1000);
+  EXPECT_EQ(removed, fact_removed);
+  EXPECT_EQ(my_vec.size(), fact.size());
+  for (size_t i = 0; i < fact.size(); ++i) {
+    EXPECT_EQ(my_vec[i], fact[i]);
+  }
+}
+
+TEST(Vector, Erase_If_2) {
+  s21::vector<std::string> my_vec{"x", "a", "x", "x", "b", "x"};
+  EXPECT_EQ(my_vec.erase_if([](const std::string &s) { return s == "x"; }),
+            4);
+  EXPECT_EQ(my_vec.size(), 2);
+  EXPECT_EQ(my_vec[0], "a");
+  EXPECT_EQ(my_vec[1], "b");
+  EXPECT_EQ(my_vec.erase_if([](const std::string &) { return false; }), 0);
+  EXPECT_EQ(my_vec.size(), 2);
+}
+
+TEST(Vector, VectorIterator_3) {
+  typedef s21::vector<int>::iterator iterator;
+  typedef std::iterator_traits<iterator>::iterator_category category;
+  static_assert(std::is_same_v<category, std::random_access_iterator_tag>);
+  s21::vector<int> my_vec{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+  iterator it = my_vec.begin();
+  EXPECT_EQ(*(it + 3), 3);
+  EXPECT_EQ(*(3 + it), 3);
+  EXPECT_EQ(it[5], 5);
+  it += 7;
+  EXPECT_EQ(*it, 7);
+  it -= 2;
+  EXPECT_EQ(*it--, 5);
+  EXPECT_EQ(*it++, 4);
+  EXPECT_EQ(my_vec.end() - it, 5);
+  EXPECT_TRUE(my_vec.begin() < it);
+  EXPECT_TRUE(it <= it);
+  EXPECT_TRUE(my_vec.end() > it);
+  EXPECT_TRUE(my_vec.end() >= my_vec.end());
+}
+
+TEST(Vector, VectorIterator_4) {
+  s21::vector<int> my_vec{5, 3, 9, 1, 7, 2, 8};
+  std::sort(my_vec.begin(), my_vec.end());
+  std::vector<int> fact{1, 2, 3, 5, 7, 8, 9};
+  for (size_t i = 0; i < fact.size(); ++i) EXPECT_EQ(my_vec[i], fact[i]);
+  s21::vector<int>::iterator found =
+      std::lower_bound(my_vec.begin(), my_vec.end(), 6);
+  EXPECT_EQ(*found, 7);
+  std::vector<int> copy(my_vec.size());
+  std::copy(my_vec.cbegin(), my_vec.cend(), copy.begin());
+  EXPECT_EQ(copy, fact);
+}
+
+TEST(Vector, VectorConstIterator_1) {
+  s21::vector<std::string> my_vec{"a", "bb", "ccc"};
+  const s21::vector<std::string> &cref = my_vec;
+  s21::vector<std::string>::const_iterator cit = cref.begin();
+  EXPECT_EQ(cit->size(), 1);
+  EXPECT_TRUE(cit == my_vec.begin());
+  EXPECT_TRUE(my_vec.begin() == cit);
+  cit = my_vec.end();
+  EXPECT_EQ(cit - my_vec.begin(), 3);
+  static_assert(std::is_same_v<decltype(*cit), const std::string &>);
+  size_t total = 0;
+  for (const auto &s : cref) total += s.size();
+  EXPECT_EQ(total, 6);
+}
+
+namespace {
+struct CopyCounter {
+  static int copies;
+  int value_;
+  CopyCounter(int value) : value_(value) {}
+  CopyCounter(int a, int b) : value_(a + b) {}
+  CopyCounter(const CopyCounter &other) : value_(other.value_) { ++copies; }
+  CopyCounter(CopyCounter &&other) noexcept : value_(other.value_) {}
+  CopyCounter &operator=(const CopyCounter &other) {
+    value_ = other.value_;
+    ++copies;
+    return *this;
+  }
+  CopyCounter &operator=(CopyCounter &&other) noexcept {
+    value_ = other.value_;
+    return *this;
+  }
+};
+int CopyCounter::copies = 0;
+}  // namespace
+
+TEST(Vector, Emplace_back_1) {
+  s21::vector<std::unique_ptr<int>> my_vec;
+  for (int i = 0; i < 20; ++i) my_vec.emplace_back(new int(i));
+  std::unique_ptr<int> ptr(new int(100));
+  my_vec.push_back(std::move(ptr));
+  EXPECT_EQ(ptr, nullptr);
+  my_vec.insert(my_vec.begin() + 5, std::make_unique<int>(-5));
+  my_vec.emplace(my_vec.begin(), new int(-1));
+  my_vec.erase(my_vec.begin() + 1);
+  EXPECT_EQ(my_vec.size(), 22);
+  EXPECT_EQ(*my_vec[0], -1);
+  EXPECT_EQ(*my_vec[4], 4);
+  EXPECT_EQ(*my_vec[5], -5);
+  EXPECT_EQ(*my_vec[21], 100);
+}
+
+TEST(Vector, Emplace_back_2) {
+  CopyCounter::copies = 0;
+  s21::vector<CopyCounter> my_vec;
+  my_vec.reserve(300);
+  for (int i = 0; i < 100; ++i) my_vec.emplace_back(i, 1);
+  for (int i = 0; i < 100; ++i) my_vec.push_back(CopyCounter(i));
+  my_vec.emplace(my_vec.begin() + 50, 7, 7);
+  my_vec.insert(my_vec.begin(), CopyCounter(3));
+  CopyCounter &last = my_vec.emplace_back(1, 2);
+  EXPECT_EQ(last.value_, 3);
+  EXPECT_EQ(my_vec.size(), 203);
+  EXPECT_EQ(my_vec[1].value_, 1);
+  EXPECT_EQ(my_vec[51].value_, 14);
+  EXPECT_EQ(CopyCounter::copies, 0);
+}
+
+TEST(Vector, Emplace_back_3) {
+  s21::vector<std::string> my_vec{"abc"};
+  for (int i = 0; i < 10; ++i) my_vec.emplace_back(my_vec[0], 1);
+  EXPECT_EQ(my_vec.size(), 11);
+  EXPECT_EQ(my_vec[10], "bc");
+}
+
+TEST(Vector, Operator_Equal_2) {
+  s21::vector<std::string> my_vec1{"a", "b", "c"};
+  s21::vector<std::string> my_vec2{"x"};
+  my_vec2 = my_vec1;
+  my_vec1[0] = "z";
+  EXPECT_EQ(my_vec2.size(), 3);
+  EXPECT_EQ(my_vec2[0], "a");
+  EXPECT_EQ(my_vec2[2], "c");
+  my_vec2 = my_vec2;
+  EXPECT_EQ(my_vec2.size(), 3);
+}
+
+TEST(Vector, Operator_Equal_3) {
+  s21::vector<int> my_vec1{1, 2, 3};
+  s21::vector<int> my_vec2{9, 9};
+  int *data = my_vec1.data();
+  my_vec2 = std::move(my_vec1);
+  EXPECT_EQ(my_vec2.data(), data);
+  EXPECT_EQ(my_vec2.size(), 3);
+  EXPECT_EQ(my_vec1.size(), 0);
+  EXPECT_EQ(my_vec1.capacity(), 0);
+}
+
+namespace {
+struct ThrowingMove {
+  static int copies;
+  int value_;
+  ThrowingMove(int value) : value_(value) {}
+  ThrowingMove(const ThrowingMove &other) : value_(other.value_) { ++copies; }
+  ThrowingMove(ThrowingMove &&other) : value_(other.value_) {}
+};
+int ThrowingMove::copies = 0;
+}  // namespace
+
+TEST(Vector, Move_If_Noexcept_1) {
+  static_assert(std::is_nothrow_move_constructible_v<s21::vector<int>>);
+  static_assert(std::is_nothrow_move_constructible_v<s21::list<int>>);
+  static_assert(std::is_nothrow_move_constructible_v<s21::map<int, int>>);
+  static_assert(std::is_nothrow_move_constructible_v<s21::set<int>>);
+  static_assert(std::is_nothrow_move_constructible_v<s21::stack<int>>);
+  static_assert(std::is_nothrow_move_constructible_v<s21::queue<int>>);
+  static_assert(std::is_nothrow_move_assignable_v<s21::vector<int>>);
+  static_assert(std::is_nothrow_swappable_v<s21::vector<int>>);
+  CopyCounter::copies = 0;
+  s21::vector<CopyCounter> my_vec;
+  for (int i = 0; i < 1000; ++i) my_vec.emplace_back(i);
+  EXPECT_EQ(my_vec[999].value_, 999);
+  EXPECT_EQ(CopyCounter::copies, 0);
+}
+
+TEST(Vector, Move_If_Noexcept_2) {
+  ThrowingMove::copies = 0;
+  s21::vector<ThrowingMove> my_vec;
+  for (int i = 0; i < 4; ++i) my_vec.push_back(ThrowingMove(i));
+  EXPECT_EQ(ThrowingMove::copies, 3);
+  EXPECT_EQ(my_vec[3].value_, 3);
+}
+
+TEST(Vector, Move_If_Noexcept_3) {
+  s21::vector<s21::vector<int>> my_vec;
+  s21::vector<int *> data;
+  for (int i = 0; i < 100; ++i) {
+    my_vec.emplace_back(10, i);
+    data.push_back(my_vec[i].data());
+  }
+  for (int i = 0; i < 100; ++i) {
+    EXPECT_EQ(my_vec[i].data(), data[i]);
+    EXPECT_EQ(my_vec[i][9], i);
+  }
+}
+
+TEST(Vector, Move_If_Noexcept_4) {
+  s21::vector<s21::list<int>> my_vec;
+  s21::vector<const int *> fronts;
+  for (int i = 0; i < 100; ++i) {
+    my_vec.emplace_back(s21::list<int>{i, i + 1});
+    fronts.push_back(&my_vec[i].front());
+  }
+  for (int i = 0; i < 100; ++i) {
+    EXPECT_EQ(&my_vec[i].front(), fronts[i]);
+    EXPECT_EQ(my_vec[i].back(), i + 1);
+  }
+}